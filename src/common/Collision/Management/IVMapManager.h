@@ -71,9 +71,10 @@ namespace VMAP
         private:
             bool iEnableLineOfSightCalc;
             bool iEnableHeightCalc;
+            bool iEnableTriangleCache;
 
         public:
-            IVMapManager() : iEnableLineOfSightCalc(true), iEnableHeightCalc(true) { }
+            IVMapManager() : iEnableLineOfSightCalc(true), iEnableHeightCalc(true), iEnableTriangleCache(false) { }
 
             virtual ~IVMapManager(void) { }
 
@@ -106,9 +107,15 @@ namespace VMAP
             It is enabled by default. If it is enabled in mid game the maps have to loaded manualy
             */
             void setEnableHeightCalc(bool pVal) { iEnableHeightCalc = pVal; }
+            /**
+            Enable/disable precomputed triangle edges for model ray intersection
+            It is disabled by default. Only models loaded after changing it are affected
+            */
+            void setEnableTriangleCache(bool pVal) { iEnableTriangleCache = pVal; }
 
             bool isLineOfSightCalcEnabled() const { return(iEnableLineOfSightCalc); }
             bool isHeightCalcEnabled() const { return(iEnableHeightCalc); }
+            bool isTriangleCacheEnabled() const { return(iEnableTriangleCache); }
             bool isMapLoadingEnabled() const { return(iEnableLineOfSightCalc || iEnableHeightCalc  ); }
 
             virtual std::string getDirFileName(unsigned int pMapId, int x, int y) const =0;
@@ -195,6 +195,9 @@ namespace MMAP
         dtMeshHeader* header = (dtMeshHeader*)data;
         dtTileRef tileRef = 0;
 
+        // pathfinder threads may be searching this nav mesh
+        std::unique_lock<std::shared_mutex> navMeshLock(mmap->navMeshLock);
+
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
         if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
@@ -260,6 +263,9 @@ namespace MMAP
             return false;
         }
 
+        // pathfinder threads may be searching this nav mesh
+        std::unique_lock<std::shared_mutex> navMeshLock(mmap->navMeshLock);
+
         // unload, and mark as non loaded
         if (dtStatusFailed(mmap->navMesh->removeTile(tileRefItr->second, nullptr, nullptr)))
         {
@@ -291,6 +297,7 @@ namespace MMAP
         }
 
         // unload all tiles from given map
+        // no pathfinder thread can be searching it anymore, every map using it waited for its requests before being destroyed
         MMapData* mmap = itr->second;
         for (MMapTileSet::iterator i = mmap->loadedTileRefs.begin(); i != mmap->loadedTileRefs.end(); ++i)
         {
@@ -359,4 +366,52 @@ namespace MMAP
 
         return queryItr->second;
     }
+
+    dtNavMeshQuery const* MMapManager::GetThreadNavMeshQuery(uint32 meshMapId, std::shared_lock<std::shared_mutex>& navMeshLock)
+    {
+        auto itr = GetMMapData(meshMapId);
+        if (itr == loadedMMaps.end())
+            return nullptr;
+
+        MMapData* mmap = itr->second;
+        navMeshLock = std::shared_lock<std::shared_mutex>(mmap->navMeshLock);
+
+        std::lock_guard<std::mutex> lock(mmap->threadNavMeshQueriesLock);
+        auto [queryItr, inserted] = mmap->threadNavMeshQueries.try_emplace(std::this_thread::get_id(), nullptr);
+        if (!inserted)
+            return queryItr->second;
+
+        dtNavMeshQuery* query = dtAllocNavMeshQuery();
+        ASSERT(query);
+        if (dtStatusFailed(query->init(mmap->navMesh, 1024)))
+        {
+            dtFreeNavMeshQuery(query);
+            mmap->threadNavMeshQueries.erase(queryItr);
+            TC_LOG_ERROR("maps", "MMAP:GetThreadNavMeshQuery: Failed to initialize dtNavMeshQuery for mapId %03u", meshMapId);
+            return nullptr;
+        }
+
+        TC_LOG_DEBUG("maps", "MMAP:GetThreadNavMeshQuery: created dtNavMeshQuery for mapId %03u", meshMapId);
+        queryItr->second = query;
+        return query;
+    }
+
+    void MMapManager::FreeThreadNavMeshQueries()
+    {
+        std::thread::id const threadId = std::this_thread::get_id();
+        for (MMapDataSet::value_type const& mmapData : loadedMMaps)
+        {
+            MMapData* mmap = mmapData.second;
+            if (!mmap)
+                continue;
+
+            std::lock_guard<std::mutex> lock(mmap->threadNavMeshQueriesLock);
+            auto queryItr = mmap->threadNavMeshQueries.find(threadId);
+            if (queryItr == mmap->threadNavMeshQueries.end())
+                continue;
+
+            dtFreeNavMeshQuery(queryItr->second);
+            mmap->threadNavMeshQueries.erase(queryItr);
+        }
+    }
 }
@@ -22,7 +22,10 @@
 #include "DetourNavMesh.h"
 #include "DetourNavMeshQuery.h"
 #include "Hash.h"
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -31,6 +34,7 @@ namespace MMAP
 {
     typedef std::unordered_map<uint32, dtTileRef> MMapTileSet;
     typedef std::unordered_map<std::pair<uint32, uint32>, dtNavMeshQuery*> NavMeshQuerySet;
+    typedef std::unordered_map<std::thread::id, dtNavMeshQuery*> ThreadNavMeshQuerySet;
 
     // dummy struct to hold map's mmap data
     struct TC_COMMON_API MMapData
@@ -41,6 +45,9 @@ namespace MMAP
             for (NavMeshQuerySet::iterator i = navMeshQueries.begin(); i != navMeshQueries.end(); ++i)
                 dtFreeNavMeshQuery(i->second);
 
+            for (ThreadNavMeshQuerySet::iterator i = threadNavMeshQueries.begin(); i != threadNavMeshQueries.end(); ++i)
+                dtFreeNavMeshQuery(i->second);
+
             if (navMesh)
                 dtFreeNavMesh(navMesh);
         }
@@ -48,6 +55,13 @@ namespace MMAP
         // we have to use single dtNavMeshQuery for every instance, since those are not thread safe
         NavMeshQuerySet navMeshQueries;     // instanceId to query
 
+        // queries for path searches running outside of the map thread, one per calling thread
+        ThreadNavMeshQuerySet threadNavMeshQueries;
+        std::mutex threadNavMeshQueriesLock;
+
+        // held shared by those searches, exclusively while tiles are added to or removed from navMesh
+        std::shared_mutex navMeshLock;
+
         dtNavMesh* navMesh;
 
         MMapTileSet loadedTileRefs;        // maps [map grid coords] to [dtTile]
@@ -73,6 +87,11 @@ namespace MMAP
 
             // the returned [dtNavMeshQuery const*] is NOT threadsafe
             dtNavMeshQuery const* GetNavMeshQuery(uint32 meshMapId, uint32 instanceMapId, uint32 instanceId);
+            // the returned [dtNavMeshQuery const*] is owned by the calling thread and may only be used by it
+            // navMeshLock is locked on return, the query must not be used after it is released
+            dtNavMeshQuery const* GetThreadNavMeshQuery(uint32 meshMapId, std::shared_lock<std::shared_mutex>& navMeshLock);
+            // frees every query created by GetThreadNavMeshQuery for the calling thread, call before it exits
+            void FreeThreadNavMeshQueries();
             dtNavMesh const* GetNavMesh(uint32 mapId);
 
             uint32 getLoadedTilesCount() const { return loadedTiles; }
@@ -332,6 +332,8 @@ namespace VMAP
 
             worldmodel->getModel()->SetName(filename);
             worldmodel->getModel()->Flags = flags;
+            if (isTriangleCacheEnabled())
+                worldmodel->getModel()->precomputeTriangles();
 
             model = iLoadedModelFiles.insert(std::pair<std::string, ManagedModel*>(filename, worldmodel)).first;
         }
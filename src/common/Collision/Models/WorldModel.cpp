@@ -31,14 +31,12 @@ template<> struct BoundsTrait<VMAP::GroupModel>
 
 namespace VMAP
 {
-    bool IntersectTriangle(const MeshTriangle &tri, std::vector<Vector3>::const_iterator points, const G3D::Ray &ray, float &distance)
+    inline bool IntersectTriangle(const Vector3 &v0, const Vector3 &e1, const Vector3 &e2, const G3D::Ray &ray, float &distance)
     {
         static const float EPS = 1e-5f;
 
         // See RTR2 ch. 13.7 for the algorithm.
 
-        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
-        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
         const Vector3 p(ray.direction().cross(e2));
         const float a = e1.dot(p);
 
@@ -48,7 +46,7 @@ namespace VMAP
         }
 
         const float f = 1.0f / a;
-        const Vector3 s(ray.origin() - points[tri.idx0]);
+        const Vector3 s(ray.origin() - v0);
         const float u = f * s.dot(p);
 
         if ((u < 0.0f) || (u > 1.0f)) {
@@ -81,6 +79,13 @@ namespace VMAP
         return false;
     }
 
+    bool IntersectTriangle(const MeshTriangle &tri, std::vector<Vector3>::const_iterator points, const G3D::Ray &ray, float &distance)
+    {
+        const Vector3 e1 = points[tri.idx1] - points[tri.idx0];
+        const Vector3 e2 = points[tri.idx2] - points[tri.idx0];
+        return IntersectTriangle(points[tri.idx0], e1, e2, ray, distance);
+    }
+
     class TriBoundFunc
     {
         public:
@@ -289,7 +294,7 @@ namespace VMAP
 
     GroupModel::GroupModel(const GroupModel &other):
         iBound(other.iBound), iMogpFlags(other.iMogpFlags), iGroupWMOID(other.iGroupWMOID),
-        vertices(other.vertices), triangles(other.triangles), meshTree(other.meshTree), iLiquid(nullptr)
+        vertices(other.vertices), triangles(other.triangles), triangleEdges(other.triangleEdges), meshTree(other.meshTree), iLiquid(nullptr)
     {
         if (other.iLiquid)
             iLiquid = new WmoLiquid(*other.iLiquid);
@@ -299,10 +304,25 @@ namespace VMAP
     {
         vertices.swap(vert);
         triangles.swap(tri);
+        triangleEdges.clear();
         TriBoundFunc bFunc(vertices);
         meshTree.build(triangles, bFunc);
     }
 
+    void GroupModel::precomputeTriangles()
+    {
+        // edges are computed with the same operations as IntersectTriangle, ray tests stay bit-identical
+        triangleEdges.resize(triangles.size());
+        for (std::size_t i = 0; i < triangles.size(); ++i)
+        {
+            MeshTriangle const& tri = triangles[i];
+            TriangleEdges& edges = triangleEdges[i];
+            edges.v0 = vertices[tri.idx0];
+            edges.e1 = vertices[tri.idx1] - vertices[tri.idx0];
+            edges.e2 = vertices[tri.idx2] - vertices[tri.idx0];
+        }
+    }
+
     bool GroupModel::writeToFile(FILE* wf)
     {
         bool result = true;
@@ -356,6 +376,7 @@ namespace VMAP
         uint32 chunkSize = 0;
         uint32 count = 0;
         triangles.clear();
+        triangleEdges.clear();
         vertices.clear();
         delete iLiquid;
         iLiquid = nullptr;
@@ -406,11 +427,31 @@ namespace VMAP
         bool hit;
     };
 
+    struct GModelPrecomputedRayCallback
+    {
+        GModelPrecomputedRayCallback(const std::vector<TriangleEdges> &edges): triangles(edges.begin()), hit(false) { }
+        bool operator()(const G3D::Ray& ray, uint32 entry, float& distance, bool /*pStopAtFirstHit*/)
+        {
+            TriangleEdges const& tri = triangles[entry];
+            hit = IntersectTriangle(tri.v0, tri.e1, tri.e2, ray, distance) || hit;
+            return hit;
+        }
+        std::vector<TriangleEdges>::const_iterator triangles;
+        bool hit;
+    };
+
     bool GroupModel::IntersectRay(const G3D::Ray &ray, float &distance, bool stopAtFirstHit) const
     {
         if (triangles.empty())
             return false;
 
+        if (!triangleEdges.empty())
+        {
+            GModelPrecomputedRayCallback callback(triangleEdges);
+            meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
+            return callback.hit;
+        }
+
         GModelRayCallback callback(triangles, vertices);
         meshTree.intersectRay(ray, callback, distance, stopAtFirstHit);
         return callback.hit;
@@ -458,6 +499,12 @@ namespace VMAP
         groupTree.build(groupModels, BoundsTrait<GroupModel>::getBounds, 1);
     }
 
+    void WorldModel::precomputeTriangles()
+    {
+        for (GroupModel& groupModel : groupModels)
+            groupModel.precomputeTriangles();
+    }
+
     struct WModelRayCallBack
     {
         WModelRayCallBack(const std::vector<GroupModel> &mod): models(mod.begin()), hit(false) { }
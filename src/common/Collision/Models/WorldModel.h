@@ -45,6 +45,14 @@ namespace VMAP
             uint32 idx2;
     };
 
+    /*! triangle vertex and edges resolved ahead of time, avoids the index lookups during ray intersection */
+    struct TriangleEdges
+    {
+        G3D::Vector3 v0;
+        G3D::Vector3 e1;
+        G3D::Vector3 e2;
+    };
+
     class TC_COMMON_API WmoLiquid
     {
         public:
@@ -83,6 +91,8 @@ namespace VMAP
             //! pass mesh data to object and create BIH. Passed vectors get get swapped with old geometry!
             void setMeshData(std::vector<G3D::Vector3> &vert, std::vector<MeshTriangle> &tri);
             void setLiquidData(WmoLiquid*& liquid) { iLiquid = liquid; liquid = nullptr; }
+            //! resolve triangle vertices into edge data used by IntersectRay, trades memory for faster ray tests
+            void precomputeTriangles();
             bool IntersectRay(const G3D::Ray &ray, float &distance, bool stopAtFirstHit) const;
             bool IsInsideObject(const G3D::Vector3 &pos, const G3D::Vector3 &down, float &z_dist) const;
             bool GetLiquidLevel(const G3D::Vector3 &pos, float &liqHeight) const;
@@ -99,6 +109,7 @@ namespace VMAP
             uint32 iGroupWMOID;
             std::vector<G3D::Vector3> vertices;
             std::vector<MeshTriangle> triangles;
+            std::vector<TriangleEdges> triangleEdges;
             BIH meshTree;
             WmoLiquid* iLiquid;
     };
@@ -112,6 +123,7 @@ namespace VMAP
             //! pass group models to WorldModel and create BIH. Passed vector is swapped with old geometry!
             void setGroupModels(std::vector<GroupModel> &models);
             void setRootWmoID(uint32 id) { RootWMOID = id; }
+            void precomputeTriangles();
             bool IntersectRay(const G3D::Ray &ray, float &distance, bool stopAtFirstHit, ModelIgnoreFlags ignoreFlags) const;
             bool IntersectPoint(const G3D::Vector3 &p, const G3D::Vector3 &down, float &dist, AreaInfo &info) const;
             bool GetLocationInfo(const G3D::Vector3 &p, const G3D::Vector3 &down, float &dist, GroupLocationInfo& info) const;
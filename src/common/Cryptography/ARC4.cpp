@@ -17,8 +17,10 @@
 
 #include "ARC4.h"
 #include "Errors.h"
+#include <algorithm>
+#include <cstring>
 
-ARC4::ARC4(uint32 len) : _ctx(EVP_CIPHER_CTX_new())
+ARC4::ARC4(uint32 len) : _ctx(EVP_CIPHER_CTX_new()), _keystream(), _keystreamPosition(KeystreamBlockSize)
 {
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
     _cipher = EVP_CIPHER_fetch(nullptr, "RC4", nullptr);
@@ -31,7 +33,7 @@ ARC4::ARC4(uint32 len) : _ctx(EVP_CIPHER_CTX_new())
     EVP_CIPHER_CTX_set_key_length(_ctx, len);
 }
 
-ARC4::ARC4(uint8* seed, uint32 len) : _ctx(EVP_CIPHER_CTX_new())
+ARC4::ARC4(uint8* seed, uint32 len) : _ctx(EVP_CIPHER_CTX_new()), _keystream(), _keystreamPosition(KeystreamBlockSize)
 {
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
     _cipher = EVP_CIPHER_fetch(nullptr, "RC4", nullptr);
@@ -57,11 +59,59 @@ ARC4::~ARC4()
 void ARC4::Init(uint8* seed)
 {
     EVP_EncryptInit_ex(_ctx, nullptr, nullptr, seed, nullptr);
+    _keystreamPosition = KeystreamBlockSize;
 }
 
 void ARC4::UpdateData(int len, uint8* data)
 {
+    std::size_t remaining = std::size_t(len);
+    while (remaining)
+    {
+        if (_keystreamPosition == KeystreamBlockSize)
+        {
+            // whole blocks are encrypted in place without going through the keystream buffer
+            if (remaining >= KeystreamBlockSize)
+            {
+                int outlen = 0;
+                int blocksLength = int(remaining - remaining % KeystreamBlockSize);
+                EVP_EncryptUpdate(_ctx, data, &outlen, data, blocksLength);
+                EVP_EncryptFinal_ex(_ctx, data, &outlen);
+                data += blocksLength;
+                remaining -= blocksLength;
+                continue;
+            }
+
+            GenerateKeystream();
+        }
+
+        std::size_t count = std::min(remaining, KeystreamBlockSize - _keystreamPosition);
+        uint8 const* keystream = _keystream.data() + _keystreamPosition;
+        std::size_t i = 0;
+        for (; i + sizeof(uint64) <= count; i += sizeof(uint64))
+        {
+            uint64 word, key;
+            memcpy(&word, data + i, sizeof(uint64));
+            memcpy(&key, keystream + i, sizeof(uint64));
+            word ^= key;
+            memcpy(data + i, &word, sizeof(uint64));
+        }
+
+        for (; i < count; ++i)
+            data[i] ^= keystream[i];
+
+        _keystreamPosition += count;
+        data += count;
+        remaining -= count;
+    }
+}
+
+void ARC4::GenerateKeystream()
+{
+    // encrypting zeros yields the raw keystream
+    _keystream.fill(0);
+
     int outlen = 0;
-    EVP_EncryptUpdate(_ctx, data, &outlen, data, len);
-    EVP_EncryptFinal_ex(_ctx, data, &outlen);
+    EVP_EncryptUpdate(_ctx, _keystream.data(), &outlen, _keystream.data(), int(KeystreamBlockSize));
+    EVP_EncryptFinal_ex(_ctx, _keystream.data(), &outlen);
+    _keystreamPosition = 0;
 }
@@ -22,19 +22,27 @@
 #include <array>
 #include <openssl/evp.h>
 
+// RC4 keystream is generated through OpenSSL in blocks and xor'ed with the data,
+// so the many few byte packet headers do not pay for an EVP call each
 class TC_COMMON_API ARC4
 {
     public:
+        static constexpr std::size_t KeystreamBlockSize = 1024;
+
         ARC4(uint32 len);
         ARC4(uint8* seed, uint32 len);
         ~ARC4();
         void Init(uint8* seed);
         void UpdateData(int len, uint8* data);
     private:
+        void GenerateKeystream();
+
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
         EVP_CIPHER *_cipher;
 #endif
         EVP_CIPHER_CTX* _ctx;
+        std::array<uint8, KeystreamBlockSize> _keystream;
+        std::size_t _keystreamPosition;
 };
 
 #endif
@@ -0,0 +1,61 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "AliasTable.h"
+#include "Random.h"
+#include <algorithm>
+
+void Trinity::AliasTable::Build(std::vector<double> const& weights)
+{
+    std::size_t const columns = weights.size();
+    _chance.assign(columns, 1.0);
+    _alias.resize(columns);
+
+    double total = 0.0;
+    for (double weight : weights)
+        total += std::max(weight, 0.0);
+
+    std::vector<double> scaled(columns);
+    std::vector<uint32> small, large;
+    for (std::size_t i = 0; i < columns; ++i)
+    {
+        _alias[i] = i;
+        scaled[i] = total > 0.0 ? std::max(weights[i], 0.0) * columns / total : 1.0;
+        (scaled[i] < 1.0 ? small : large).push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        uint32 less = small.back();
+        small.pop_back();
+        uint32 more = large.back();
+        large.pop_back();
+
+        _chance[less] = scaled[less];
+        _alias[less] = more;
+        scaled[more] -= 1.0 - scaled[less];
+        (scaled[more] < 1.0 ? small : large).push_back(more);
+    }
+
+    // columns left in either list are full up to rounding errors and keep chance 1
+}
+
+uint32 Trinity::AliasTable::Pick() const
+{
+    return Pick(urand(0, _chance.size() - 1), rand_norm());
+}
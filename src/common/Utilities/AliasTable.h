@@ -0,0 +1,51 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef TRINITY_ALIAS_TABLE_H
+#define TRINITY_ALIAS_TABLE_H
+
+#include "Define.h"
+#include <vector>
+
+namespace Trinity
+{
+    /// Walker alias table, picks an index with the probability of its weight in constant time.
+    /// Built once with Vose's method, every pick is one uniform column and one uniform roll.
+    class TC_COMMON_API AliasTable
+    {
+    public:
+        /// Weights don't need to add up to anything, indexes with weight 0 are never picked.
+        /// All indexes are equally likely if no weight is positive.
+        void Build(std::vector<double> const& weights);
+
+        bool IsEmpty() const { return _chance.empty(); }
+        std::size_t GetSize() const { return _chance.size(); }
+
+        /// Picks an index using urand and rand_norm
+        uint32 Pick() const;
+
+        /// Picks an index from a uniformly chosen column (0..GetSize() - 1) and a uniform roll (0..1 exclusive)
+        uint32 Pick(uint32 column, double roll) const { return roll < _chance[column] ? column : _alias[column]; }
+
+    private:
+        std::vector<double> _chance;
+        std::vector<uint32> _alias;
+    };
+}
+
+#endif // TRINITY_ALIAS_TABLE_H
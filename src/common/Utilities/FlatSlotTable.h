@@ -0,0 +1,203 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_FLAT_SLOT_TABLE_H
+#define TRINITY_FLAT_SLOT_TABLE_H
+
+#include "Define.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Trinity
+{
+    /// Entries stored in fixed size chunks so they never move, identified by their slot number.
+    /// Slots of freed entries are reused by the next allocations.
+    template<class T, uint32 EntriesPerChunk>
+    class FlatSlotTable
+    {
+    public:
+        FlatSlotTable() : _slotCount(0) { }
+
+        /// Returns the slot of a default constructed entry
+        uint32 Allocate()
+        {
+            if (!_freeSlots.empty())
+            {
+                uint32 slot = _freeSlots.back();
+                _freeSlots.pop_back();
+                return slot;
+            }
+
+            if (_slotCount % EntriesPerChunk == 0)
+                _chunks.push_back(std::make_unique<T[]>(EntriesPerChunk));
+
+            return _slotCount++;
+        }
+
+        void Free(uint32 slot)
+        {
+            (*this)[slot] = T();
+            _freeSlots.push_back(slot);
+        }
+
+        T& operator[](uint32 slot) { return _chunks[slot / EntriesPerChunk][slot % EntriesPerChunk]; }
+        T const& operator[](uint32 slot) const { return _chunks[slot / EntriesPerChunk][slot % EntriesPerChunk]; }
+
+        void Reserve(std::size_t count) { _chunks.reserve((count + EntriesPerChunk - 1) / EntriesPerChunk); }
+
+        void Clear()
+        {
+            _chunks.clear();
+            _freeSlots.clear();
+            _slotCount = 0;
+        }
+
+        /// Highest slot number ever returned plus one
+        uint32 GetSlotCount() const { return _slotCount; }
+        std::size_t GetSize() const { return _slotCount - _freeSlots.size(); }
+
+        std::size_t GetMemoryUsage() const
+        {
+            return _chunks.capacity() * sizeof(std::unique_ptr<T[]>) + _chunks.size() * EntriesPerChunk * sizeof(T)
+                + _freeSlots.capacity() * sizeof(uint32);
+        }
+
+    private:
+        std::vector<std::unique_ptr<T[]>> _chunks;
+        std::vector<uint32> _freeSlots;
+        uint32 _slotCount;
+    };
+
+    /// Open addressing hash of slot numbers with linear probing and backward shift deletion.
+    /// Keys are not stored, they are compared through the slots themselves by the Equal callbacks, so several slots may share a key.
+    class SlotHashIndex
+    {
+        struct Bucket
+        {
+            uint32 Hash;
+            uint32 Slot;
+        };
+
+    public:
+        static constexpr uint32 InvalidSlot = std::numeric_limits<uint32>::max();
+
+        SlotHashIndex() : _size(0), _mask(0) { }
+
+        /// Returns the first slot with this hash accepted by equal, or InvalidSlot
+        template<typename Equal>
+        uint32 Find(uint32 hash, Equal equal) const
+        {
+            std::size_t i = FindBucket(hash, equal);
+            return i != _buckets.size() ? _buckets[i].Slot : InvalidSlot;
+        }
+
+        void Insert(uint32 hash, uint32 slot)
+        {
+            if ((_size + 1) * 4 > _buckets.size() * 3)
+                Rehash(std::max<std::size_t>(_buckets.size() * 2, 64));
+
+            InsertNoGrow(hash, slot);
+            ++_size;
+        }
+
+        /// Removes the first slot with this hash accepted by equal
+        template<typename Equal>
+        bool Erase(uint32 hash, Equal equal)
+        {
+            std::size_t i = FindBucket(hash, equal);
+            if (i == _buckets.size())
+                return false;
+
+            // Backward shift deletion, moves every following bucket that may not be skipped over into the hole
+            for (std::size_t j = (i + 1) & _mask; _buckets[j].Slot != InvalidSlot; j = (j + 1) & _mask)
+            {
+                std::size_t home = _buckets[j].Hash & _mask;
+                bool reachable = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+                if (!reachable)
+                {
+                    _buckets[i] = _buckets[j];
+                    i = j;
+                }
+            }
+
+            _buckets[i].Slot = InvalidSlot;
+            --_size;
+            return true;
+        }
+
+        void Reserve(std::size_t count)
+        {
+            std::size_t bucketCount = 64;
+            while (bucketCount * 3 < count * 4)
+                bucketCount *= 2;
+
+            if (bucketCount > _buckets.size())
+                Rehash(bucketCount);
+        }
+
+        void Clear()
+        {
+            _buckets.clear();
+            _size = 0;
+            _mask = 0;
+        }
+
+        std::size_t GetSize() const { return _size; }
+        std::size_t GetMemoryUsage() const { return _buckets.capacity() * sizeof(Bucket); }
+
+    private:
+        template<typename Equal>
+        std::size_t FindBucket(uint32 hash, Equal equal) const
+        {
+            if (_buckets.empty())
+                return _buckets.size();
+
+            for (std::size_t i = hash & _mask; _buckets[i].Slot != InvalidSlot; i = (i + 1) & _mask)
+                if (_buckets[i].Hash == hash && equal(_buckets[i].Slot))
+                    return i;
+
+            return _buckets.size();
+        }
+
+        void InsertNoGrow(uint32 hash, uint32 slot)
+        {
+            std::size_t i = hash & _mask;
+            while (_buckets[i].Slot != InvalidSlot)
+                i = (i + 1) & _mask;
+
+            _buckets[i] = { hash, slot };
+        }
+
+        void Rehash(std::size_t bucketCount)
+        {
+            std::vector<Bucket> oldBuckets(bucketCount, Bucket{ 0, InvalidSlot });
+            std::swap(oldBuckets, _buckets);
+            _mask = bucketCount - 1;
+            for (Bucket const& bucket : oldBuckets)
+                if (bucket.Slot != InvalidSlot)
+                    InsertNoGrow(bucket.Hash, bucket.Slot);
+        }
+
+        std::vector<Bucket> _buckets;
+        std::size_t _size;
+        std::size_t _mask;
+    };
+}
+
+#endif // TRINITY_FLAT_SLOT_TABLE_H
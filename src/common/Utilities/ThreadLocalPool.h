@@ -0,0 +1,201 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_THREAD_LOCAL_POOL_H
+#define TRINITY_THREAD_LOCAL_POOL_H
+
+#include <cstddef>
+#include <list>
+#include <new>
+
+namespace Trinity
+{
+    // Memory blocks of BlockSize bytes for short lived objects allocated at a high rate, meant to back a class specific
+    // operator new and delete. Freed blocks are kept in a free list of the freeing thread, up to MaxFreeBlocks, and handed
+    // out again by its next allocations without going through the global allocator.
+    // A block may be freed by another thread than the one that allocated it, it then moves to the free list of that thread.
+    template<std::size_t BlockSize, std::size_t MaxFreeBlocks>
+    class ThreadLocalPool
+    {
+        struct FreeBlock
+        {
+            FreeBlock* Next;
+        };
+
+        static_assert(BlockSize >= sizeof(FreeBlock), "ThreadLocalPool blocks must be able to hold a free list link");
+
+        struct FreeList
+        {
+            FreeBlock* Head = nullptr;
+            std::size_t Count = 0;
+
+            ~FreeList()
+            {
+                while (FreeBlock* block = Head)
+                {
+                    Head = block->Next;
+                    ::operator delete(block);
+                }
+
+                IsDestroyed() = true;
+            }
+        };
+
+        static FreeList& GetFreeList()
+        {
+            thread_local FreeList freeList;
+            return freeList;
+        }
+
+        // Trivially destructible, stays usable after freeList is destroyed
+        // Blocks freed later on this thread, during its remaining destructors, then go back to the global allocator
+        static bool& IsDestroyed()
+        {
+            thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+    public:
+        static void* Allocate()
+        {
+            if (IsDestroyed())
+                return ::operator new(BlockSize);
+
+            FreeList& freeList = GetFreeList();
+            if (FreeBlock* block = freeList.Head)
+            {
+                freeList.Head = block->Next;
+                --freeList.Count;
+                return block;
+            }
+
+            return ::operator new(BlockSize);
+        }
+
+        static void Deallocate(void* ptr)
+        {
+            if (!ptr)
+                return;
+
+            if (IsDestroyed())
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            FreeList& freeList = GetFreeList();
+            if (freeList.Count >= MaxFreeBlocks)
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            FreeBlock* block = static_cast<FreeBlock*>(ptr);
+            block->Next = freeList.Head;
+            freeList.Head = block;
+            ++freeList.Count;
+        }
+
+        // Number of blocks ready to be reused by the calling thread
+        static std::size_t GetFreeCount() { return IsDestroyed() ? 0 : GetFreeList().Count; }
+    };
+
+    // Nodes of std::list<T> containers filled and emptied at a high rate, recycled through a spare list of each thread,
+    // up to MaxSpareNodes, instead of going through the global allocator for every element.
+    // Lists only take spare nodes out and give them back, so they may be filled recursively.
+    template<class T, std::size_t MaxSpareNodes>
+    class ThreadLocalListNodes
+    {
+        struct SpareList
+        {
+            std::list<T> Nodes;
+
+            ~SpareList() { IsDestroyed() = true; }
+        };
+
+        static SpareList& GetSpareList()
+        {
+            thread_local SpareList spare;
+            return spare;
+        }
+
+        static bool& IsDestroyed()
+        {
+            thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+    public:
+        static void PushBack(std::list<T>& list, T const& value)
+        {
+            if (IsDestroyed() || GetSpareList().Nodes.empty())
+            {
+                list.push_back(value);
+                return;
+            }
+
+            std::list<T>& spare = GetSpareList().Nodes;
+            list.splice(list.end(), spare, spare.begin());
+            list.back() = value;
+        }
+
+        // Empties list, keeping its nodes for the next PushBack calls of this thread
+        static void Recycle(std::list<T>& list)
+        {
+            if (IsDestroyed())
+            {
+                list.clear();
+                return;
+            }
+
+            std::list<T>& spare = GetSpareList().Nodes;
+            if (spare.size() + list.size() <= MaxSpareNodes)
+                spare.splice(spare.end(), list);
+            else
+                list.clear();
+        }
+
+        // Number of nodes ready to be reused by the calling thread
+        static std::size_t GetSpareCount() { return IsDestroyed() ? 0 : GetSpareList().Nodes.size(); }
+
+        // Container for functions expecting push_back, appends to a list with recycled nodes
+        struct Inserter
+        {
+            explicit Inserter(std::list<T>& list) : List(list) { }
+
+            void push_back(T const& value) { PushBack(List, value); }
+
+            std::list<T>& List;
+        };
+
+        // Gives the nodes of a list back when going out of scope
+        class Recycler
+        {
+        public:
+            explicit Recycler(std::list<T>& list) : _list(list) { }
+            ~Recycler() { Recycle(_list); }
+
+            Recycler(Recycler const&) = delete;
+            Recycler& operator=(Recycler const&) = delete;
+
+        private:
+            std::list<T>& _list;
+        };
+    };
+}
+
+#endif // TRINITY_THREAD_LOCAL_POOL_H
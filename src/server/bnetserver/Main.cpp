@@ -33,6 +33,7 @@
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
 #include "IoContext.h"
+#include "LoginCryptoPool.h"
 #include "MySQLThreading.h"
 #include "ModuleManager.h"
 #include "OpenSSLCrypto.h"
@@ -82,6 +83,7 @@ bool StartDB();
 void StopDB();
 void SignalHandler(std::weak_ptr<Trinity::Asio::IoContext> ioContextRef, boost::system::error_code const& error, int signalNumber);
 void KeepDatabaseAliveHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> dbPingTimerRef, int32 dbPingInterval, boost::system::error_code const& error);
+void LoginStatsHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> loginStatsTimerRef, int32 loginStatsInterval, uint64 lastLoginCount, uint64 lastRejectedCount, boost::system::error_code const& error);
 variables_map GetConsoleArguments(int argc, char** argv, fs::path& configFile, std::string& configService);
 
 int main(int argc, char** argv)
@@ -184,6 +186,10 @@ int main(int argc, char** argv)
 
     std::shared_ptr<void> sBNetRealmListHandle(nullptr, [](void*) { sBNetRealmList->Close(); });
 
+    sLoginCryptoPool.Initialize(sConfigMgr->GetIntDefault("LoginCrypto.Threads", 2), sConfigMgr->GetIntDefault("LoginCrypto.MaxQueuedJobs", 1000));
+
+    std::shared_ptr<void> sLoginCryptoPoolHandle(nullptr, [](void*) { sLoginCryptoPool.Close(); });
+
     std::string bindIp = sConfigMgr->GetStringDefault("BindIP", "0.0.0.0");
 
     if (!sSessionMgr.StartNetwork(*ioContext, bindIp, bnport))
@@ -210,6 +216,16 @@ int main(int argc, char** argv)
     dbPingTimer->expires_from_now(boost::posix_time::minutes(dbPingInterval));
     dbPingTimer->async_wait(std::bind(&KeepDatabaseAliveHandler, std::weak_ptr<Trinity::Asio::DeadlineTimer>(dbPingTimer), dbPingInterval, std::placeholders::_1));
 
+    // Report the login rate, useful to see how fast a reconnect storm is being worked through
+    int32 loginStatsInterval = sConfigMgr->GetIntDefault("LoginStats.Interval", 0);
+    std::shared_ptr<Trinity::Asio::DeadlineTimer> loginStatsTimer;
+    if (loginStatsInterval > 0)
+    {
+        loginStatsTimer = std::make_shared<Trinity::Asio::DeadlineTimer>(*ioContext);
+        loginStatsTimer->expires_from_now(boost::posix_time::seconds(loginStatsInterval));
+        loginStatsTimer->async_wait(std::bind(&LoginStatsHandler, std::weak_ptr<Trinity::Asio::DeadlineTimer>(loginStatsTimer), loginStatsInterval, uint64(0), uint64(0), std::placeholders::_1));
+    }
+
 #if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
     std::shared_ptr<Trinity::Asio::DeadlineTimer> serviceStatusWatchTimer;
     if (m_ServiceStatus != -1)
@@ -230,6 +246,8 @@ int main(int argc, char** argv)
     ioContext->run();
 
     dbPingTimer->cancel();
+    if (loginStatsTimer)
+        loginStatsTimer->cancel();
 
     TC_LOG_INFO("server.bnetserver", "Halting process...");
 
@@ -286,6 +304,24 @@ void KeepDatabaseAliveHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> dbPing
     }
 }
 
+void LoginStatsHandler(std::weak_ptr<Trinity::Asio::DeadlineTimer> loginStatsTimerRef, int32 loginStatsInterval, uint64 lastLoginCount, uint64 lastRejectedCount, boost::system::error_code const& error)
+{
+    if (!error)
+    {
+        if (std::shared_ptr<Trinity::Asio::DeadlineTimer> loginStatsTimer = loginStatsTimerRef.lock())
+        {
+            uint64 loginCount = sSessionMgr.GetLoginCount();
+            uint64 rejectedCount = Battlenet::LoginCryptoPool::GetStatistics().Rejected;
+
+            TC_LOG_INFO("server.bnetserver", "Logins: %.2f/s, rejected as busy: " UI64FMTD ", queued crypto jobs: %u",
+                float(loginCount - lastLoginCount) / loginStatsInterval, rejectedCount - lastRejectedCount, sLoginCryptoPool.GetQueuedJobs());
+
+            loginStatsTimer->expires_from_now(boost::posix_time::seconds(loginStatsInterval));
+            loginStatsTimer->async_wait(std::bind(&LoginStatsHandler, loginStatsTimerRef, loginStatsInterval, loginCount, rejectedCount, std::placeholders::_1));
+        }
+    }
+}
+
 #if TRINITY_PLATFORM == TRINITY_PLATFORM_WINDOWS
 void ServiceStatusWatcher(std::weak_ptr<Trinity::Asio::DeadlineTimer> serviceStatusWatchTimerRef, std::weak_ptr<Trinity::Asio::IoContext> ioContextRef, boost::system::error_code const& error)
 {
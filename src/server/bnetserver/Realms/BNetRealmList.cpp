@@ -16,6 +16,7 @@
  */
 
 #include "BNetRealmList.h"
+#include "AuthCodes.h"
 #include "DatabaseEnv.h"
 #include "DeadlineTimer.h"
 #include "DeadlineTimer.h"
@@ -192,15 +193,30 @@ void BNetRealmList::UpdateRealms(boost::system::error_code const& error)
         pair.second.Keep = false;
     }
 
-    for (Battlenet::RealmHandle const& deleted : deletedRealms)
-        _realms.erase(deleted);
+    if (!updatedRealms.empty() || !deletedRealms.empty())
+    {
+        // erased under the lock and before dropping the cached lists, so GetSerializedRealmList cannot cache deleted realms again
+        std::lock_guard<std::mutex> lock(_serializedRealmListsLock);
+        for (Battlenet::RealmHandle const& deleted : deletedRealms)
+            _realms.erase(deleted);
+
+        _serializedRealmLists.clear();
+    }
 
     if (!updatedRealms.empty() || !deletedRealms.empty())
     {
-        sSessionMgr.LockedForEach([&updatedRealms, &deletedRealms](Battlenet::Session* session)
+        // Changes are serialized once for every build and security level and the same bytes are sent to all sessions sharing them
+        std::map<std::pair<uint32, AccountTypes>, std::shared_ptr<SerializedRealmList const>> updates;
+        sSessionMgr.LockedForEach([&updatedRealms, &deletedRealms, &updates](Battlenet::Session* session)
         {
-            if (session->IsSubscribedToRealmListUpdates())
-                session->UpdateRealms(updatedRealms, deletedRealms);
+            if (!session->IsSubscribedToRealmListUpdates())
+                return;
+
+            std::shared_ptr<SerializedRealmList const>& update = updates[{ session->GetBuild(), session->GetSecurityLevel() }];
+            if (!update)
+                update = SerializeRealms(updatedRealms, deletedRealms, session->GetBuild(), session->GetSecurityLevel());
+
+            session->UpdateRealms(*update);
         });
     }
 
@@ -219,3 +235,49 @@ Realm const* BNetRealmList::GetRealm(Battlenet::RealmHandle const& id) const
 
     return nullptr;
 }
+
+std::shared_ptr<BNetRealmList::SerializedRealmList const> BNetRealmList::GetSerializedRealmList(uint32 build, AccountTypes securityLevel)
+{
+    std::lock_guard<std::mutex> lock(_serializedRealmListsLock);
+    std::shared_ptr<SerializedRealmList const>& cached = _serializedRealmLists[{ build, securityLevel }];
+    if (cached)
+        return cached;
+
+    std::vector<Realm const*> realms;
+    realms.reserve(_realms.size());
+    for (RealmMap::value_type const& pair : _realms)
+        realms.push_back(&pair.second);
+
+    cached = SerializeRealms(realms, std::vector<Battlenet::RealmHandle>(), build, securityLevel);
+    return cached;
+}
+
+std::shared_ptr<BNetRealmList::SerializedRealmList const> BNetRealmList::SerializeRealms(std::vector<Realm const*> const& realms, std::vector<Battlenet::RealmHandle> const& deletedRealms,
+    uint32 build, AccountTypes securityLevel)
+{
+    std::shared_ptr<SerializedRealmList> realmList = std::make_shared<SerializedRealmList>();
+    for (Realm const* realm : realms)
+    {
+        if (realm->Build != build && AuthHelper::GetBuildInfo(realm->Build))
+        {
+            realmList->ClientSpecificRealms.push_back(realm->Id);
+            continue;
+        }
+
+        // Address is only sent for realms with different build, any client address gives the same packet here
+        std::unique_ptr<Battlenet::WoWRealm::ListUpdate> listUpdate(Battlenet::Session::BuildListUpdate(realm, build, securityLevel, boost::asio::ip::address()));
+        listUpdate->Write();
+        realmList->Packets.insert(realmList->Packets.end(), listUpdate->GetData(), listUpdate->GetData() + listUpdate->GetSize());
+    }
+
+    for (Battlenet::RealmHandle const& deleted : deletedRealms)
+    {
+        Battlenet::WoWRealm::ListUpdate listUpdate;
+        listUpdate.UpdateState = Battlenet::WoWRealm::ListUpdate::DELETED;
+        listUpdate.Id = deleted;
+        listUpdate.Write();
+        realmList->Packets.insert(realmList->Packets.end(), listUpdate.GetData(), listUpdate.GetData() + listUpdate.GetSize());
+    }
+
+    return realmList;
+}
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "Realm.h"
 #include <map>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <unordered_set>
 
@@ -40,6 +42,13 @@ class BNetRealmList
     public:
         typedef std::map<Battlenet::RealmHandle, Realm> RealmMap;
 
+        /// SMSG_LIST_UPDATE packets serialized once for every client build and security level
+        struct SerializedRealmList
+        {
+            std::vector<uint8> Packets;
+            std::vector<Battlenet::RealmHandle> ClientSpecificRealms;  // realms advertising their address, it depends on the client network
+        };
+
         static BNetRealmList* Instance();
 
         ~BNetRealmList();
@@ -49,6 +58,7 @@ class BNetRealmList
 
         RealmMap const& GetRealms() const { return _realms; }
         Realm const* GetRealm(Battlenet::RealmHandle const& id) const;
+        std::shared_ptr<SerializedRealmList const> GetSerializedRealmList(uint32 build, AccountTypes securityLevel);
 
     private:
         BNetRealmList();
@@ -57,8 +67,12 @@ class BNetRealmList
         void UpdateRealm(Battlenet::RealmHandle const& id, uint32 build, std::string const& name,
             boost::asio::ip::address&& address, boost::asio::ip::address&& localAddr, boost::asio::ip::address&& localSubmask,
             uint16 port, uint8 icon, RealmFlags flag, uint8 timezone, AccountTypes allowedSecurityLevel, float population);
+        static std::shared_ptr<SerializedRealmList const> SerializeRealms(std::vector<Realm const*> const& realms, std::vector<Battlenet::RealmHandle> const& deletedRealms,
+            uint32 build, AccountTypes securityLevel);
 
         RealmMap _realms;
+        std::map<std::pair<uint32, AccountTypes>, std::shared_ptr<SerializedRealmList const>> _serializedRealmLists;
+        std::mutex _serializedRealmListsLock;
         uint32 _updateInterval;
         std::unique_ptr<Trinity::Asio::DeadlineTimer> _updateTimer;
         std::unique_ptr<Trinity::Asio::Resolver> _resolver;
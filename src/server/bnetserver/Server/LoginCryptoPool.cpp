@@ -0,0 +1,52 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LoginCryptoPool.h"
+#include "Log.h"
+#include <algorithm>
+
+Battlenet::LoginCryptoPool& Battlenet::LoginCryptoPool::Instance()
+{
+    static LoginCryptoPool instance;
+    return instance;
+}
+
+Battlenet::LoginCryptoPool::Statistics& Battlenet::LoginCryptoPool::GetStatistics()
+{
+    static Statistics statistics;
+    return statistics;
+}
+
+void Battlenet::LoginCryptoPool::Initialize(uint32 threadCount, uint32 maxQueuedJobs)
+{
+    if (!threadCount)
+        threadCount = 1;
+
+    _maxQueuedJobs = std::max(maxQueuedJobs, threadCount);
+    _pool = std::make_unique<Trinity::ThreadPool>(threadCount);
+
+    TC_LOG_INFO("server.bnetserver", "Started login crypto pool with %u threads and up to %u queued jobs.", threadCount, _maxQueuedJobs);
+}
+
+void Battlenet::LoginCryptoPool::Close()
+{
+    if (!_pool)
+        return;
+
+    _pool->Join();
+    _pool.reset();
+}
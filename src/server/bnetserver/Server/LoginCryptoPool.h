@@ -0,0 +1,84 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LoginCryptoPool_h__
+#define LoginCryptoPool_h__
+
+#include "Define.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <memory>
+
+namespace Battlenet
+{
+    /// Runs the SRP6 modular exponentiations of logging in sessions away from the network threads.
+    /// The number of queued jobs is bounded so a reconnect storm is turned away early instead of
+    /// building up an unbounded backlog that every client ends up timing out on.
+    class LoginCryptoPool
+    {
+        LoginCryptoPool() : _maxQueuedJobs(0), _queuedJobs(0) { }
+        ~LoginCryptoPool() { }
+
+    public:
+        struct Statistics
+        {
+            std::atomic<uint64> Completed;
+            std::atomic<uint64> Rejected;
+        };
+
+        static LoginCryptoPool& Instance();
+
+        void Initialize(uint32 threadCount, uint32 maxQueuedJobs);
+        void Close();
+
+        /// Queues work on the pool, returns false without running it when the queue is full
+        template<typename Work>
+        bool PostWork(Work&& work)
+        {
+            if (!_pool)
+                return false;
+
+            if (_queuedJobs.fetch_add(1) >= _maxQueuedJobs)
+            {
+                --_queuedJobs;
+                ++GetStatistics().Rejected;
+                return false;
+            }
+
+            _pool->PostWork([this, work = std::forward<Work>(work)]() mutable
+            {
+                work();
+                --_queuedJobs;
+                ++GetStatistics().Completed;
+            });
+            return true;
+        }
+
+        uint32 GetQueuedJobs() const { return _queuedJobs; }
+
+        static Statistics& GetStatistics();
+
+    private:
+        std::unique_ptr<Trinity::ThreadPool> _pool;
+        uint32 _maxQueuedJobs;
+        std::atomic<uint32> _queuedJobs;
+    };
+}
+
+#define sLoginCryptoPool Battlenet::LoginCryptoPool::Instance()
+
+#endif // LoginCryptoPool_h__
@@ -22,8 +22,10 @@
 #include "Database/DatabaseEnv.h"
 #include "HmacHash.h"
 #include "Log.h"
+#include "LoginCryptoPool.h"
 #include "PacketManager.h"
 #include "QueryCallback.h"
+#include "QueryHolder.h"
 #include "Random.h"
 #include "Realm.h"
 #include "SessionManager.h"
@@ -40,6 +42,49 @@ Battlenet::Session::ModuleHandler const Battlenet::Session::ModuleHandlers[MODUL
     &Battlenet::Session::HandleResumeModule,
 };
 
+namespace
+{
+    class LogonRequestQueryHolder : public LoginDatabaseQueryHolder
+    {
+    public:
+        enum
+        {
+            ACCOUNT_INFO,
+            CHARACTER_COUNTS,
+
+            MAX_QUERIES
+        };
+
+        LogonRequestQueryHolder() { SetSize(MAX_QUERIES); }
+    };
+
+    struct SrpChallengeResult
+    {
+        BigNumber v;
+        BigNumber B;
+    };
+
+    struct SrpProofResult
+    {
+        SrpProofResult() : Valid(false) { }
+
+        bool Valid;
+        BigNumber K;
+        BigNumber M;
+    };
+}
+
+bool Battlenet::LoginCryptoCallback::InvokeIfReady()
+{
+    if (_future.valid() && _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        _callback();
+        return true;
+    }
+
+    return false;
+}
+
 void Battlenet::AccountInfo::LoadResult(Field* fields)
 {
     // ba.id, ba.email, ba.locked, ba.lock_country, ba.last_ip, ba.failed_logins, bab.unbandate > UNIX_TIMESTAMP() OR bab.unbandate = bab.bandate, bab.unbandate = bab.bandate FROM battlenet_accounts ba LEFT JOIN battlenet_account_bans bab WHERE email = ?
@@ -71,7 +116,7 @@ void Battlenet::GameAccountInfo::LoadResult(Field* fields)
 
 Battlenet::Session::Session(tcp::socket&& socket) : Socket(std::move(socket)), _accountInfo(new AccountInfo()), _gameAccountInfo(nullptr), _locale(),
     _os(), _build(0), _ipCountry(), I(), s(), v(), b(), B(), K(),
-    _reconnectProof(), _crypt(), _authed(false), _subscribedToRealmListUpdates(false), _toonOnline(false)
+    _reconnectProof(), _crypt(), _authed(false), _subscribedToRealmListUpdates(false), _toonOnline(false), _characterCountsPrefetched(false)
 {
     static uint8 const N_Bytes[] =
     {
@@ -102,26 +147,25 @@ Battlenet::Session::~Session()
     delete _accountInfo;
 }
 
-void Battlenet::Session::_SetVSFields(std::string const& pstr)
+bool Battlenet::Session::PostCryptoWork(std::function<void()>&& work, std::function<void()>&& callback)
 {
-    s.SetRand(uint32(BufferSizes::SRP_6_S) * 8);
+    std::shared_ptr<std::promise<void>> done = std::make_shared<std::promise<void>>();
+    std::future<void> future = done->get_future();
 
-    BigNumber p;
-    p.SetHexStr(pstr.c_str());
-
-    SHA256Hash sha;
-    sha.UpdateBigNumbers(&s, &p, nullptr);
-    sha.Finalize();
-    BigNumber x;
-    x.SetBinary(sha.GetDigest(), sha.GetLength());
-    v = g.ModExp(x, N);
+    // the session is woken up once the work is done, as long as it is still alive
+    if (!sLoginCryptoPool.PostWork([work = std::move(work), done, weakSelf = std::weak_ptr<Session>(shared_from_this())]()
+    {
+        work();
+        done->set_value();
 
-    LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_VS_FIELDS);
-    stmt->setString(0, v.AsHexStr());
-    stmt->setString(1, s.AsHexStr());
-    stmt->setString(2, _accountInfo->Login);
+        if (std::shared_ptr<Session> self = weakSelf.lock())
+            self->RequestUpdate();
+    }))
+        return false;
 
-    LoginDatabase.Execute(stmt);
+    _cryptoProcessor.AddCallback(LoginCryptoCallback(std::move(future), std::move(callback)));
+    RequestUpdate();
+    return true;
 }
 
 void Battlenet::Session::LogUnhandledPacket(PacketHeader const& header)
@@ -196,14 +240,28 @@ void Battlenet::Session::HandleLogonRequest(Authentication::LogonRequest const&
     _os = logonRequest.Platform;
 
     Utf8ToUpperOnlyLatin(login);
+
+    // Character counts are needed by the first realm list subscription, fetch them in the same round trip
+    std::shared_ptr<LogonRequestQueryHolder> holder = std::make_shared<LogonRequestQueryHolder>();
+
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_ACCOUNT_INFO);
     stmt->setString(0, login);
+    holder->SetPreparedQuery(LogonRequestQueryHolder::ACCOUNT_INFO, stmt);
+
+    stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_EMAIL);
+    stmt->setString(0, login);
+    holder->SetPreparedQuery(LogonRequestQueryHolder::CHARACTER_COUNTS, stmt);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&Battlenet::Session::HandleLogonRequestCallback, this, std::placeholders::_1)));
+    _queryHolderProcessor.AddCallback(LoginDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    {
+        HandleLogonRequestCallback(holder);
+    });
+    RequestUpdate();
 }
 
-void Battlenet::Session::HandleLogonRequestCallback(PreparedQueryResult result)
+void Battlenet::Session::HandleLogonRequestCallback(SQLQueryHolderBase const& holder)
 {
+    PreparedQueryResult result = holder.GetPreparedResult(LogonRequestQueryHolder::ACCOUNT_INFO);
     if (!result)
     {
         Authentication::LogonResponse* logonResponse = new Authentication::LogonResponse();
@@ -228,6 +286,21 @@ void Battlenet::Session::HandleLogonRequestCallback(PreparedQueryResult result)
 
     } while (result->NextRow());
 
+    if (PreparedQueryResult characterCounts = holder.GetPreparedResult(LogonRequestQueryHolder::CHARACTER_COUNTS))
+    {
+        do
+        {
+            Field* countFields = characterCounts->Fetch();
+            uint32 gameAccountId = countFields[0].GetUInt32();
+            auto gameAccount = std::find_if(_gameAccounts.begin(), _gameAccounts.end(), [gameAccountId](GameAccountInfo const& info) { return info.Id == gameAccountId; });
+            if (gameAccount != _gameAccounts.end())
+                gameAccount->CharacterCounts.push_back({ Battlenet::RealmHandle(countFields[3].GetUInt8(), countFields[4].GetUInt8(), countFields[2].GetUInt32()), countFields[1].GetUInt8() });
+
+        } while (characterCounts->NextRow());
+    }
+
+    _characterCountsPrefetched = true;
+
     std::string ip_address = GetRemoteIpAddress().to_string();
     // If the IP is 'locked', check that the player comes indeed from the correct IP address
     if (_accountInfo->IsLockedToIP)
@@ -287,11 +360,9 @@ void Battlenet::Session::HandleLogonRequestCallback(PreparedQueryResult result)
 
     I.SetBinary(sha.GetDigest(), sha.GetLength());
 
-    ModuleInfo* password = sModuleMgr->CreateModule(_os, "Password");
-    ModuleInfo* thumbprint = sModuleMgr->CreateModule(_os, "Thumbprint");
-
-    if (databaseV.size() != size_t(BufferSizes::SRP_6_V) * 2 || databaseS.size() != size_t(BufferSizes::SRP_6_S) * 2)
-        _SetVSFields(pStr);
+    bool updateVerifier = databaseV.size() != size_t(BufferSizes::SRP_6_V) * 2 || databaseS.size() != size_t(BufferSizes::SRP_6_S) * 2;
+    if (updateVerifier)
+        s.SetRand(uint32(BufferSizes::SRP_6_S) * 8);
     else
     {
         s.SetHexStr(databaseS.c_str());
@@ -299,7 +370,57 @@ void Battlenet::Session::HandleLogonRequestCallback(PreparedQueryResult result)
     }
 
     b.SetRand(128 * 8);
-    B = ((v * k) + g.ModExp(b, N)) % N;
+
+    // Verifier generation and the server ephemeral are modular exponentiations, keep them off the network thread
+    std::shared_ptr<SrpChallengeResult> challenge = std::make_shared<SrpChallengeResult>();
+    bool queued = PostCryptoWork([challenge, updateVerifier, pStr, N = N, g = g, k = k, s = s, v = v, b = b]() mutable
+    {
+        if (updateVerifier)
+        {
+            BigNumber p;
+            p.SetHexStr(pStr.c_str());
+
+            SHA256Hash sha;
+            sha.UpdateBigNumbers(&s, &p, nullptr);
+            sha.Finalize();
+            BigNumber x;
+            x.SetBinary(sha.GetDigest(), sha.GetLength());
+            v = g.ModExp(x, N);
+        }
+
+        challenge->v = v;
+        challenge->B = ((v * k) + g.ModExp(b, N)) % N;
+    }, [this, challenge, updateVerifier]()
+    {
+        v = challenge->v;
+        B = challenge->B;
+
+        if (updateVerifier)
+        {
+            LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_VS_FIELDS);
+            stmt->setString(0, v.AsHexStr());
+            stmt->setString(1, s.AsHexStr());
+            stmt->setString(2, _accountInfo->Login);
+            LoginDatabase.Execute(stmt);
+        }
+
+        SendPasswordChallenge();
+    });
+
+    if (!queued)
+    {
+        Authentication::LogonResponse* logonResponse = new Authentication::LogonResponse();
+        logonResponse->SetAuthResult(LOGIN_SERVER_BUSY);
+        AsyncWrite(logonResponse);
+        TC_LOG_DEBUG("session", "[Battlenet::LogonRequest] %s rejected, login crypto pool is full", GetClientInfo().c_str());
+    }
+}
+
+void Battlenet::Session::SendPasswordChallenge()
+{
+    ModuleInfo* password = sModuleMgr->CreateModule(_os, "Password");
+    ModuleInfo* thumbprint = sModuleMgr->CreateModule(_os, "Thumbprint");
+
     BigNumber unk;
     unk.SetRand(128 * 8);
 
@@ -339,6 +460,7 @@ void Battlenet::Session::HandleResumeRequest(Authentication::ResumeRequest const
     stmt->setString(1, resumeRequest.GameAccountName);
 
     _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&Battlenet::Session::HandleResumeRequestCallback, this, std::placeholders::_1)));
+    RequestUpdate();
 }
 
 void Battlenet::Session::HandleResumeRequestCallback(PreparedQueryResult result)
@@ -399,6 +521,10 @@ void Battlenet::Session::HandleProofResponse(Authentication::ProofResponse const
         _modulesWaitingForData.pop();
     }
 
+    // Password proof is verified on the login crypto pool, HandlePasswordModuleCallback sends the response
+    if (!response && !_cryptoProcessor.Empty())
+        return;
+
     if (!response)
     {
         response = new Authentication::LogonResponse();
@@ -434,10 +560,24 @@ void Battlenet::Session::HandleConnectionClosing(Connection::ConnectionClosing c
 
 void Battlenet::Session::HandleListSubscribeRequest(WoWRealm::ListSubscribeRequest const& /*listSubscribeRequest*/)
 {
+    // Counts loaded with the logon request are only fresh for the first subscription
+    if (_characterCountsPrefetched)
+    {
+        _characterCountsPrefetched = false;
+
+        WoWRealm::ListSubscribeResponse* listSubscribeResponse = new WoWRealm::ListSubscribeResponse();
+        listSubscribeResponse->CharacterCounts = _gameAccountInfo->CharacterCounts;
+        AsyncWrite(listSubscribeResponse);
+
+        SendRealmList();
+        return;
+    }
+
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_BNET_CHARACTER_COUNTS);
     stmt->setUInt32(0, _gameAccountInfo->Id);
 
     _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&Battlenet::Session::HandleListSubscribeRequestCallback, this, std::placeholders::_1)));
+    RequestUpdate();
 }
 
 void Battlenet::Session::HandleListSubscribeRequestCallback(PreparedQueryResult result)
@@ -455,8 +595,12 @@ void Battlenet::Session::HandleListSubscribeRequestCallback(PreparedQueryResult
 
     AsyncWrite(listSubscribeResponse);
 
-    for (auto const& i : sBNetRealmList->GetRealms())
-        AsyncWrite(BuildListUpdate(&i.second));
+    SendRealmList();
+}
+
+void Battlenet::Session::SendRealmList()
+{
+    UpdateRealms(*sBNetRealmList->GetSerializedRealmList(_build, _gameAccountInfo->SecurityLevel));
 
     AsyncWrite(new WoWRealm::ListComplete());
 
@@ -608,6 +752,7 @@ void Battlenet::Session::Start()
     stmt->setString(0, ip_address);
 
     _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&Battlenet::Session::CheckIpCallback, this, std::placeholders::_1)));
+    RequestUpdate();
 }
 
 void Battlenet::Session::CheckIpCallback(PreparedQueryResult result)
@@ -670,6 +815,8 @@ bool Battlenet::Session::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    _queryHolderProcessor.ProcessReadyCallbacks();
+    _cryptoProcessor.ProcessReadyCallbacks();
 
     return true;
 }
@@ -687,11 +834,29 @@ void Battlenet::Session::AsyncWrite(ServerPacket* packet)
     packet->Write();
 
     EncryptableBuffer* buffer = new EncryptableBuffer();
+    buffer->Buffer.Resize(packet->GetSize());
     buffer->Buffer.Write(packet->GetData(), packet->GetSize());
     buffer->Encrypt = _crypt.IsInitialized();
     delete packet;
 
     _bufferQueue.Enqueue(buffer);
+    RequestUpdate();
+}
+
+void Battlenet::Session::AsyncWrite(std::vector<uint8> const& serializedPackets)
+{
+    if (!IsOpen() || serializedPackets.empty())
+        return;
+
+    TC_LOG_DEBUG("session.packets", "%s Sending %u bytes of pre-serialized packets", GetClientInfo().c_str(), uint32(serializedPackets.size()));
+
+    EncryptableBuffer* buffer = new EncryptableBuffer();
+    buffer->Buffer.Resize(serializedPackets.size());
+    buffer->Buffer.Write(serializedPackets.data(), serializedPackets.size());
+    buffer->Encrypt = _crypt.IsInitialized();
+
+    _bufferQueue.Enqueue(buffer);
+    RequestUpdate();
 }
 
 inline void ReplaceResponse(Battlenet::ServerPacket** oldResponse, Battlenet::ServerPacket* newResponse)
@@ -733,71 +898,103 @@ bool Battlenet::Session::HandlePasswordModule(BitStream* dataStream, ServerPacke
         return false;
     }
 
-    SHA256Hash sha;
-    sha.UpdateBigNumbers(&A, &B, nullptr);
-    sha.Finalize();
+    // Both the premaster secret and the proofs are computed on the login crypto pool
+    std::shared_ptr<SrpProofResult> proof = std::make_shared<SrpProofResult>();
+    bool queued = PostCryptoWork([proof, N = N, g = g, I = I, s = s, v = v, b = b, B = B, A, clientM1]() mutable
+    {
+        SHA256Hash sha;
+        sha.UpdateBigNumbers(&A, &B, nullptr);
+        sha.Finalize();
 
-    BigNumber u;
-    u.SetBinary(sha.GetDigest(), sha.GetLength());
+        BigNumber u;
+        u.SetBinary(sha.GetDigest(), sha.GetLength());
 
-    BigNumber S = ((A * v.ModExp(u, N)) % N).ModExp(b, N);
+        BigNumber S = ((A * v.ModExp(u, N)) % N).ModExp(b, N);
 
-    uint8 S_bytes[128];
-    memcpy(S_bytes, S.AsByteArray(128).get(), 128);
+        uint8 S_bytes[128];
+        memcpy(S_bytes, S.AsByteArray(128).get(), 128);
 
-    uint8 part1[64];
-    uint8 part2[64];
+        uint8 part1[64];
+        uint8 part2[64];
 
-    for (int i = 0; i < 64; ++i)
-    {
-        part1[i] = S_bytes[i * 2];
-        part2[i] = S_bytes[i * 2 + 1];
-    }
+        for (int i = 0; i < 64; ++i)
+        {
+            part1[i] = S_bytes[i * 2];
+            part2[i] = S_bytes[i * 2 + 1];
+        }
 
-    SHA256Hash part1sha, part2sha;
-    part1sha.UpdateData(part1, 64);
-    part1sha.Finalize();
-    part2sha.UpdateData(part2, 64);
-    part2sha.Finalize();
+        SHA256Hash part1sha, part2sha;
+        part1sha.UpdateData(part1, 64);
+        part1sha.Finalize();
+        part2sha.UpdateData(part2, 64);
+        part2sha.Finalize();
 
-    uint8 sessionKey[SHA256_DIGEST_LENGTH * 2];
-    for (int i = 0; i < SHA256_DIGEST_LENGTH; ++i)
-    {
-        sessionKey[i * 2] = part1sha.GetDigest()[i];
-        sessionKey[i * 2 + 1] = part2sha.GetDigest()[i];
-    }
+        uint8 sessionKey[SHA256_DIGEST_LENGTH * 2];
+        for (int i = 0; i < SHA256_DIGEST_LENGTH; ++i)
+        {
+            sessionKey[i * 2] = part1sha.GetDigest()[i];
+            sessionKey[i * 2 + 1] = part2sha.GetDigest()[i];
+        }
 
-    K.SetBinary(sessionKey, SHA256_DIGEST_LENGTH * 2);
+        proof->K.SetBinary(sessionKey, SHA256_DIGEST_LENGTH * 2);
 
-    BigNumber M1;
+        BigNumber M1;
 
-    uint8 hash[SHA256_DIGEST_LENGTH];
-    sha.Initialize();
-    sha.UpdateBigNumbers(&N, nullptr);
-    sha.Finalize();
-    memcpy(hash, sha.GetDigest(), sha.GetLength());
+        uint8 hash[SHA256_DIGEST_LENGTH];
+        sha.Initialize();
+        sha.UpdateBigNumbers(&N, nullptr);
+        sha.Finalize();
+        memcpy(hash, sha.GetDigest(), sha.GetLength());
 
-    sha.Initialize();
-    sha.UpdateBigNumbers(&g, nullptr);
-    sha.Finalize();
+        sha.Initialize();
+        sha.UpdateBigNumbers(&g, nullptr);
+        sha.Finalize();
 
-    for (int i = 0; i < sha.GetLength(); ++i)
-        hash[i] ^= sha.GetDigest()[i];
+        for (int i = 0; i < sha.GetLength(); ++i)
+            hash[i] ^= sha.GetDigest()[i];
 
-    SHA256Hash shaI;
-    shaI.UpdateData(ByteArrayToHexStr(I.AsByteArray().get(), 32));
-    shaI.Finalize();
+        SHA256Hash shaI;
+        shaI.UpdateData(ByteArrayToHexStr(I.AsByteArray().get(), 32));
+        shaI.Finalize();
 
-    // Concat all variables for M1 hash
-    sha.Initialize();
-    sha.UpdateData(hash, SHA256_DIGEST_LENGTH);
-    sha.UpdateData(shaI.GetDigest(), shaI.GetLength());
-    sha.UpdateBigNumbers(&s, &A, &B, &K, nullptr);
-    sha.Finalize();
+        // Concat all variables for M1 hash
+        sha.Initialize();
+        sha.UpdateData(hash, SHA256_DIGEST_LENGTH);
+        sha.UpdateData(shaI.GetDigest(), shaI.GetLength());
+        sha.UpdateBigNumbers(&s, &A, &B, &proof->K, nullptr);
+        sha.Finalize();
 
-    M1.SetBinary(sha.GetDigest(), sha.GetLength());
+        M1.SetBinary(sha.GetDigest(), sha.GetLength());
 
-    if (memcmp(M1.AsByteArray().get(), clientM1.AsByteArray().get(), 32))
+        if (memcmp(M1.AsByteArray().get(), clientM1.AsByteArray().get(), 32))
+            return;
+
+        sha.Initialize();
+        sha.UpdateBigNumbers(&A, &M1, &proof->K, nullptr);
+        sha.Finalize();
+        proof->M.SetBinary(sha.GetDigest(), sha.GetLength());
+        proof->Valid = true;
+    }, [this, proof]()
+    {
+        K = proof->K;
+        HandlePasswordModuleCallback(proof->Valid, proof->M);
+    });
+
+    if (!queued)
+    {
+        Authentication::LogonResponse* logonResponse = new Authentication::LogonResponse();
+        logonResponse->SetAuthResult(LOGIN_SERVER_BUSY);
+        ReplaceResponse(response, logonResponse);
+        TC_LOG_DEBUG("session", "[Battlenet::Password] %s rejected, login crypto pool is full", GetClientInfo().c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void Battlenet::Session::HandlePasswordModuleCallback(bool proofValid, BigNumber M)
+{
+    if (!proofValid)
     {
         LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_BNET_FAILED_LOGINS);
         stmt->setString(0, _accountInfo->Login);
@@ -805,26 +1002,20 @@ bool Battlenet::Session::HandlePasswordModule(BitStream* dataStream, ServerPacke
 
         Authentication::LogonResponse* logonResponse = new Authentication::LogonResponse();
         logonResponse->SetAuthResult(AUTH_UNKNOWN_ACCOUNT);
-        ReplaceResponse(response, logonResponse);
+        AsyncWrite(logonResponse);
         TC_LOG_DEBUG("session", "[Battlenet::Password] %s attempted to log in with invalid password!", GetClientInfo().c_str());
-        return false;
+        return;
     }
 
     if (_gameAccounts.empty())
     {
         Authentication::LogonResponse* logonResponse = new Authentication::LogonResponse();
         logonResponse->SetAuthResult(LOGIN_NO_GAME_ACCOUNT);
-        ReplaceResponse(response, logonResponse);
+        AsyncWrite(logonResponse);
         TC_LOG_DEBUG("session", "[Battlenet::Password] %s does not have any linked game accounts!", GetClientInfo().c_str());
-        return false;
+        return;
     }
 
-    BigNumber M;
-    sha.Initialize();
-    sha.UpdateBigNumbers(&A, &M1, &K, nullptr);
-    sha.Finalize();
-    M.SetBinary(sha.GetDigest(), sha.GetLength());
-
     BigNumber serverProof;
     serverProof.SetRand(128 * 8); // just send garbage, server signature check is patched out in client
 
@@ -881,16 +1072,15 @@ bool Battlenet::Session::HandlePasswordModule(BitStream* dataStream, ServerPacke
                 TC_LOG_DEBUG("session", "'%s:%d' [Battlenet::Password] Temporarily banned account %s tried to login!", GetRemoteIpAddress().to_string().c_str(), GetRemotePort(), _accountInfo->Login.c_str());
             }
 
-            ReplaceResponse(response, logonResponse);
-            return false;
+            AsyncWrite(logonResponse);
+            return;
         }
 
         proofRequest->Modules.push_back(sModuleMgr->CreateModule(_os, "RiskFingerprint"));
         _modulesWaitingForData.push(MODULE_RISK_FINGERPRINT);
     }
 
-    ReplaceResponse(response, proofRequest);
-    return true;
+    AsyncWrite(proofRequest);
 }
 
 bool Battlenet::Session::HandleSelectGameAccountModule(BitStream* dataStream, ServerPacket** response)
@@ -1089,25 +1279,25 @@ bool Battlenet::Session::UnhandledModule(BitStream* /*dataStream*/, ServerPacket
     return false;
 }
 
-void Battlenet::Session::UpdateRealms(std::vector<Realm const*>& realms, std::vector<Battlenet::RealmHandle>& deletedRealms)
+void Battlenet::Session::UpdateRealms(BNetRealmList::SerializedRealmList const& updates)
 {
-    for (Realm const* realm : realms)
-        AsyncWrite(BuildListUpdate(realm));
+    AsyncWrite(updates.Packets);
 
-    for (Battlenet::RealmHandle& deleted : deletedRealms)
-    {
-        WoWRealm::ListUpdate* listUpdate = new WoWRealm::ListUpdate();
-        listUpdate->UpdateState = WoWRealm::ListUpdate::DELETED;
-        listUpdate->Id = deleted;
-        AsyncWrite(listUpdate);
-    }
+    for (Battlenet::RealmHandle const& id : updates.ClientSpecificRealms)
+        if (Realm const* realm = sBNetRealmList->GetRealm(id))
+            AsyncWrite(BuildListUpdate(realm));
 }
 
 Battlenet::WoWRealm::ListUpdate* Battlenet::Session::BuildListUpdate(Realm const* realm) const
+{
+    return BuildListUpdate(realm, _build, _gameAccountInfo->SecurityLevel, GetRemoteIpAddress());
+}
+
+Battlenet::WoWRealm::ListUpdate* Battlenet::Session::BuildListUpdate(Realm const* realm, uint32 build, AccountTypes securityLevel, boost::asio::ip::address const& clientAddress)
 {
     uint32 flag = realm->Flags & ~REALM_FLAG_SPECIFYBUILD;
     RealmBuildInfo const* buildInfo = AuthHelper::GetBuildInfo(realm->Build);
-    if (realm->Build != _build)
+    if (realm->Build != build)
     {
         flag |= REALM_FLAG_VERSION_MISMATCH;
         if (buildInfo)
@@ -1117,7 +1307,7 @@ Battlenet::WoWRealm::ListUpdate* Battlenet::Session::BuildListUpdate(Realm const
     WoWRealm::ListUpdate* listUpdate = new WoWRealm::ListUpdate();
     listUpdate->Timezone = realm->Timezone;
     listUpdate->Population = realm->PopulationLevel;
-    listUpdate->Lock = (realm->AllowedSecurityLevel > _gameAccountInfo->SecurityLevel) ? 1 : 0;
+    listUpdate->Lock = (realm->AllowedSecurityLevel > securityLevel) ? 1 : 0;
     listUpdate->Type = realm->Type;
     listUpdate->Name = realm->Name;
 
@@ -1127,7 +1317,7 @@ Battlenet::WoWRealm::ListUpdate* Battlenet::Session::BuildListUpdate(Realm const
         version << buildInfo->MajorVersion << '.' << buildInfo->MinorVersion << '.' << buildInfo->BugfixVersion << '.' << buildInfo->Build;
 
         listUpdate->Version = version.str();
-        listUpdate->Address = realm->GetAddressForClient(GetRemoteIpAddress());
+        listUpdate->Address = realm->GetAddressForClient(clientAddress);
         listUpdate->Build = realm->Build;
     }
 
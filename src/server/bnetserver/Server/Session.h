@@ -19,13 +19,17 @@
 #define Session_h__
 
 #include "AsyncCallbackProcessor.h"
+#include "BNetRealmList.h"
 #include "Packets.h"
 #include "BattlenetPacketCrypt.h"
 #include "Socket.h"
 #include "BigNumber.h"
 #include "QueryResult.h"
 #include "MPSCQueue.h"
+#include <functional>
+#include <future>
 #include <memory>
+#include <queue>
 #include <boost/asio/ip/tcp.hpp>
 
 struct Realm;
@@ -79,6 +83,21 @@ namespace Battlenet
         bool IsBanned;
         bool IsPermanentlyBanned;
         AccountTypes SecurityLevel;
+        std::vector<WoWRealm::ListSubscribeResponse::CharacterCountEntry> CharacterCounts;
+    };
+
+    /// Completion of work queued on LoginCryptoPool, invoked on the network thread
+    class LoginCryptoCallback
+    {
+    public:
+        LoginCryptoCallback(std::future<void>&& future, std::function<void()>&& callback)
+            : _future(std::move(future)), _callback(std::move(callback)) { }
+
+        bool InvokeIfReady();
+
+    private:
+        std::future<void> _future;
+        std::function<void()> _callback;
     };
 
     class Session : public Socket<Session>
@@ -115,11 +134,14 @@ namespace Battlenet
 
         void Start() override;
         bool Update() override;
+        bool HasPendingCallbacks() const override { return !_queryProcessor.Empty() || !_queryHolderProcessor.Empty() || !_cryptoProcessor.Empty(); }
 
-        void UpdateRealms(std::vector<Realm const*>& realms, std::vector<RealmHandle>& deletedRealms);
+        void UpdateRealms(BNetRealmList::SerializedRealmList const& updates);
 
         uint32 GetAccountId() const { return _accountInfo->Id; }
         uint32 GetGameAccountId() const { return _gameAccountInfo->Id; }
+        uint32 GetBuild() const { return _build; }
+        AccountTypes GetSecurityLevel() const { return _gameAccountInfo->SecurityLevel; }
 
         bool IsToonOnline() const { return _toonOnline; }
         void SetToonOnline(bool online) { _toonOnline = online; }
@@ -127,27 +149,34 @@ namespace Battlenet
         bool IsSubscribedToRealmListUpdates() const { return _subscribedToRealmListUpdates; }
 
         void AsyncWrite(ServerPacket* packet);
+        void AsyncWrite(std::vector<uint8> const& serializedPackets);
+
+        static WoWRealm::ListUpdate* BuildListUpdate(Realm const* realm, uint32 build, AccountTypes securityLevel, boost::asio::ip::address const& clientAddress);
 
     protected:
         void ReadHandler() override;
 
     private:
-        void _SetVSFields(std::string const& rI);
 
         typedef bool(Session::*ModuleHandler)(BitStream* dataStream, ServerPacket** response);
         static ModuleHandler const ModuleHandlers[MODULE_COUNT];
 
         void CheckIpCallback(PreparedQueryResult result);
-        void HandleLogonRequestCallback(PreparedQueryResult result);
+        void HandleLogonRequestCallback(SQLQueryHolderBase const& holder);
+        void SendPasswordChallenge();
         void HandleResumeRequestCallback(PreparedQueryResult result);
         void HandleListSubscribeRequestCallback(PreparedQueryResult result);
 
         bool HandlePasswordModule(BitStream* dataStream, ServerPacket** response);
+        void HandlePasswordModuleCallback(bool proofValid, BigNumber M);
         bool HandleSelectGameAccountModule(BitStream* dataStream, ServerPacket** response);
         bool HandleRiskFingerprintModule(BitStream* dataStream, ServerPacket** response);
         bool HandleResumeModule(BitStream* dataStream, ServerPacket** response);
         bool UnhandledModule(BitStream* dataStream, ServerPacket** response);
 
+        bool PostCryptoWork(std::function<void()>&& work, std::function<void()>&& callback);
+
+        void SendRealmList();
         WoWRealm::ListUpdate* BuildListUpdate(Realm const* realm) const;
         std::string GetClientInfo() const;
 
@@ -189,8 +218,11 @@ namespace Battlenet
         bool _authed;
         bool _subscribedToRealmListUpdates;
         bool _toonOnline;
+        bool _characterCountsPrefetched;
 
         QueryCallbackProcessor _queryProcessor;
+        AsyncCallbackProcessor<SQLQueryHolderCallback> _queryHolderProcessor;
+        AsyncCallbackProcessor<LoginCryptoCallback> _cryptoProcessor;
     };
 
 }
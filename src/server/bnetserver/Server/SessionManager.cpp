@@ -20,12 +20,14 @@
 #include "Hash.h"
 #include <boost/thread/locks.hpp>
 #include <boost/thread/shared_mutex.hpp>
+#include <atomic>
 
 namespace
 {
     std::unordered_map<std::pair<uint32 /*accountId*/, uint32 /*gameAccountId*/>, Battlenet::Session*> _sessions;
     std::unordered_map<uint32, std::list<Battlenet::Session*>> _sessionsByAccountId;
     boost::shared_mutex _sessionMutex;
+    std::atomic<uint64> _loginCount(0);
 }
 
 Battlenet::SessionManager::SessionManager() : SocketMgr<Session>()
@@ -67,6 +69,7 @@ void Battlenet::SessionManager::AddSession(Session* session)
     std::unique_lock<boost::shared_mutex> lock(_sessionMutex);
     _sessions[{ session->GetAccountId(), session->GetGameAccountId() }] = session;
     _sessionsByAccountId[session->GetAccountId()].push_back(session);
+    ++_loginCount;
 }
 
 void Battlenet::SessionManager::RemoveSession(Session* session)
@@ -98,3 +101,8 @@ void Battlenet::SessionManager::LockedForEach(std::function<void(Session*)>&& it
     for (auto const& pair : _sessions)
         iterator(pair.second);
 }
+
+uint64 Battlenet::SessionManager::GetLoginCount() const
+{
+    return _loginCount;
+}
@@ -42,6 +42,9 @@ namespace Battlenet
 
             void LockedForEach(std::function<void(Session*)>&& iterator) const;
 
+            /// Number of sessions that completed authentication since startup
+            uint64 GetLoginCount() const;
+
         protected:
             NetworkThread<Session>* CreateThreads() const override;
 
@@ -119,6 +119,7 @@ enum LoginDatabaseStatements : uint32
     LOGIN_UPD_BNET_FAILED_LOGINS,
     LOGIN_UPD_BNET_LAST_LOGIN_INFO,
     LOGIN_SEL_BNET_CHARACTER_COUNTS,
+    LOGIN_SEL_BNET_CHARACTER_COUNTS_BY_EMAIL,
     LOGIN_INS_BNET_ACCOUNT,
     LOGIN_SEL_BNET_ACCOUNT_EMAIL_BY_ID,
     LOGIN_SEL_BNET_ACCOUNT_ID_BY_EMAIL,
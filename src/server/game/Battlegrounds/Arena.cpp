@@ -208,7 +208,7 @@ void Arena::CheckWinConditions()
         EndBattleground(ALLIANCE);
 }
 
-void Arena::EndBattleground(uint32 winner)
+void Arena::EndBattlegroundImpl(uint32 winner)
 {
     // arena rating calculation
     if (isRated())
@@ -351,5 +351,5 @@ void Arena::EndBattleground(uint32 winner)
     }
 
     // end battleground
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
@@ -148,6 +148,8 @@ Battleground::Battleground()
     m_LevelMax          = 0;
     m_InBGFreeSlotQueue = false;
     m_SetDeleteThis     = false;
+    m_UpdatingInMapThread = false;
+    m_StartAnnouncementDeferred = false;
 
     m_MaxPlayersPerTeam = 0;
     m_MaxPlayers        = 0;
@@ -256,7 +258,9 @@ void Battleground::Update(uint32 diff)
             }
             break;
         case STATUS_IN_PROGRESS:
-            _ProcessOfflineQueue();
+            // removing players leaves their battleground group and may disband it
+            if (!m_UpdatingInMapThread)
+                _ProcessOfflineQueue();
             // after 47 minutes without one team losing, the arena closes with no winner and no rating change
             if (isArena())
             {
@@ -276,7 +280,8 @@ void Battleground::Update(uint32 diff)
             }
             break;
         case STATUS_WAIT_LEAVE:
-            _ProcessLeave(diff);
+            if (!m_UpdatingInMapThread)
+                _ProcessLeave(diff);
             break;
         default:
             break;
@@ -293,6 +298,42 @@ void Battleground::Update(uint32 diff)
     PostUpdateImpl(diff);
 }
 
+void Battleground::UpdateDeferred(uint32 diff)
+{
+    if (GetPlayersSize())
+    {
+        switch (GetStatus())
+        {
+            case STATUS_WAIT_JOIN:
+                // spawning the battleground, skipped by the map thread until done here
+                if (!(m_Events & BG_STARTING_EVENT_1))
+                    _ProcessJoin(0);
+                break;
+            case STATUS_IN_PROGRESS:
+                _ProcessOfflineQueue();
+                break;
+            case STATUS_WAIT_LEAVE:
+                _ProcessLeave(diff);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (m_StartAnnouncementDeferred)
+    {
+        m_StartAnnouncementDeferred = false;
+        _AnnounceStart();
+    }
+
+    if (m_DeferredWinner)
+    {
+        uint32 winner = *m_DeferredWinner;
+        m_DeferredWinner.reset();
+        EndBattleground(winner);
+    }
+}
+
 inline void Battleground::_CheckSafePositions(uint32 diff)
 {
     float maxDist = GetStartMaxDist();
@@ -493,6 +534,10 @@ inline void Battleground::_ProcessJoin(uint32 diff)
 
     if (!(m_Events & BG_STARTING_EVENT_1))
     {
+        // some battlegrounds spawn objects with global guid generators (transports), left to UpdateDeferred()
+        if (m_UpdatingInMapThread)
+            return;
+
         m_Events |= BG_STARTING_EVENT_1;
 
         if (!FindBgMap())
@@ -536,9 +581,10 @@ inline void Battleground::_ProcessJoin(uint32 diff)
 
         StartingEventOpenDoors();
 
-#ifdef ELUNA
-        sEluna->OnBGStart(this, GetTypeID(), GetInstanceID());
-#endif
+        if (m_UpdatingInMapThread)
+            m_StartAnnouncementDeferred = true;
+        else
+            _AnnounceStart();
 
         if (StartMessageIds[BG_STARTING_EVENT_FOURTH])
             SendBroadcastText(StartMessageIds[BG_STARTING_EVENT_FOURTH], CHAT_MSG_BG_SYSTEM_NEUTRAL);
@@ -596,9 +642,6 @@ inline void Battleground::_ProcessJoin(uint32 diff)
                     player->RemoveAurasDueToSpell(SPELL_PREPARATION);
                     player->ResetAllPowers();
                 }
-            // Announce BG starting
-            if (sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
-                sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName().c_str(), GetMinLevel(), GetMaxLevel());
         }
     }
 
@@ -606,6 +649,17 @@ inline void Battleground::_ProcessJoin(uint32 diff)
         SetRemainingTime(GetRemainingTime() - diff);
 }
 
+void Battleground::_AnnounceStart()
+{
+#ifdef ELUNA
+    sEluna->OnBGStart(this, GetTypeID(), GetInstanceID());
+#endif
+
+    // Announce BG starting
+    if (!isArena() && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
+        sWorld->SendWorldText(LANG_BG_STARTED_ANNOUNCE_WORLD, GetName().c_str(), GetMinLevel(), GetMaxLevel());
+}
+
 inline void Battleground::_ProcessLeave(uint32 diff)
 {
     // *********************************************************
@@ -764,6 +818,19 @@ void Battleground::UpdateWorldState(int32 worldStateId, int32 value, bool hidden
 }
 
 void Battleground::EndBattleground(uint32 winner)
+{
+    // the end of the match updates arena teams and guilds, left to UpdateDeferred() when called from a map thread
+    if (m_UpdatingInMapThread)
+    {
+        if (!m_DeferredWinner)
+            m_DeferredWinner = winner;
+        return;
+    }
+
+    EndBattlegroundImpl(winner);
+}
+
+void Battleground::EndBattlegroundImpl(uint32 winner)
 {
     RemoveFromBGFreeSlotQueue();
 
@@ -1257,7 +1324,7 @@ void Battleground::RemoveFromBGFreeSlotQueue()
 {
     if (m_InBGFreeSlotQueue)
     {
-        sBattlegroundMgr->RemoveFromBGFreeSlotQueue(m_TypeID, m_InstanceID);
+        sBattlegroundMgr->RemoveFromBGFreeSlotQueue(m_TypeID, GetBracketId(), m_InstanceID);
         m_InBGFreeSlotQueue = false;
     }
 }
@@ -21,6 +21,7 @@
 #include "ArenaScore.h"
 #include "DBCEnums.h"
 #include "ObjectGuid.h"
+#include "Optional.h"
 #include "Position.h"
 #include "SharedDefines.h"
 #include <map>
@@ -233,6 +234,12 @@ class TC_GAME_API Battleground
 
         void Update(uint32 diff);
 
+        // With Battleground.UpdateInMapThreads the battleground is updated together with its map in a map update thread.
+        // Meanwhile the work reaching state shared with other maps (groups, arena teams, guilds, world wide texts, global guid
+        // generators) is deferred, UpdateDeferred() then does it in the world thread once all maps are updated.
+        void SetUpdatingInMapThread(bool updatingInMapThread) { m_UpdatingInMapThread = updatingInMapThread; }
+        void UpdateDeferred(uint32 diff);
+
         virtual bool SetupBattleground()                    // must be implemented in BG subclass
         {
             return true;
@@ -369,7 +376,7 @@ class TC_GAME_API Battleground
         void RewardHonorToTeam(uint32 Honor, uint32 TeamID);
         void RewardReputationToTeam(uint32 faction_id, uint32 Reputation, uint32 TeamID);
         void UpdateWorldState(int32 worldStateId, int32 value, bool hidden = false);
-        virtual void EndBattleground(uint32 winner);
+        void EndBattleground(uint32 winner);
         void BlockMovement(Player* player);
 
         void SendMessageToAll(uint32 entry, ChatMsg type, Player const* source = nullptr);
@@ -492,6 +499,10 @@ class TC_GAME_API Battleground
         void _ProcessLeave(uint32 diff);
         void _ProcessJoin(uint32 diff);
         void _CheckSafePositions(uint32 diff);
+        void _AnnounceStart();
+
+        // BG subclass specific end of the match, called by EndBattleground() and must call the base implementation
+        virtual void EndBattlegroundImpl(uint32 winner);
 
         // Scorekeeping
         BattlegroundScoreMap PlayerScores;                // Player scores
@@ -540,6 +551,9 @@ class TC_GAME_API Battleground
         bool   m_IsRated;                                   // is this battle rated?
         bool   m_PrematureCountDown;
         uint32 m_PrematureCountDownTimer;
+        bool   m_UpdatingInMapThread;                       // see SetUpdatingInMapThread()
+        bool   m_StartAnnouncementDeferred;
+        Optional<uint32> m_DeferredWinner;                  // EndBattleground() called while updating in a map thread
         std::string m_Name;
         ObjectGuid m_Guid;
 
@@ -76,8 +76,9 @@ void BattlegroundMgr::DeleteAllBattlegrounds()
             delete data.m_Battlegrounds.begin()->second;
         data.m_Battlegrounds.clear();
 
-        while (!data.BGFreeSlotQueue.empty())
-            delete data.BGFreeSlotQueue.front();
+        for (BGFreeSlotQueueContainer& freeSlotQueue : data.BGFreeSlotQueue)
+            while (!freeSlotQueue.empty())
+                delete freeSlotQueue.front();
     }
 
     bgDataStore.clear();
@@ -92,6 +93,9 @@ BattlegroundMgr* BattlegroundMgr::instance()
 // used to update running battlegrounds, and delete finished ones
 void BattlegroundMgr::Update(uint32 diff)
 {
+    // battlegrounds with a map were already updated by it, in the map update threads
+    bool const updatedByMap = sWorld->getBoolConfig(CONFIG_BATTLEGROUND_UPDATE_IN_MAP_THREADS);
+
     for (BattlegroundDataContainer::iterator itr1 = bgDataStore.begin(); itr1 != bgDataStore.end(); ++itr1)
     {
         BattlegroundContainer& bgs = itr1->second.m_Battlegrounds;
@@ -102,7 +106,9 @@ void BattlegroundMgr::Update(uint32 diff)
             itrDelete = itr++;
             Battleground* bg = itrDelete->second;
 
-            bg->Update(diff);
+            if (!updatedByMap || !bg->FindBgMap())
+                bg->Update(diff);
+
             if (bg->ToBeDeleted())
             {
                 itrDelete->second = nullptr;
@@ -121,11 +127,14 @@ void BattlegroundMgr::Update(uint32 diff)
         m_BattlegroundQueues[qtype].UpdateEvents(diff);
 
     // update scheduled queues
-    if (!m_QueueUpdateScheduler.empty())
+    std::vector<uint64> scheduled;
     {
-        std::vector<uint64> scheduled;
+        std::lock_guard<std::mutex> lock(_battlegroundLock);
         std::swap(scheduled, m_QueueUpdateScheduler);
+    }
 
+    if (!scheduled.empty())
+    {
         for (uint8 i = 0; i < scheduled.size(); i++)
         {
             uint32 arenaMMRating = scheduled[i] >> 32;
@@ -1058,9 +1067,10 @@ void BattlegroundMgr::SetHolidayActive(uint32 battlegroundId)
 
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, @todo add mutex
     //we will use only 1 number created of bgTypeId and bracket_id
     uint64 const scheduleId = ((uint64)arenaMatchmakerRating << 32) | ((uint64)arenaType << 24) | ((uint64)bgQueueTypeId << 16) | ((uint64)bgTypeId << 8) | (uint64)bracket_id;
+
+    std::lock_guard<std::mutex> lock(_battlegroundLock);
     if (std::find(m_QueueUpdateScheduler.begin(), m_QueueUpdateScheduler.end(), scheduleId) == m_QueueUpdateScheduler.end())
         m_QueueUpdateScheduler.push_back(scheduleId);
 }
@@ -1210,19 +1220,21 @@ BattlegroundTypeId BattlegroundMgr::GetRandomBG(BattlegroundTypeId bgTypeId)
     return BATTLEGROUND_TYPE_NONE;
 }
 
-BGFreeSlotQueueContainer& BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundTypeId bgTypeId)
+BGFreeSlotQueueContainer& BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundTypeId bgTypeId, BattlegroundBracketId bracketId)
 {
-    return bgDataStore[bgTypeId].BGFreeSlotQueue;
+    return bgDataStore[bgTypeId].BGFreeSlotQueue[bracketId];
 }
 
 void BattlegroundMgr::AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId, Battleground* bg)
 {
-    bgDataStore[bgTypeId].BGFreeSlotQueue.push_front(bg);
+    std::lock_guard<std::mutex> lock(_battlegroundLock);
+    bgDataStore[bgTypeId].BGFreeSlotQueue[bg->GetBracketId()].push_front(bg);
 }
 
-void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, uint32 instanceId)
+void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, BattlegroundBracketId bracketId, uint32 instanceId)
 {
-    BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
+    std::lock_guard<std::mutex> lock(_battlegroundLock);
+    BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue[bracketId];
     for (BGFreeSlotQueueContainer::iterator itr = queues.begin(); itr != queues.end(); ++itr)
         if ((*itr)->GetInstanceID() == instanceId)
         {
@@ -22,6 +22,7 @@
 #include "DBCEnums.h"
 #include "Battleground.h"
 #include "BattlegroundQueue.h"
+#include <mutex>
 #include <unordered_map>
 
 struct BattlemasterListEntry;
@@ -35,7 +36,7 @@ struct BattlegroundData
 {
     BattlegroundContainer m_Battlegrounds;
     BattlegroundClientIdsContainer m_ClientBattlegroundIds[MAX_BATTLEGROUND_BRACKETS];
-    BGFreeSlotQueueContainer BGFreeSlotQueue;
+    BGFreeSlotQueueContainer BGFreeSlotQueue[MAX_BATTLEGROUND_BRACKETS];
 };
 
 struct BattlegroundTemplate
@@ -82,9 +83,10 @@ class TC_GAME_API BattlegroundMgr
 
         void AddBattleground(Battleground* bg);
         void RemoveBattleground(BattlegroundTypeId bgTypeId, uint32 instanceId);
+        // the free slot queues and the queue update scheduler are also reached from battlegrounds updated by their map
         void AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId, Battleground* bg);
-        void RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, uint32 instanceId);
-        BGFreeSlotQueueContainer& GetBGFreeSlotQueueStore(BattlegroundTypeId bgTypeId);
+        void RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, BattlegroundBracketId bracketId, uint32 instanceId);
+        BGFreeSlotQueueContainer& GetBGFreeSlotQueueStore(BattlegroundTypeId bgTypeId, BattlegroundBracketId bracketId);
 
         void LoadBattlegroundTemplates();
         void DeleteAllBattlegrounds();
@@ -137,6 +139,7 @@ class TC_GAME_API BattlegroundMgr
         BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES];
 
         std::vector<uint64> m_QueueUpdateScheduler;
+        std::mutex _battlegroundLock;
         uint32 m_NextRatedArenaUpdate;
         bool   m_ArenaTesting;
         bool   m_Testing;
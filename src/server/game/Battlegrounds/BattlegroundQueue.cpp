@@ -29,6 +29,9 @@
 #include "ObjectAccessor.h"
 #include "Player.h"
 #include "World.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
 
 /*********************************************************/
 /***            BATTLEGROUND QUEUE SYSTEM              ***/
@@ -36,6 +39,10 @@
 
 BattlegroundQueue::BattlegroundQueue()
 {
+    for (uint32 i = 0; i < MAX_BATTLEGROUND_BRACKETS; ++i)
+        for (uint32 j = 0; j < BG_QUEUE_GROUP_TYPES_COUNT; ++j)
+            m_WaitingPlayerCount[i][j] = 0;
+
     for (uint32 i = 0; i < BG_TEAMS_COUNT; ++i)
     {
         for (uint32 j = 0; j < MAX_BATTLEGROUND_BRACKETS; ++j)
@@ -125,6 +132,115 @@ bool BattlegroundQueue::SelectionPool::AddGroup(GroupQueueInfo* ginfo, uint32 de
     return false;
 }
 
+/*********************************************************/
+/***               ARENA RATING INDEX                  ***/
+/*********************************************************/
+
+void ArenaRatingIndex::Insert(GroupQueueInfo* ginfo)
+{
+    _buckets[ginfo->ArenaMatchmakerRating / BucketSize].push_back(ginfo);
+    _byJoinTime.emplace(ginfo->JoinTime, ginfo);
+}
+
+void ArenaRatingIndex::Remove(GroupQueueInfo* ginfo)
+{
+    auto bounds = _byJoinTime.equal_range(ginfo->JoinTime);
+    for (auto itr = bounds.first; itr != bounds.second; ++itr)
+    {
+        if (itr->second == ginfo)
+        {
+            _byJoinTime.erase(itr);
+            RemoveFromBucket(ginfo);
+            return;
+        }
+    }
+}
+
+void ArenaRatingIndex::RemoveFromBucket(GroupQueueInfo* ginfo)
+{
+    auto bucket = _buckets.find(ginfo->ArenaMatchmakerRating / BucketSize);
+    if (bucket == _buckets.end())
+        return;
+
+    auto itr = std::find(bucket->second.begin(), bucket->second.end(), ginfo);
+    if (itr != bucket->second.end())
+        bucket->second.erase(itr);
+
+    if (bucket->second.empty())
+        _buckets.erase(bucket);
+}
+
+GroupQueueInfo* ArenaRatingIndex::FindOpponent(GroupQueueInfo const* ginfo, uint32 maxRatingDifference) const
+{
+    uint32 const rating = ginfo->ArenaMatchmakerRating;
+    GroupQueueInfo* opponent = nullptr;
+    uint32 opponentDifference = maxRatingDifference;
+
+    auto checkBucket = [&](std::vector<GroupQueueInfo*> const& bucket)
+    {
+        for (GroupQueueInfo* other : bucket)
+        {
+            if (other == ginfo || other->ArenaTeamId == ginfo->ArenaTeamId)
+                continue;
+
+            uint32 const difference = other->ArenaMatchmakerRating > rating ? other->ArenaMatchmakerRating - rating : rating - other->ArenaMatchmakerRating;
+            // on a tie the team that joined first is kept
+            if (difference <= opponentDifference && (!opponent || difference < opponentDifference))
+            {
+                opponent = other;
+                opponentDifference = difference;
+            }
+        }
+    };
+
+    // walk the buckets outwards from the one of the team, until they are farther away than the closest opponent found so far
+    auto above = _buckets.lower_bound(rating / BucketSize);
+    for (auto itr = above; itr != _buckets.end(); ++itr)
+    {
+        uint32 const lowest = itr->first * BucketSize;
+        if (lowest > rating && lowest - rating > opponentDifference)
+            break;
+
+        checkBucket(itr->second);
+    }
+
+    for (auto itr = std::make_reverse_iterator(above); itr != _buckets.rend(); ++itr)
+    {
+        uint32 const highest = itr->first * BucketSize + BucketSize - 1;
+        if (rating - highest > opponentDifference)
+            break;
+
+        checkBucket(itr->second);
+    }
+
+    return opponent;
+}
+
+void ArenaRatingIndex::TakeMatches(uint32 maxRatingDifference, int32 discardTime, MatchContainer& matches)
+{
+    // teams that waited past the discard time come first, so once they are paired
+    // with anyone left, the remaining teams only have to look within the max rating difference
+    for (auto itr = _byJoinTime.begin(); itr != _byJoinTime.end();)
+    {
+        GroupQueueInfo* ginfo = itr->second;
+        GroupQueueInfo* opponent = FindOpponent(ginfo, (int32)ginfo->JoinTime < discardTime ? std::numeric_limits<uint32>::max() : maxRatingDifference);
+        if (!opponent)
+        {
+            ++itr;
+            continue;
+        }
+
+        itr = _byJoinTime.erase(itr);
+        RemoveFromBucket(ginfo);
+
+        if (itr != _byJoinTime.end() && itr->second == opponent)
+            ++itr;
+        Remove(opponent);
+
+        matches.emplace_back(ginfo, opponent);
+    }
+}
+
 /*********************************************************/
 /***               BATTLEGROUND QUEUES                 ***/
 /*********************************************************/
@@ -194,7 +310,12 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* grp, Battlegr
 
     //add GroupInfo to m_QueuedGroups
     {
-        m_QueuedGroups[bracketId][index].push_back(ginfo);
+        ginfo->BracketId = bracketId;
+        ginfo->QueueIndex = index;
+        ginfo->QueueItr = m_QueuedGroups[bracketId][index].insert(m_QueuedGroups[bracketId][index].end(), ginfo);
+        m_WaitingPlayerCount[bracketId][index] += ginfo->Players.size();
+        if (isRated && ArenaType)
+            m_RatedArenaTeams[bracketId].Insert(ginfo);
 
         //announce to world, this code needs mutex
         if (!isRated && !isPremade && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_ENABLE))
@@ -202,17 +323,10 @@ GroupQueueInfo* BattlegroundQueue::AddGroup(Player* leader, Group* grp, Battlegr
             if (Battleground* bg = sBattlegroundMgr->GetBattlegroundTemplate(ginfo->BgTypeId))
             {
                 uint32 MinPlayers = bg->GetMinPlayersPerTeam();
-                uint32 qHorde = 0;
-                uint32 qAlliance = 0;
+                uint32 qHorde = m_WaitingPlayerCount[bracketId][BG_QUEUE_NORMAL_HORDE];
+                uint32 qAlliance = m_WaitingPlayerCount[bracketId][BG_QUEUE_NORMAL_ALLIANCE];
                 uint32 q_min_level = bracketEntry->MinLevel;
                 uint32 q_max_level = bracketEntry->MaxLevel;
-                GroupsQueueType::const_iterator itr;
-                for (itr = m_QueuedGroups[bracketId][BG_QUEUE_NORMAL_ALLIANCE].begin(); itr != m_QueuedGroups[bracketId][BG_QUEUE_NORMAL_ALLIANCE].end(); ++itr)
-                    if (!(*itr)->IsInvitedToBGInstanceGUID)
-                        qAlliance += (*itr)->Players.size();
-                for (itr = m_QueuedGroups[bracketId][BG_QUEUE_NORMAL_HORDE].begin(); itr != m_QueuedGroups[bracketId][BG_QUEUE_NORMAL_HORDE].end(); ++itr)
-                    if (!(*itr)->IsInvitedToBGInstanceGUID)
-                        qHorde += (*itr)->Players.size();
 
                 // Show queue status to player only (when joining queue)
                 if (sWorld->getBoolConfig(CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_PLAYERONLY))
@@ -286,7 +400,6 @@ uint32 BattlegroundQueue::GetAverageQueueWaitTime(GroupQueueInfo* ginfo, Battleg
 //remove player from queue and from group info, if group info is empty then remove it too
 void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
 {
-    int32 bracket_id = -1;                                     // signed for proper for-loop finish
     QueuedPlayersMap::iterator itr;
 
     //remove player from map, if he's there
@@ -302,39 +415,7 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     }
 
     GroupQueueInfo* group = itr->second.GroupInfo;
-    GroupsQueueType::iterator group_itr;
-    // mostly people with the highest levels are in battlegrounds, thats why
-    // we count from MAX_BATTLEGROUND_QUEUES - 1 to 0
-
-    uint32 index = (group->Team == HORDE) ? BG_QUEUE_PREMADE_HORDE : BG_QUEUE_PREMADE_ALLIANCE;
-
-    for (int32 bracket_id_tmp = MAX_BATTLEGROUND_BRACKETS - 1; bracket_id_tmp >= 0 && bracket_id == -1; --bracket_id_tmp)
-    {
-        //we must check premade and normal team's queue - because when players from premade are joining bg,
-        //they leave groupinfo so we can't use its players size to find out index
-        for (uint32 j = index; j < BG_QUEUE_GROUP_TYPES_COUNT; j += BG_TEAMS_COUNT)
-        {
-            GroupsQueueType::iterator k = m_QueuedGroups[bracket_id_tmp][j].begin();
-            for (; k != m_QueuedGroups[bracket_id_tmp][j].end(); ++k)
-            {
-                if ((*k) == group)
-                {
-                    bracket_id = bracket_id_tmp;
-                    group_itr = k;
-                    //we must store index to be able to erase iterator
-                    index = j;
-                    break;
-                }
-            }
-        }
-    }
-
-    //player can't be in queue without group, but just in case
-    if (bracket_id == -1)
-    {
-        TC_LOG_ERROR("bg.battleground", "BattlegroundQueue: ERROR Cannot find groupinfo for %s", guid.ToString().c_str());
-        return;
-    }
+    BattlegroundBracketId bracket_id = group->BracketId;
     TC_LOG_DEBUG("bg.battleground", "BattlegroundQueue: Removing %s, from bracket_id %u", guid.ToString().c_str(), (uint32)bracket_id);
 
     // ALL variables are correctly set
@@ -345,7 +426,11 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove player queue info from group queue info
     std::map<ObjectGuid, PlayerQueueInfo*>::iterator pitr = group->Players.find(guid);
     if (pitr != group->Players.end())
+    {
         group->Players.erase(pitr);
+        if (!group->IsInvitedToBGInstanceGUID)
+            --m_WaitingPlayerCount[bracket_id][group->QueueIndex];
+    }
 
     // if invited to bg, and should decrease invited count, then do it
     if (decreaseInvitedCount && group->IsInvitedToBGInstanceGUID)
@@ -377,7 +462,9 @@ void BattlegroundQueue::RemovePlayer(ObjectGuid guid, bool decreaseInvitedCount)
     // remove group queue info if needed
     if (group->Players.empty())
     {
-        m_QueuedGroups[bracket_id][index].erase(group_itr);
+        m_QueuedGroups[bracket_id][group->QueueIndex].erase(group->QueueItr);
+        if (group->IsRated)
+            m_RatedArenaTeams[bracket_id].Remove(group);
         delete group;
         return;
     }
@@ -440,6 +527,7 @@ bool BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg,
         // not yet invited
         // set invitation
         ginfo->IsInvitedToBGInstanceGUID = bg->GetInstanceID();
+        m_WaitingPlayerCount[ginfo->BracketId][ginfo->QueueIndex] -= ginfo->Players.size();
         BattlegroundTypeId bgTypeId = bg->GetTypeID();
         BattlegroundQueueTypeId bgQueueTypeId = BattlegroundMgr::BGQueueTypeId(bgTypeId, bg->GetArenaType());
         BattlegroundBracketId bracket_id = bg->GetBracketId();
@@ -492,6 +580,21 @@ bool BattlegroundQueue::InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg,
     return false;
 }
 
+void BattlegroundQueue::MoveGroupToQueue(GroupQueueInfo* ginfo, uint32 index)
+{
+    GroupsQueueType& from = m_QueuedGroups[ginfo->BracketId][ginfo->QueueIndex];
+    GroupsQueueType& to = m_QueuedGroups[ginfo->BracketId][index];
+    to.splice(to.begin(), from, ginfo->QueueItr);
+
+    if (!ginfo->IsInvitedToBGInstanceGUID)
+    {
+        m_WaitingPlayerCount[ginfo->BracketId][ginfo->QueueIndex] -= ginfo->Players.size();
+        m_WaitingPlayerCount[ginfo->BracketId][index] += ginfo->Players.size();
+    }
+
+    ginfo->QueueIndex = index;
+}
+
 /*
 This function is inviting players to already running battlegrounds
 Invitation type is based on config file
@@ -605,7 +708,7 @@ void BattlegroundQueue::FillPlayersToBG(Battleground* bg, BattlegroundBracketId
 bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint32 MinPlayersPerTeam, uint32 MaxPlayersPerTeam)
 {
     //check match
-    if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty() && !m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
+    if (m_WaitingPlayerCount[bracket_id][BG_QUEUE_PREMADE_ALLIANCE] && m_WaitingPlayerCount[bracket_id][BG_QUEUE_PREMADE_HORDE])
     {
         //start premade match
         //if groups aren't invited
@@ -646,12 +749,11 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint
     {
         if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].empty())
         {
-            GroupsQueueType::iterator itr = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].begin();
-            if (!(*itr)->IsInvitedToBGInstanceGUID && ((*itr)->JoinTime < time_before || (*itr)->Players.size() < MinPlayersPerTeam))
+            GroupQueueInfo* ginfo = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].front();
+            if (!ginfo->IsInvitedToBGInstanceGUID && (ginfo->JoinTime < time_before || ginfo->Players.size() < MinPlayersPerTeam))
             {
                 //we must insert group to normal queue and erase pointer from premade queue
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + i].push_front((*itr));
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE + i].erase(itr);
+                MoveGroupToQueue(ginfo, BG_QUEUE_NORMAL_ALLIANCE + i);
             }
         }
     }
@@ -662,6 +764,11 @@ bool BattlegroundQueue::CheckPremadeMatch(BattlegroundBracketId bracket_id, uint
 // this method tries to create battleground or arena with MinPlayersPerTeam against MinPlayersPerTeam
 bool BattlegroundQueue::CheckNormalMatch(Battleground* /*bg_template*/, BattlegroundBracketId bracket_id, uint32 minPlayers, uint32 maxPlayers)
 {
+    // neither faction can fill a team, the selection below would not find one either (same faction skirmishes need a full team too)
+    if (m_WaitingPlayerCount[bracket_id][BG_QUEUE_NORMAL_ALLIANCE] < minPlayers && m_WaitingPlayerCount[bracket_id][BG_QUEUE_NORMAL_HORDE] < minPlayers
+        && !(sBattlegroundMgr->isTesting() && (m_WaitingPlayerCount[bracket_id][BG_QUEUE_NORMAL_ALLIANCE] || m_WaitingPlayerCount[bracket_id][BG_QUEUE_NORMAL_HORDE])))
+        return false;
+
     GroupsQueueType::const_iterator itr_team[BG_TEAMS_COUNT];
     for (uint32 i = 0; i < BG_TEAMS_COUNT; i++)
     {
@@ -721,12 +828,9 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     //store last ginfo pointer
     GroupQueueInfo* ginfo = m_SelectionPools[teamIndex].SelectedGroups.back();
     //set itr_team to group that was added to selection pool latest
-    GroupsQueueType::iterator itr_team = m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + teamIndex].begin();
-    for (; itr_team != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + teamIndex].end(); ++itr_team)
-        if (ginfo == *itr_team)
-            break;
-    if (itr_team == m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + teamIndex].end())
+    if (ginfo->QueueIndex != BG_QUEUE_NORMAL_ALLIANCE + teamIndex)
         return false;
+    GroupsQueueType::iterator itr_team = ginfo->QueueItr;
     GroupsQueueType::iterator itr_team2 = itr_team;
     ++itr_team2;
     //invite players to other selection pool
@@ -744,19 +848,8 @@ bool BattlegroundQueue::CheckSkirmishForSameFaction(BattlegroundBracketId bracke
     {
         //set correct team
         (*itr)->Team = otherTeamId;
-        //add team to other queue
-        m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + otherTeam].push_front(*itr);
-        //remove team from old queue
-        GroupsQueueType::iterator itr2 = itr_team;
-        ++itr2;
-        for (; itr2 != m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + teamIndex].end(); ++itr2)
-        {
-            if (*itr2 == *itr)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE + teamIndex].erase(itr2);
-                break;
-            }
-        }
+        //move team to other queue
+        MoveGroupToQueue(*itr, BG_QUEUE_NORMAL_ALLIANCE + otherTeam);
     }
     return true;
 }
@@ -771,18 +864,17 @@ this method is called when group is inserted, or player / group is removed from
 it must be called after fully adding the members of a group to ensure group joining
 should be called from Battleground::RemovePlayer function in some cases
 */
-void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, uint8 arenaType, bool isRated, uint32 arenaRating)
+void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id, uint8 arenaType, bool isRated, uint32 /*arenaRating*/)
 {
-    //if no players in queue - do nothing
-    if (m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty() &&
-        m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty() &&
-        m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_ALLIANCE].empty() &&
-        m_QueuedGroups[bracket_id][BG_QUEUE_NORMAL_HORDE].empty())
+    //if no players wait for an invitation - do nothing
+    if (!m_WaitingPlayerCount[bracket_id][BG_QUEUE_PREMADE_ALLIANCE] &&
+        !m_WaitingPlayerCount[bracket_id][BG_QUEUE_PREMADE_HORDE] &&
+        !m_WaitingPlayerCount[bracket_id][BG_QUEUE_NORMAL_ALLIANCE] &&
+        !m_WaitingPlayerCount[bracket_id][BG_QUEUE_NORMAL_HORDE])
         return;
 
     // battleground with free slot for player should be always in the beggining of the queue
-    // maybe it would be better to create bgfreeslotqueue for each bracket_id
-    BGFreeSlotQueueContainer& bgQueues = sBattlegroundMgr->GetBGFreeSlotQueueStore(bgTypeId);
+    BGFreeSlotQueueContainer& bgQueues = sBattlegroundMgr->GetBGFreeSlotQueueStore(bgTypeId, bracket_id);
     for (BGFreeSlotQueueContainer::iterator itr = bgQueues.begin(); itr != bgQueues.end();)
     {
         Battleground* bg = *itr; ++itr;
@@ -888,35 +980,6 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTyp
     }
     else if (bg_template->isArena())
     {
-        // found out the minimum and maximum ratings the newly added team should battle against
-        // arenaRating is the rating of the latest joined team, or 0
-        // 0 is on (automatic update call) and we must set it to team's with longest wait time
-        if (!arenaRating)
-        {
-            GroupQueueInfo* front1 = nullptr;
-            GroupQueueInfo* front2 = nullptr;
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].empty())
-            {
-                front1 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].front();
-                arenaRating = front1->ArenaMatchmakerRating;
-            }
-            if (!m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].empty())
-            {
-                front2 = m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].front();
-                arenaRating = front2->ArenaMatchmakerRating;
-            }
-            if (front1 && front2)
-            {
-                if (front1->JoinTime < front2->JoinTime)
-                    arenaRating = front1->ArenaMatchmakerRating;
-            }
-            else if (!front1 && !front2)
-                return; //queues are empty
-        }
-
-        //set rating range
-        uint32 arenaMinRating = (arenaRating <= sBattlegroundMgr->GetMaxRatingDifference()) ? 0 : arenaRating - sBattlegroundMgr->GetMaxRatingDifference();
-        uint32 arenaMaxRating = arenaRating + sBattlegroundMgr->GetMaxRatingDifference();
         // if max rating difference is set and the time past since server startup is greater than the rating discard time
         // (after what time the ratings aren't taken into account when making teams) then
         // the discard time is current_time - time_to_discard, teams that joined after that, will have their ratings taken into account
@@ -924,56 +987,25 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTyp
         // this has to be signed value - when the server starts, this value would be negative and thus overflow
         int32 discardTime = GameTime::GetGameTimeMS() - sBattlegroundMgr->GetRatingDiscardTimer();
 
-        // we need to find 2 teams which will play next game
-        GroupsQueueType::iterator itr_teams[BG_TEAMS_COUNT];
-        uint8 found = 0;
-        uint8 team = 0;
-
-        for (uint8 i = BG_QUEUE_PREMADE_ALLIANCE; i < BG_QUEUE_NORMAL_ALLIANCE; i++)
-        {
-            // take the group that joined first
-            GroupsQueueType::iterator itr2 = m_QueuedGroups[bracket_id][i].begin();
-            for (; itr2 != m_QueuedGroups[bracket_id][i].end(); ++itr2)
-            {
-                // if group match conditions, then add it to pool
-                if (!(*itr2)->IsInvitedToBGInstanceGUID
-                    && (((*itr2)->ArenaMatchmakerRating >= arenaMinRating && (*itr2)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr2)->JoinTime < discardTime))
-                {
-                    itr_teams[found++] = itr2;
-                    team = i;
-                    break;
-                }
-            }
-        }
-
-        if (!found)
-            return;
-
-        if (found == 1)
-        {
-            for (GroupsQueueType::iterator itr3 = itr_teams[0]; itr3 != m_QueuedGroups[bracket_id][team].end(); ++itr3)
-            {
-                if (!(*itr3)->IsInvitedToBGInstanceGUID
-                    && (((*itr3)->ArenaMatchmakerRating >= arenaMinRating && (*itr3)->ArenaMatchmakerRating <= arenaMaxRating)
-                        || (int32)(*itr3)->JoinTime < discardTime)
-                    && (*itr_teams[0])->ArenaTeamId != (*itr3)->ArenaTeamId)
-                {
-                    itr_teams[found++] = itr3;
-                    break;
-                }
-            }
-        }
+        // pair every team that has an opponent now, not only the one that joined or waited the longest
+        ArenaRatingIndex::MatchContainer matches;
+        m_RatedArenaTeams[bracket_id].TakeMatches(sBattlegroundMgr->GetMaxRatingDifference(), discardTime, matches);
 
-        //if we have 2 teams, then start new arena and invite players!
-        if (found == 2)
+        for (ArenaRatingIndex::MatchContainer::const_iterator itr = matches.begin(); itr != matches.end(); ++itr)
         {
-            GroupQueueInfo* aTeam = *itr_teams[TEAM_ALLIANCE];
-            GroupQueueInfo* hTeam = *itr_teams[TEAM_HORDE];
+            GroupQueueInfo* aTeam = itr->first;
+            GroupQueueInfo* hTeam = itr->second;
             Battleground* arena = sBattlegroundMgr->CreateNewBattleground(bgTypeId, bracketEntry, arenaType, true);
             if (!arena)
             {
                 TC_LOG_ERROR("bg.battleground", "BattlegroundQueue::Update couldn't create arena instance for rated arena match!");
+
+                // teams that were not invited keep waiting
+                for (; itr != matches.end(); ++itr)
+                {
+                    m_RatedArenaTeams[bracket_id].Insert(itr->first);
+                    m_RatedArenaTeams[bracket_id].Insert(itr->second);
+                }
                 return;
             }
 
@@ -985,16 +1017,10 @@ void BattlegroundQueue::BattlegroundQueueUpdate(uint32 /*diff*/, BattlegroundTyp
             TC_LOG_DEBUG("bg.battleground", "setting oposite teamrating for team %u to %u", hTeam->ArenaTeamId, hTeam->OpponentsTeamRating);
 
             // now we must move team if we changed its faction to another faction queue, because then we will spam log by errors in Queue::RemovePlayer
-            if (aTeam->Team != ALLIANCE)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].push_front(aTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].erase(itr_teams[TEAM_ALLIANCE]);
-            }
-            if (hTeam->Team != HORDE)
-            {
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_HORDE].push_front(hTeam);
-                m_QueuedGroups[bracket_id][BG_QUEUE_PREMADE_ALLIANCE].erase(itr_teams[TEAM_HORDE]);
-            }
+            if (aTeam->QueueIndex != BG_QUEUE_PREMADE_ALLIANCE)
+                MoveGroupToQueue(aTeam, BG_QUEUE_PREMADE_ALLIANCE);
+            if (hTeam->QueueIndex != BG_QUEUE_PREMADE_HORDE)
+                MoveGroupToQueue(hTeam, BG_QUEUE_PREMADE_HORDE);
 
             arena->SetArenaMatchmakerRating(ALLIANCE, aTeam->ArenaMatchmakerRating);
             arena->SetArenaMatchmakerRating(   HORDE, hTeam->ArenaMatchmakerRating);
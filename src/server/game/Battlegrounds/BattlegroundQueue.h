@@ -24,6 +24,8 @@
 #include "EventProcessor.h"
 
 #include <deque>
+#include <map>
+#include <vector>
 
 //this container can't be deque, because deque doesn't like removing the last element - if you remove it, it invalidates next iterator and crash appears
 typedef std::list<Battleground*> BGFreeSlotQueueContainer;
@@ -52,6 +54,9 @@ struct GroupQueueInfo                                       // stores informatio
     uint32  ArenaMatchmakerRating;                          // if rated match, inited to the rating of the team
     uint32  OpponentsTeamRating;                            // for rated arena matches
     uint32  OpponentsMatchmakerRating;                      // for rated arena matches
+    BattlegroundBracketId BracketId;                        // bracket of BattlegroundQueue::m_QueuedGroups the group is queued in
+    uint32  QueueIndex;                                     // BattlegroundQueueGroupTypes of the queue the group is in
+    std::list<GroupQueueInfo*>::iterator QueueItr;          // position of the group in that queue
 };
 
 enum BattlegroundQueueGroupTypes
@@ -70,6 +75,31 @@ enum BattlegroundQueueInvitationType
     BG_QUEUE_INVITATION_TYPE_EVEN       = 2  // teams even: N vs N players
 };
 
+// Rated arena teams of one bracket waiting for an opponent, in buckets of matchmaker rating kept sorted by rating.
+// Teams are paired oldest first, each with the closest rated opponent within the max rating difference, so an
+// update does not have to test every pair of queued teams. Teams that waited longer than the rating discard
+// time accept an opponent of any rating.
+class TC_GAME_API ArenaRatingIndex
+{
+    public:
+        typedef std::vector<std::pair<GroupQueueInfo*, GroupQueueInfo*>> MatchContainer;
+
+        void Insert(GroupQueueInfo* ginfo);
+        void Remove(GroupQueueInfo* ginfo);
+
+        // Removes the teams paired for a match from the index and adds them to matches
+        void TakeMatches(uint32 maxRatingDifference, int32 discardTime, MatchContainer& matches);
+
+    private:
+        static constexpr uint32 BucketSize = 100;
+
+        GroupQueueInfo* FindOpponent(GroupQueueInfo const* ginfo, uint32 maxRatingDifference) const;
+        void RemoveFromBucket(GroupQueueInfo* ginfo);
+
+        std::map<uint32, std::vector<GroupQueueInfo*>> _buckets;    // by rating / BucketSize, teams of a bucket in join order
+        std::multimap<uint32, GroupQueueInfo*> _byJoinTime;
+};
+
 class Battleground;
 class TC_GAME_API BattlegroundQueue
 {
@@ -108,6 +138,10 @@ class TC_GAME_API BattlegroundQueue
         */
         GroupsQueueType m_QueuedGroups[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
 
+        // players of the groups in m_QueuedGroups that are not invited yet, updated on every queue change
+        // so that an update of a bracket without enough players does not have to walk its queues
+        uint32 m_WaitingPlayerCount[MAX_BATTLEGROUND_BRACKETS][BG_QUEUE_GROUP_TYPES_COUNT];
+
         // class to select and invite groups to bg
         class SelectionPool
         {
@@ -125,10 +159,15 @@ class TC_GAME_API BattlegroundQueue
 
         //one selection pool for horde, other one for alliance
         SelectionPool m_SelectionPools[BG_TEAMS_COUNT];
+
+        // rated arena teams of m_QueuedGroups that are not invited yet
+        ArenaRatingIndex m_RatedArenaTeams[MAX_BATTLEGROUND_BRACKETS];
         uint32 GetPlayersInQueue(TeamId id);
     private:
 
         bool InviteGroupToBG(GroupQueueInfo* ginfo, Battleground* bg, uint32 side);
+        // moves a group to the front of another queue of its bracket
+        void MoveGroupToQueue(GroupQueueInfo* ginfo, uint32 index);
         uint32 m_WaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS][COUNT_OF_PLAYERS_TO_AVERAGE_WAIT_TIME];
         uint32 m_WaitTimeLastPlayer[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
         uint32 m_SumOfWaitTimes[BG_TEAMS_COUNT][MAX_BATTLEGROUND_BRACKETS];
@@ -591,7 +591,7 @@ void BattlegroundAB::Reset()
             DelCreature(i);
 }
 
-void BattlegroundAB::EndBattleground(uint32 winner)
+void BattlegroundAB::EndBattlegroundImpl(uint32 winner)
 {
     // Win reward
     if (winner == ALLIANCE)
@@ -602,7 +602,7 @@ void BattlegroundAB::EndBattleground(uint32 winner)
     RewardHonorToTeam(GetBonusHonorFromKill(1), HORDE);
     RewardHonorToTeam(GetBonusHonorFromKill(1), ALLIANCE);
 
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 WorldSafeLocsEntry const* BattlegroundAB::GetClosestGraveyard(Player* player)
@@ -23,7 +23,6 @@
 #include "Language.h"
 #include "Log.h"
 #include "MotionMaster.h"
-#include "ObjectMgr.h"
 #include "Player.h"
 #include "WorldSession.h"
 
@@ -320,9 +319,8 @@ Creature* BattlegroundAV::AddAVCreature(uint16 cinfoid, uint16 type)
         if (!isStatic && ((cinfoid >= AV_NPC_A_GRAVEDEFENSE0 && cinfoid <= AV_NPC_A_GRAVEDEFENSE3)
             || (cinfoid >= AV_NPC_H_GRAVEDEFENSE0 && cinfoid <= AV_NPC_H_GRAVEDEFENSE3)))
         {
-            CreatureData &data = sObjectMgr->NewOrExistCreatureData(creature->GetSpawnId());
-            data.spawnGroupData = sObjectMgr->GetDefaultSpawnGroup();
-            data.wanderDistance = 5;
+            // battleground creatures have no spawn data, set it on the creature instead of the shared ObjectMgr store
+            creature->SetWanderDistance(5.0f);
         }
         //else wanderDistance will be 15, so creatures move maximum=10
         //creature->SetDefaultMovementType(RANDOM_MOTION_TYPE);
@@ -457,7 +455,7 @@ void BattlegroundAV::AddPlayer(Player* player)
     PlayerScores[player->GetGUID().GetCounter()] = new BattlegroundAVScore(player->GetGUID(), player->GetBGTeam());
 }
 
-void BattlegroundAV::EndBattleground(uint32 winner)
+void BattlegroundAV::EndBattlegroundImpl(uint32 winner)
 {
     //calculate bonuskills for both teams:
     //first towers:
@@ -494,7 +492,7 @@ void BattlegroundAV::EndBattleground(uint32 winner)
     }
 
     /// @todo add enterevademode for all attacking creatures
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 void BattlegroundAV::RemovePlayer(Player* player, ObjectGuid /*guid*/, uint32 /*team*/)
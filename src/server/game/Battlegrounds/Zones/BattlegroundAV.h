@@ -1655,7 +1655,7 @@ class BattlegroundAV : public Battleground
         void HandleQuestComplete(uint32 questid, Player* player) override;
         bool CanActivateGO(int32 GOId, uint32 team) const override;
 
-        void EndBattleground(uint32 winner) override;
+        void EndBattlegroundImpl(uint32 winner) override;
 
         WorldSafeLocsEntry const* GetClosestGraveyard(Player* player) override;
 
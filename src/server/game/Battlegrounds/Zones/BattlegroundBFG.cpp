@@ -565,7 +565,7 @@ void BattlegroundBFG::Reset()
             DelCreature(i);
 }
 
-void BattlegroundBFG::EndBattleground(uint32 winner)
+void BattlegroundBFG::EndBattlegroundImpl(uint32 winner)
 {
     // Win reward
     if (winner == ALLIANCE)
@@ -576,7 +576,7 @@ void BattlegroundBFG::EndBattleground(uint32 winner)
     RewardHonorToTeam(GetBonusHonorFromKill(1), HORDE);
     RewardHonorToTeam(GetBonusHonorFromKill(1), ALLIANCE);
 
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 WorldSafeLocsEntry const* BattlegroundBFG::GetClosestGraveyard(Player* player)
@@ -312,7 +312,7 @@ void BattlegroundEY::UpdateTeamScore(uint32 Team)
         UpdateWorldState(EY_HORDE_RESOURCES, score);
 }
 
-void BattlegroundEY::EndBattleground(uint32 winner)
+void BattlegroundEY::EndBattlegroundImpl(uint32 winner)
 {
     // Win reward
     if (winner == ALLIANCE)
@@ -323,7 +323,7 @@ void BattlegroundEY::EndBattleground(uint32 winner)
     RewardHonorToTeam(GetBonusHonorFromKill(1), ALLIANCE);
     RewardHonorToTeam(GetBonusHonorFromKill(1), HORDE);
 
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 void BattlegroundEY::UpdatePointsCount(uint32 Team)
@@ -412,7 +412,7 @@ class BattlegroundEY : public Battleground
         bool SetupBattleground() override;
         void Reset() override;
         void UpdateTeamScore(uint32 Team);
-        void EndBattleground(uint32 winner) override;
+        void EndBattlegroundImpl(uint32 winner) override;
         bool UpdatePlayerScore(Player* player, uint32 type, uint32 value, bool doAddHonor = true) override;
         void SetDroppedFlagGUID(ObjectGuid guid, int32 /*TeamID*/ = -1) override  { m_DroppedFlagGUID = guid; }
         ObjectGuid GetDroppedFlagGUID() const { return m_DroppedFlagGUID; }
@@ -909,7 +909,7 @@ void BattlegroundSA::ToggleTimer()
     UpdateWorldState(BG_SA_ENABLE_TIMER, TimerEnabled);
 }
 
-void BattlegroundSA::EndBattleground(uint32 winner)
+void BattlegroundSA::EndBattlegroundImpl(uint32 winner)
 {
     // honor reward for winning
     if (winner == ALLIANCE)
@@ -921,7 +921,7 @@ void BattlegroundSA::EndBattleground(uint32 winner)
     RewardHonorToTeam(GetBonusHonorFromKill(2), ALLIANCE);
     RewardHonorToTeam(GetBonusHonorFromKill(2), HORDE);
 
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 void BattlegroundSA::UpdateDemolisherSpawns()
@@ -345,7 +345,7 @@ void BattlegroundTP::Reset()
     _flagsTimer[TEAM_HORDE]          = 0;
 }
 
-void BattlegroundTP::EndBattleground(uint32 winner)
+void BattlegroundTP::EndBattlegroundImpl(uint32 winner)
 {
     // Win reward
     if (winner == ALLIANCE)
@@ -356,7 +356,7 @@ void BattlegroundTP::EndBattleground(uint32 winner)
     RewardHonorToTeam(GetBonusHonorFromKill(m_HonorEndKills), ALLIANCE);
     RewardHonorToTeam(GetBonusHonorFromKill(m_HonorEndKills), HORDE);
 
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 void BattlegroundTP::HandleKillPlayer(Player* player, Player* killer)
@@ -752,7 +752,7 @@ void BattlegroundWS::Reset()
     _flagsTimer[TEAM_HORDE]          = 0;
 }
 
-void BattlegroundWS::EndBattleground(uint32 winner)
+void BattlegroundWS::EndBattlegroundImpl(uint32 winner)
 {
     // Win reward
     if (winner == ALLIANCE)
@@ -763,7 +763,7 @@ void BattlegroundWS::EndBattleground(uint32 winner)
     RewardHonorToTeam(GetBonusHonorFromKill(m_HonorEndKills), ALLIANCE);
     RewardHonorToTeam(GetBonusHonorFromKill(m_HonorEndKills), HORDE);
 
-    Battleground::EndBattleground(winner);
+    Battleground::EndBattlegroundImpl(winner);
 }
 
 void BattlegroundWS::HandleKillPlayer(Player* player, Player* killer)
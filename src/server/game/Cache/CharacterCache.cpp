@@ -18,17 +18,298 @@
 #include "CharacterCache.h"
 #include "ArenaTeam.h"
 #include "DatabaseEnv.h"
+#include "FlatSlotTable.h"
 #include "Log.h"
 #include "Player.h"
+#include "ThreadPool.h"
 #include "Timer.h"
+#include "Util.h"
 #include "World.h"
 #include "WorldPacket.h"
-#include <unordered_map>
+#include <algorithm>
+#include <string_view>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    uint32 const InvalidSlot = Trinity::SlotHashIndex::InvalidSlot;
+
+    uint32 HashGuid(ObjectGuid const& guid)
+    {
+        // murmur3 finalizer, player guid counters are sequential
+        uint32 h = guid.GetCounter();
+        h ^= h >> 16;
+        h *= 0x85EBCA6B;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35;
+        h ^= h >> 16;
+        return h;
+    }
+
+    uint32 HashName(std::string_view foldedName)
+    {
+        // FNV-1a
+        uint32 h = 2166136261u;
+        for (char c : foldedName)
+        {
+            h ^= uint8(c);
+            h *= 16777619u;
+        }
+        return h;
+    }
+
+    std::string FoldName(std::string const& name)
+    {
+        std::string folded(name);
+        if (std::none_of(folded.begin(), folded.end(), [](char c) { return (c & 0x80) != 0; }))
+        {
+            for (char& c : folded)
+                if (c >= 'A' && c <= 'Z')
+                    c += 'a' - 'A';
+
+            return folded;
+        }
+
+        std::wstring wname;
+        if (!Utf8toWStr(name, wname))
+            return folded;
+
+        wstrToLower(wname);
+        WStrToUtf8(wname, folded);
+        return folded;
+    }
+
+    /// Characters are kept in a FlatSlotTable so entries never move, slots of deleted characters are reused.
+    /// Case folded copies of the names are packed in one contiguous buffer that backs the name hash and the sorted name index.
+    /// Characters without a name (deleted ones kept for restoring) are left out of both name indexes.
+    class CharacterCacheStorage
+    {
+        struct NameKey
+        {
+            uint32 Offset;
+            uint32 Length;
+        };
+
+    public:
+        CharacterCacheStorage() : _wastedNameBytes(0) { }
+
+        void Clear()
+        {
+            _entries.Clear();
+            _nameKeys.clear();
+            _names.clear();
+            _slotsByName.clear();
+            _guidIndex.Clear();
+            _nameIndex.Clear();
+            _wastedNameBytes = 0;
+        }
+
+        void Reserve(std::size_t count)
+        {
+            _entries.Reserve(count);
+            _nameKeys.reserve(count);
+            _names.reserve(count * 8);
+            _slotsByName.reserve(count);
+            _guidIndex.Reserve(count);
+            _nameIndex.Reserve(count);
+        }
+
+        /// Bulk insertion, the sorted name index is rebuilt by FinishLoading
+        CharacterCacheEntry& AddUnsorted(ObjectGuid const& guid, std::string const& name)
+        {
+            uint32 slot = AllocateSlot();
+            CharacterCacheEntry& entry = _entries[slot];
+            entry.Guid = guid;
+            entry.Name = name;
+            std::string folded = FoldName(name);
+            SetFoldedName(slot, folded);
+            _guidIndex.Insert(HashGuid(guid), slot);
+            if (!folded.empty())
+            {
+                _nameIndex.Insert(HashName(folded), slot);
+                _slotsByName.push_back(slot);
+            }
+            return entry;
+        }
+
+        void FinishLoading()
+        {
+            std::sort(_slotsByName.begin(), _slotsByName.end(), [this](uint32 left, uint32 right) { return GetFoldedName(left) < GetFoldedName(right); });
+        }
+
+        CharacterCacheEntry& Add(ObjectGuid const& guid, std::string const& name)
+        {
+            uint32 existing = FindSlotByGuid(guid);
+            if (existing != InvalidSlot)
+            {
+                Rename(existing, name);
+                return _entries[existing];
+            }
+
+            uint32 slot = AllocateSlot();
+            CharacterCacheEntry& entry = _entries[slot];
+            entry.Guid = guid;
+            entry.Name = name;
+            SetFoldedName(slot, FoldName(name));
+            _guidIndex.Insert(HashGuid(guid), slot);
+            IndexName(slot);
+            return entry;
+        }
+
+        void Delete(ObjectGuid const& guid)
+        {
+            uint32 slot = FindSlotByGuid(guid);
+            if (slot == InvalidSlot)
+                return;
+
+            UnindexName(slot);
+            _guidIndex.Erase(HashGuid(guid), [slot](uint32 other) { return other == slot; });
+
+            _wastedNameBytes += _nameKeys[slot].Length;
+            _nameKeys[slot] = { 0, 0 };
+            _entries.Free(slot);
+
+            CompactNamesIfWasteful();
+        }
+
+        void Rename(uint32 slot, std::string const& name)
+        {
+            UnindexName(slot);
+            _wastedNameBytes += _nameKeys[slot].Length;
+
+            _entries[slot].Name = name;
+            SetFoldedName(slot, FoldName(name));
+            IndexName(slot);
+
+            CompactNamesIfWasteful();
+        }
+
+        uint32 FindSlotByGuid(ObjectGuid const& guid) const
+        {
+            return _guidIndex.Find(HashGuid(guid), [this, &guid](uint32 slot) { return _entries[slot].Guid == guid; });
+        }
+
+        CharacterCacheEntry* FindByGuid(ObjectGuid const& guid)
+        {
+            uint32 slot = FindSlotByGuid(guid);
+            return slot != InvalidSlot ? &_entries[slot] : nullptr;
+        }
+
+        CharacterCacheEntry const* FindByGuid(ObjectGuid const& guid) const
+        {
+            uint32 slot = FindSlotByGuid(guid);
+            return slot != InvalidSlot ? &_entries[slot] : nullptr;
+        }
+
+        CharacterCacheEntry const* FindByName(std::string const& name) const
+        {
+            std::string folded = FoldName(name);
+            if (folded.empty())
+                return nullptr;
+
+            uint32 slot = _nameIndex.Find(HashName(folded), [this, &folded](uint32 slot) { return GetFoldedName(slot) == folded; });
+            return slot != InvalidSlot ? &_entries[slot] : nullptr;
+        }
+
+        void SearchByNamePrefix(std::string const& prefix, std::size_t maxResults, std::vector<CharacterCacheEntry const*>& results) const
+        {
+            std::string folded = FoldName(prefix);
+            auto itr = std::lower_bound(_slotsByName.begin(), _slotsByName.end(), folded, [this](uint32 slot, std::string const& key) { return GetFoldedName(slot) < key; });
+            for (; itr != _slotsByName.end() && maxResults; ++itr, --maxResults)
+            {
+                std::string_view name = GetFoldedName(*itr);
+                if (name.compare(0, folded.length(), folded) != 0)
+                    break;
+
+                results.push_back(&_entries[*itr]);
+            }
+        }
+
+        std::size_t GetCount() const { return _entries.GetSize(); }
+
+        std::size_t GetMemoryUsage() const
+        {
+            std::size_t memory = _entries.GetMemoryUsage() + _nameKeys.capacity() * sizeof(NameKey);
+            memory += _names.capacity() + _slotsByName.capacity() * sizeof(uint32);
+            memory += _guidIndex.GetMemoryUsage() + _nameIndex.GetMemoryUsage();
+            return memory;
+        }
+
+    private:
+        uint32 AllocateSlot()
+        {
+            uint32 slot = _entries.Allocate();
+            if (slot >= _nameKeys.size())
+                _nameKeys.resize(slot + 1, { 0, 0 });
+
+            return slot;
+        }
+
+        std::string_view GetFoldedName(uint32 slot) const
+        {
+            NameKey const& key = _nameKeys[slot];
+            return std::string_view(_names.data() + key.Offset, key.Length);
+        }
+
+        void SetFoldedName(uint32 slot, std::string const& folded)
+        {
+            _nameKeys[slot] = { uint32(_names.size()), uint32(folded.length()) };
+            _names.insert(_names.end(), folded.begin(), folded.end());
+        }
+
+        void IndexName(uint32 slot)
+        {
+            std::string_view name = GetFoldedName(slot);
+            if (name.empty())
+                return;
+
+            _nameIndex.Insert(HashName(name), slot);
+            auto itr = std::lower_bound(_slotsByName.begin(), _slotsByName.end(), name, [this](uint32 other, std::string_view key) { return GetFoldedName(other) < key; });
+            _slotsByName.insert(itr, slot);
+        }
+
+        void UnindexName(uint32 slot)
+        {
+            std::string_view name = GetFoldedName(slot);
+            if (name.empty())
+                return;
+
+            _nameIndex.Erase(HashName(name), [slot](uint32 other) { return other == slot; });
+            auto itr = std::lower_bound(_slotsByName.begin(), _slotsByName.end(), name, [this](uint32 other, std::string_view key) { return GetFoldedName(other) < key; });
+            while (itr != _slotsByName.end() && *itr != slot && GetFoldedName(*itr) == name)
+                ++itr;
+
+            if (itr != _slotsByName.end() && *itr == slot)
+                _slotsByName.erase(itr);
+        }
+
+        void CompactNamesIfWasteful()
+        {
+            if (_wastedNameBytes <= _names.size() / 2)
+                return;
+
+            std::vector<char> names;
+            names.reserve(_names.size() - _wastedNameBytes);
+            for (NameKey& key : _nameKeys)
+            {
+                uint32 offset = uint32(names.size());
+                names.insert(names.end(), _names.begin() + key.Offset, _names.begin() + key.Offset + key.Length);
+                key.Offset = offset;
+            }
+
+            _names = std::move(names);
+            _wastedNameBytes = 0;
+        }
+
+        Trinity::FlatSlotTable<CharacterCacheEntry, 4096> _entries;
+        std::vector<NameKey> _nameKeys;
+        std::vector<char> _names;
+        std::vector<uint32> _slotsByName;
+        Trinity::SlotHashIndex _guidIndex;
+        Trinity::SlotHashIndex _nameIndex;
+        std::size_t _wastedNameBytes;
+    };
+
+    CharacterCacheStorage _characterCacheStore;
 }
 
 CharacterCache::CharacterCache()
@@ -68,24 +349,82 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
+    _characterCacheStore.Clear();
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
-    if (!result)
+    QueryResult result = CharacterDatabase.Query("SELECT MIN(guid), MAX(guid), COUNT(*) FROM characters");
+    if (!result || !result->Fetch()[2].GetUInt64())
     {
         TC_LOG_INFO("server.loading", "No character name data loaded, empty query");
         return;
     }
 
-    do
+    uint32 minGuid = result->Fetch()[0].GetUInt32();
+    uint32 maxGuid = result->Fetch()[1].GetUInt32();
+    uint64 count = result->Fetch()[2].GetUInt64();
+
+    struct LoadedCharacter
+    {
+        ObjectGuid Guid;
+        std::string Name;
+        uint32 AccountId;
+        uint8 Race;
+        uint8 Sex;
+        uint8 Class;
+        uint8 Level;
+    };
+
+    // Guid ranges are fetched and converted on several threads, the indexes are built afterwards on this one
+    uint32 chunkCount = std::max(1u, std::min(std::thread::hardware_concurrency(), maxGuid - minGuid + 1));
+    uint32 chunkSize = (maxGuid - minGuid) / chunkCount + 1;
+    std::vector<std::vector<LoadedCharacter>> chunks(chunkCount);
+    {
+        Trinity::ThreadPool pool(chunkCount);
+        for (uint32 i = 0; i < chunkCount; ++i)
+        {
+            pool.PostWork([&chunks, i, first = minGuid + i * chunkSize, last = minGuid + std::min(maxGuid - minGuid, (i + 1) * chunkSize - 1)]()
+            {
+                QueryResult chunkResult = CharacterDatabase.PQuery("SELECT guid, name, account, race, gender, class, level FROM characters WHERE guid BETWEEN %u AND %u", first, last);
+                if (!chunkResult)
+                    return;
+
+                std::vector<LoadedCharacter>& characters = chunks[i];
+                characters.reserve(chunkResult->GetRowCount());
+                do
+                {
+                    Field* fields = chunkResult->Fetch();
+                    characters.push_back({ ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32()), fields[1].GetString(), fields[2].GetUInt32(),
+                        fields[3].GetUInt8(), fields[4].GetUInt8(), fields[5].GetUInt8(), fields[6].GetUInt8() });
+                } while (chunkResult->NextRow());
+            });
+        }
+
+        pool.Join();
+    }
+
+    _characterCacheStore.Reserve(count);
+    for (std::vector<LoadedCharacter>& characters : chunks)
     {
-        Field* fields = result->Fetch();
-        AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].GetUInt32()) /*guid*/, fields[2].GetUInt32() /*account*/, fields[1].GetString() /*name*/,
-            fields[4].GetUInt8() /*gender*/, fields[3].GetUInt8() /*race*/, fields[5].GetUInt8() /*class*/, fields[6].GetUInt8() /*level*/);
-    } while (result->NextRow());
+        for (LoadedCharacter& character : characters)
+        {
+            CharacterCacheEntry& data = _characterCacheStore.AddUnsorted(character.Guid, character.Name);
+            data.AccountId = character.AccountId;
+            data.Race = character.Race;
+            data.Sex = character.Sex;
+            data.Class = character.Class;
+            data.Level = character.Level;
+            data.GuildId = 0;                           // Will be set in guild loading or guild setting
+            for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+                data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
+        }
+
+        std::vector<LoadedCharacter>().swap(characters);
+    }
+
+    _characterCacheStore.FinishLoading();
 
-    TC_LOG_INFO("server.loading", "Loaded character infos for " SZFMTD " characters in %u ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    TC_LOG_INFO("server.loading", "Loaded character infos for " SZFMTD " characters (" SZFMTD " KiB) in %u ms", _characterCacheStore.GetCount(),
+        _characterCacheStore.GetMemoryUsage() / 1024, GetMSTimeDiffToNow(oldMSTime));
 }
 
 /*
@@ -93,9 +432,7 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
+    CharacterCacheEntry& data = _characterCacheStore.Add(guid, name);
     data.AccountId = accountId;
     data.Race = race;
     data.Sex = gender;
@@ -104,75 +441,55 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
     data.GuildId = 0;                           // Will be set in guild loading or guild setting
     for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
         data.ArenaTeamId[i] = 0;                // Will be set in arena teams loading
-
-    // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
 }
 
-void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
+void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& /*name*/)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    _characterCacheStore.Delete(guid);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, uint8* gender /*= nullptr*/, uint8* race /*= nullptr*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    uint32 slot = _characterCacheStore.FindSlotByGuid(guid);
+    if (slot == InvalidSlot)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    _characterCacheStore.Rename(slot, name);
 
+    CharacterCacheEntry* data = _characterCacheStore.FindByGuid(guid);
     if (gender)
-        itr->second.Sex = *gender;
+        data->Sex = *gender;
 
     if (race)
-        itr->second.Race = *race;
-
-    WorldPacket data(SMSG_INVALIDATE_PLAYER, 8);
-    data << guid;
-    sWorld->SendGlobalMessage(&data);
+        data->Race = *race;
 
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    WorldPacket packet(SMSG_INVALIDATE_PLAYER, 8);
+    packet << guid;
+    sWorld->SendGlobalMessage(&packet);
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.Level = level;
+    if (CharacterCacheEntry* data = _characterCacheStore.FindByGuid(guid))
+        data->Level = level;
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.AccountId = accountId;
+    if (CharacterCacheEntry* data = _characterCacheStore.FindByGuid(guid))
+        data->AccountId = accountId;
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.GuildId = guildId;
+    if (CharacterCacheEntry* data = _characterCacheStore.FindByGuid(guid))
+        data->GuildId = guildId;
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-        return;
-
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    if (CharacterCacheEntry* data = _characterCacheStore.FindByGuid(guid))
+        data->ArenaTeamId[slot] = arenaTeamId;
 }
 
 /*
@@ -180,109 +497,114 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return _characterCacheStore.FindSlotByGuid(guid) != InvalidSlot;
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-        return &itr->second;
-
-    return nullptr;
+    return static_cast<CharacterCacheStorage const&>(_characterCacheStore).FindByGuid(guid);
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second;
-
-    return nullptr;
+    return _characterCacheStore.FindByName(name);
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->Guid;
+    if (CharacterCacheEntry const* data = GetCharacterCacheByName(name))
+        return data->Guid;
 
     return ObjectGuid::Empty;
 }
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return false;
 
-    name = itr->second.Name;
+    name = data->Name;
     return true;
 }
 
 bool CharacterCache::GetPlayerGuildIdByGUID(ObjectGuid guid, uint32& guildId) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return false;
 
-    if (!itr->second.GuildId)
+    if (!data->GuildId)
         return false;
 
-    guildId = itr->second.GuildId;
+    guildId = data->GuildId;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return Player::TeamForRace(itr->second.Race);
+    return Player::TeamForRace(data->Race);
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.AccountId;
+    return data->AccountId;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-        return itr->second->AccountId;
+    if (CharacterCacheEntry const* data = GetCharacterCacheByName(name))
+        return data->AccountId;
 
     return 0;
 }
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.Level;
+    return data->Level;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.GuildId;
+    return data->GuildId;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = GetCharacterCacheByGuid(guid);
+    if (!data)
         return 0;
 
-    return itr->second.ArenaTeamId[ArenaTeam::GetSlotByType(type)];
+    return data->ArenaTeamId[ArenaTeam::GetSlotByType(type)];
+}
+
+void CharacterCache::SearchCharactersByNamePrefix(std::string const& prefix, std::size_t maxResults, std::vector<CharacterCacheEntry const*>& results) const
+{
+    _characterCacheStore.SearchByNamePrefix(prefix, maxResults, results);
+}
+
+std::size_t CharacterCache::GetCharacterCacheSize() const
+{
+    return _characterCacheStore.GetCount();
+}
+
+std::size_t CharacterCache::GetCharacterCacheMemoryUsage() const
+{
+    return _characterCacheStore.GetMemoryUsage();
 }
@@ -21,6 +21,7 @@
 #include "Define.h"
 #include "ObjectGuid.h"
 #include <string>
+#include <vector>
 
 struct CharacterCacheEntry
 {
@@ -65,6 +66,12 @@ class TC_GAME_API CharacterCache
         uint8 GetCharacterLevelByGuid(ObjectGuid guid) const;
         ObjectGuid::LowType GetCharacterGuildIdByGuid(ObjectGuid guid) const;
         uint32 GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const;
+
+        /// Appends up to maxResults characters whose name starts with prefix (case insensitive) ordered by name
+        void SearchCharactersByNamePrefix(std::string const& prefix, std::size_t maxResults, std::vector<CharacterCacheEntry const*>& results) const;
+
+        std::size_t GetCharacterCacheSize() const;
+        std::size_t GetCharacterCacheMemoryUsage() const;
 };
 
 #define sCharacterCache CharacterCache::instance()
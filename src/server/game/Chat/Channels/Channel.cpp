@@ -235,6 +235,8 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     PlayerInfo& pinfo = _playersStore[guid];
     pinfo.flags = MEMBER_FLAG_NONE;
     pinfo.invisible = !player->isGMVisible();
+    pinfo.memberIndex = _members.size();
+    _members.push_back({ guid, player });
 
     YouJoinedAppend appender(this);
     ChannelNameBuilder<YouJoinedAppend> builder(this, appender);
@@ -286,7 +288,7 @@ void Channel::LeaveChannel(Player* player, bool send)
 
     PlayerInfo& info = _playersStore.at(guid);
     bool changeowner = info.IsOwner();
-    _playersStore.erase(guid);
+    RemoveMember(guid);
 
     if (_announceEnabled && !player->GetSession()->HasPermission(rbac::RBAC_PERM_SILENTLY_JOIN_CHANNEL))
     {
@@ -388,7 +390,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
         SendToAll(builder);
     }
 
-    _playersStore.erase(victim);
+    RemoveMember(victim);
     bad->LeftChannel(this);
 
     if (changeowner && _ownershipEnabled && !_playersStore.empty())
@@ -536,6 +538,24 @@ void Channel::SetInvisible(Player const* player, bool on)
         _isOwnerInvisible = on;
 }
 
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    PlayerContainer::iterator itr = _playersStore.find(guid);
+    if (itr == _playersStore.end())
+        return;
+
+    // swap with the last member to keep the array contiguous
+    uint32 index = itr->second.memberIndex;
+    if (index + 1 != _members.size())
+    {
+        _members[index] = _members.back();
+        _playersStore.at(_members[index].Guid).memberIndex = index;
+    }
+
+    _members.pop_back();
+    _playersStore.erase(itr);
+}
+
 void Channel::SetModerator(ObjectGuid guid, bool set)
 {
     if (!IsOn(guid))
@@ -654,12 +674,11 @@ void Channel::List(Player const* player) const
     uint32 count  = 0;
     for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
     {
-        Player* member = ObjectAccessor::FindConnectedPlayer(i->first);
+        Player const* member = _members[i->second.memberIndex].Member;
 
         // PLAYER can't see MODERATOR, GAME MASTER, ADMINISTRATOR characters
         // MODERATOR, GAME MASTER, ADMINISTRATOR can see all
-        if (member &&
-            (player->GetSession()->HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) ||
+        if ((player->GetSession()->HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) ||
              member->GetSession()->GetSecurity() <= AccountTypes(gmLevelInWhoList)) &&
             member->IsVisibleGloballyFor(player))
         {
@@ -738,14 +757,12 @@ void Channel::Say(ObjectGuid guid, std::string const& what, uint32 lang) const
         return;
     }
 
+    Player const* speaker = _members[info.memberIndex].Member;
     auto builder = [&](WorldPacket& data, LocaleConstant locale)
     {
         LocaleConstant localeIdx = sWorld->GetAvailableDbcLocale(locale);
 
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
-            ChatHandler::BuildChatPacket(data, CHAT_MSG_CHANNEL, Language(lang), player, player, what, 0, GetName(localeIdx));
-        else
-            ChatHandler::BuildChatPacket(data, CHAT_MSG_CHANNEL, Language(lang), guid, guid, what, 0, "", "", 0, false, GetName(localeIdx));
+        ChatHandler::BuildChatPacket(data, CHAT_MSG_CHANNEL, Language(lang), speaker, speaker, what, 0, GetName(localeIdx));
     };
 
     SendToAll(builder, !info.IsModerator() ? guid : ObjectGuid::Empty);
@@ -897,23 +914,24 @@ void Channel::LeaveNotify(ObjectGuid guid) const
 template<class Builder>
 void Channel::SendToAll(Builder& builder, ObjectGuid guid /*= ObjectGuid::Empty*/) const
 {
-    Trinity::LocalizedPacketDo<Builder> localizer(builder);
+    Trinity::SharedLocalizedPacketDo<Builder> localizer(builder);
 
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-            if (!guid || !player->GetSocial()->HasIgnore(guid))
-                localizer(player);
+    // skip members that ignore the sender, looked up once instead of per receiver
+    GuidUnorderedSet const* ignoredBy = guid ? sSocialMgr->GetIgnoredBy(guid) : nullptr;
+
+    for (ChannelMember const& member : _members)
+        if (!ignoredBy || !ignoredBy->count(member.Guid))
+            localizer(member.Member);
 }
 
 template<class Builder>
 void Channel::SendToAllButOne(Builder& builder, ObjectGuid who) const
 {
-    Trinity::LocalizedPacketDo<Builder> localizer(builder);
+    Trinity::SharedLocalizedPacketDo<Builder> localizer(builder);
 
-    for (PlayerContainer::const_iterator i = _playersStore.begin(); i != _playersStore.end(); ++i)
-        if (i->first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-                localizer(player);
+    for (ChannelMember const& member : _members)
+        if (member.Guid != who)
+            localizer(member.Member);
 }
 
 template<class Builder>
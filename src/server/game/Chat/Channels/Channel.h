@@ -22,6 +22,7 @@
 #include "ObjectGuid.h"
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 class Player;
 struct AreaTableEntry;
@@ -120,6 +121,7 @@ class TC_GAME_API Channel
     {
         uint8 flags;
         bool invisible;
+        uint32 memberIndex;                 //< position in _members
 
         bool IsInvisible() const { return invisible; }
         void SetInvisible(bool on) { invisible = on; }
@@ -149,6 +151,13 @@ class TC_GAME_API Channel
         }
     };
 
+    // members stay in the channel only while logged in (Player::CleanupChannels), so the handle is always valid
+    struct ChannelMember
+    {
+        ObjectGuid Guid;
+        Player* Member;
+    };
+
     public:
 
         Channel(uint32 channelId, uint32 team = 0, AreaTableEntry const* zoneEntry = nullptr);  // built-in channel ctor
@@ -233,7 +242,10 @@ class TC_GAME_API Channel
         void SetModerator(ObjectGuid guid, bool set);
         void SetMute(ObjectGuid guid, bool set);
 
+        void RemoveMember(ObjectGuid guid);
+
         typedef std::map<ObjectGuid, PlayerInfo> PlayerContainer;
+        typedef std::vector<ChannelMember> MemberContainer;
         typedef GuidUnorderedSet BannedContainer;
 
         bool _announceEnabled;          //< Whether we should broadcast a packet whenever a player joins/exits the channel
@@ -248,6 +260,7 @@ class TC_GAME_API Channel
         std::string _channelName;
         std::string _channelPassword;
         PlayerContainer _playersStore;
+        MemberContainer _members;       //< Same players as _playersStore, contiguous for broadcasts
         BannedContainer _bannedStore;
 
         AreaTableEntry const* _zoneEntry;
@@ -41,9 +41,9 @@ void ThreatReference::AddThreat(float amount)
         return;
     _baseAmount = std::max<float>(_baseAmount + amount, 0.0f);
     if (amount > 0.0f)
-        HeapNotifyIncreased();
+        ListNotifyIncreased();
     else
-        HeapNotifyDecreased();
+        ListNotifyDecreased();
     _mgr._needClientUpdate = true;
 }
 
@@ -53,9 +53,9 @@ void ThreatReference::ScaleThreat(float factor)
         return;
     _baseAmount *= factor;
     if (factor > 1.0f)
-        HeapNotifyIncreased();
+        ListNotifyIncreased();
     else
-        HeapNotifyDecreased();
+        ListNotifyDecreased();
     _mgr._needClientUpdate = true;
 }
 
@@ -68,13 +68,13 @@ void ThreatReference::UpdateOffline()
     if (shouldBeOffline)
     {
         _online = ONLINE_STATE_OFFLINE;
-        HeapNotifyDecreased();
+        ListNotifyDecreased();
         _mgr.SendRemoveToClients(_victim);
     }
     else
     {
         _online = ShouldBeSuppressed() ? ONLINE_STATE_SUPPRESSED : ONLINE_STATE_ONLINE;
-        HeapNotifyIncreased();
+        ListNotifyIncreased();
         _mgr.RegisterForAIUpdate(GetVictim()->GetGUID());
     }
 }
@@ -132,9 +132,9 @@ void ThreatReference::UpdateTauntState(TauntState state)
     std::swap(state, _taunted);
 
     if (_taunted < state)
-        HeapNotifyDecreased();
+        ListNotifyDecreased();
     else
-        HeapNotifyIncreased();
+        ListNotifyIncreased();
 
     _mgr._needClientUpdate = true;
 }
@@ -171,7 +171,8 @@ void ThreatReference::UnregisterAndFree()
     return true;
 }
 
-ThreatManager::ThreatManager(Unit* owner) : _owner(owner), _ownerCanHaveThreatList(false), _needClientUpdate(false), _updateTimer(THREAT_UPDATE_INTERVAL), _currentVictimRef(nullptr), _fixateRef(nullptr)
+ThreatManager::ThreatManager(Unit* owner) : _owner(owner), _ownerCanHaveThreatList(false), _needClientUpdate(false), _updateTimer(THREAT_UPDATE_INTERVAL), _currentVictimRef(nullptr), _fixateRef(nullptr),
+    _multiSchoolModifierCount(0), _redirectInfoCount(0)
 {
     for (int8 i = 0; i < MAX_SPELL_SCHOOL; ++i)
         _singleSchoolModifiers[i] = 1.0f;
@@ -179,8 +180,8 @@ ThreatManager::ThreatManager(Unit* owner) : _owner(owner), _ownerCanHaveThreatLi
 
 ThreatManager::~ThreatManager()
 {
-    ASSERT(_myThreatListEntries.empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _myThreatListEntries.size(), _myThreatListEntries.begin()->first.ToString().c_str());
-    ASSERT(_sortedThreatList.empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _sortedThreatList.size(), (*_sortedThreatList.begin())->GetVictim()->GetGUID().ToString().c_str());
+    ASSERT(_myThreatListEntries.empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _myThreatListGuids.size(), _myThreatListGuids.front().ToString().c_str());
+    ASSERT(_sortedThreatList.empty(), "ThreatManager::~ThreatManager - %s: we still have %zu things threatening us, one of them is %s.", _owner->GetGUID().ToString().c_str(), _sortedThreatList.size(), _sortedThreatList.front()->GetVictim()->GetGUID().ToString().c_str());
     ASSERT(_threatenedByMe.empty(), "ThreatManager::~ThreatManager - %s: we are still threatening %zu things, one of them is %s.", _owner->GetGUID().ToString().c_str(), _threatenedByMe.size(), _threatenedByMe.begin()->first.ToString().c_str());
 }
 
@@ -219,46 +220,44 @@ Unit* ThreatManager::GetLastVictim() const
 
 Unit* ThreatManager::GetAnyTarget() const
 {
-    for (ThreatReference const* ref : _sortedThreatList)
-        if (!ref->IsOffline())
-            return ref->GetVictim();
-    return nullptr;
+    // online state takes precedence over everything else when sorting - if the first entry is offline, all of them are
+    if (_sortedThreatList.empty() || _sortedThreatList.front()->IsOffline())
+        return nullptr;
+    return _sortedThreatList.front()->GetVictim();
 }
 
 bool ThreatManager::IsThreatListEmpty(bool includeOffline) const
 {
-    if (includeOffline)
+    if (includeOffline || _sortedThreatList.empty())
         return _sortedThreatList.empty();
-    for (ThreatReference const* ref : _sortedThreatList)
-        if (ref->IsAvailable())
-            return false;
-    return true;
+    return !_sortedThreatList.front()->IsAvailable();
 }
 
 bool ThreatManager::IsThreatenedBy(ObjectGuid const& who, bool includeOffline) const
 {
-    auto it = _myThreatListEntries.find(who);
-    if (it == _myThreatListEntries.end())
+    ThreatReference const* ref = GetThreatListRef(who);
+    if (!ref)
         return false;
-    return (includeOffline || it->second->IsAvailable());
+    return (includeOffline || ref->IsAvailable());
 }
 bool ThreatManager::IsThreatenedBy(Unit const* who, bool includeOffline) const { return IsThreatenedBy(who->GetGUID(), includeOffline); }
 
 float ThreatManager::GetThreat(Unit const* who, bool includeOffline) const
 {
-    auto it = _myThreatListEntries.find(who->GetGUID());
-    if (it == _myThreatListEntries.end())
+    ThreatReference const* ref = GetThreatListRef(who->GetGUID());
+    if (!ref)
         return 0.0f;
-    return (includeOffline || it->second->IsAvailable()) ? it->second->GetThreat() : 0.0f;
+    return (includeOffline || ref->IsAvailable()) ? ref->GetThreat() : 0.0f;
 }
 
 std::vector<ThreatReference*> ThreatManager::GetModifiableThreatList()
 {
-    std::vector<ThreatReference*> list;
-    list.reserve(_myThreatListEntries.size());
-    for (auto it = _sortedThreatList.ordered_begin(), end = _sortedThreatList.ordered_end(); it != end; ++it)
-        list.push_back(const_cast<ThreatReference*>(*it));
-    return list;
+    return _sortedThreatList;
+}
+
+void ThreatManager::GetModifiableThreatList(std::vector<ThreatReference*>& list) const
+{
+    list.assign(_sortedThreatList.begin(), _sortedThreatList.end());
 }
 
 bool ThreatManager::IsThreateningAnyone(bool includeOffline) const
@@ -288,12 +287,12 @@ void ThreatManager::EvaluateSuppressed(bool canExpire)
         if (pair.second->IsOnline() && shouldBeSuppressed)
         {
             pair.second->_online = ThreatReference::ONLINE_STATE_SUPPRESSED;
-            pair.second->HeapNotifyDecreased();
+            pair.second->ListNotifyDecreased();
         }
         else if (canExpire && pair.second->IsSuppressed() && !shouldBeSuppressed)
         {
             pair.second->_online = ThreatReference::ONLINE_STATE_ONLINE;
-            pair.second->HeapNotifyIncreased();
+            pair.second->ListNotifyIncreased();
         }
     }
 }
@@ -325,10 +324,14 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
         if (!combatMgr.SetInCombatWith(target))
             return;
         // traverse redirects and put them in combat, too
-        for (auto const& pair : target->GetThreatManager()._redirectInfo)
+        ThreatManager const& targetMgr = target->GetThreatManager();
+        for (uint32 i = 0; i < targetMgr._redirectInfoCount; ++i)
+        {
+            auto const& pair = targetMgr._redirectInfo[i];
             if (!combatMgr.IsInCombatWith(pair.first))
                 if (Unit* redirTarget = ObjectAccessor::GetUnit(*_owner, pair.first))
                     combatMgr.SetInCombatWith(redirTarget);
+        }
         return;
     }
 
@@ -339,18 +342,17 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
     // if we're increasing threat, send some/all of it to redirection targets instead if applicable
     if (!ignoreRedirects && amount > 0.0f)
     {
-        auto const& redirInfo = target->GetThreatManager()._redirectInfo;
-        if (!redirInfo.empty())
+        ThreatManager const& targetMgr = target->GetThreatManager();
+        if (targetMgr._redirectInfoCount)
         {
             float const origAmount = amount;
             // intentional iteration by index - there's a nested AddThreat call further down that might cause AI calls which might modify redirect info through spells
-            for (size_t i = 0; i < redirInfo.size(); ++i)
+            for (uint32 i = 0; i < targetMgr._redirectInfoCount; ++i)
             {
-                auto const pair = redirInfo[i]; // (victim,pct)
+                auto const pair = targetMgr._redirectInfo[i]; // (victim,pct)
                 Unit* redirTarget = nullptr;
-                auto it = _myThreatListEntries.find(pair.first); // try to look it up in our threat list first (faster)
-                if (it != _myThreatListEntries.end())
-                    redirTarget = it->second->_victim;
+                if (ThreatReference const* redirRef = GetThreatListRef(pair.first)) // try to look it up in our threat list first (faster)
+                    redirTarget = redirRef->_victim;
                 else
                     redirTarget = ObjectAccessor::GetUnit(*_owner, pair.first);
 
@@ -370,16 +372,14 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
 
     // ok, now we actually apply threat
     // check if we already have an entry - if we do, just increase threat for that entry and we're done
-    auto it = _myThreatListEntries.find(target->GetGUID());
-    if (it != _myThreatListEntries.end())
+    if (ThreatReference* const ref = GetThreatListRef(target->GetGUID()))
     {
-        ThreatReference* const ref = it->second;
         // SUPPRESSED threat states don't go back to ONLINE until threat is caused by them (retail behavior)
         if (ref->GetOnlineState() == ThreatReference::ONLINE_STATE_SUPPRESSED)
             if (!ref->ShouldBeSuppressed())
             {
                 ref->_online = ThreatReference::ONLINE_STATE_ONLINE;
-                ref->HeapNotifyIncreased();
+                ref->ListNotifyIncreased();
             }
 
         if (ref->IsOnline())
@@ -404,9 +404,8 @@ void ThreatManager::AddThreat(Unit* target, float amount, SpellInfo const* spell
 
 void ThreatManager::ScaleThreat(Unit* target, float factor)
 {
-    auto it = _myThreatListEntries.find(target->GetGUID());
-    if (it != _myThreatListEntries.end())
-        it->second->ScaleThreat(std::max<float>(factor, 0.0f));
+    if (ThreatReference* ref = GetThreatListRef(target->GetGUID()))
+        ref->ScaleThreat(std::max<float>(factor, 0.0f));
 }
 
 void ThreatManager::MatchUnitThreatToHighestThreat(Unit* target)
@@ -414,14 +413,13 @@ void ThreatManager::MatchUnitThreatToHighestThreat(Unit* target)
     if (_sortedThreatList.empty())
         return;
 
-    auto it = _sortedThreatList.ordered_begin(), end = _sortedThreatList.ordered_end();
-    ThreatReference const* highest = *it;
+    ThreatReference const* highest = _sortedThreatList[0];
     if (!highest->IsAvailable())
         return;
 
-    if (highest->IsTaunting() && ((++it) != end)) // might need to skip this - max threat could be the preceding element (there is only one taunt element)
+    if (highest->IsTaunting() && _sortedThreatList.size() > 1) // might need to skip this - max threat could be the preceding element (there is only one taunt element)
     {
-        ThreatReference const* a = *it;
+        ThreatReference const* a = _sortedThreatList[1];
         if (a->IsAvailable() && a->GetThreat() > highest->GetThreat())
             highest = a;
     }
@@ -439,13 +437,13 @@ void ThreatManager::TauntUpdate()
     for (auto it = tauntEffects.begin(), end = tauntEffects.end(); it != end; ++it)
         tauntStates[(*it)->GetCasterGUID()] = ThreatReference::TauntState(state++);
 
-    for (auto const& pair : _myThreatListEntries)
+    for (size_t i = 0; i < _myThreatListEntries.size(); ++i)
     {
-        auto it = tauntStates.find(pair.first);
+        auto it = tauntStates.find(_myThreatListGuids[i]);
         if (it != tauntStates.end())
-            pair.second->UpdateTauntState(it->second);
+            _myThreatListEntries[i]->UpdateTauntState(it->second);
         else
-            pair.second->UpdateTauntState();
+            _myThreatListEntries[i]->UpdateTauntState();
     }
 
     // taunt aura update also re-evaluates all suppressed states (retail behavior)
@@ -454,15 +452,14 @@ void ThreatManager::TauntUpdate()
 
 void ThreatManager::ResetAllThreat()
 {
-    for (auto const& pair : _myThreatListEntries)
-        pair.second->ScaleThreat(0.0f);
+    for (ThreatReference* ref : _myThreatListEntries)
+        ref->ScaleThreat(0.0f);
 }
 
 void ThreatManager::ClearThreat(Unit* target)
 {
-    auto it = _myThreatListEntries.find(target->GetGUID());
-    if (it != _myThreatListEntries.end())
-        ClearThreat(it->second);
+    if (ThreatReference* ref = GetThreatListRef(target->GetGUID()))
+        ClearThreat(ref);
 }
 
 void ThreatManager::ClearThreat(ThreatReference* ref)
@@ -479,7 +476,7 @@ void ThreatManager::ClearAllThreat()
     {
         SendClearAllThreatToClients();
         do
-            _myThreatListEntries.begin()->second->UnregisterAndFree();
+            _myThreatListEntries.back()->UnregisterAndFree();
         while (!_myThreatListEntries.empty());
     }
 }
@@ -488,10 +485,9 @@ void ThreatManager::FixateTarget(Unit* target)
 {
     if (target)
     {
-        auto it = _myThreatListEntries.find(target->GetGUID());
-        if (it != _myThreatListEntries.end())
+        if (ThreatReference* ref = GetThreatListRef(target->GetGUID()))
         {
-            _fixateRef = it->second;
+            _fixateRef = ref;
             return;
         }
     }
@@ -526,8 +522,8 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (_sortedThreatList.empty())
         return nullptr;
 
-    for (auto const& pair : _myThreatListEntries)
-        pair.second->UpdateOffline(); // AI notifies are processed in ::UpdateVictim caller
+    for (ThreatReference* ref : _myThreatListEntries)
+        ref->UpdateOffline(); // AI notifies are processed in ::UpdateVictim caller
 
     // fixated target is always preferred
     if (_fixateRef && _fixateRef->IsAvailable())
@@ -537,7 +533,7 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (oldVictimRef && oldVictimRef->IsOffline())
         oldVictimRef = nullptr;
     // in 99% of cases - we won't need to actually look at anything beyond the first element
-    ThreatReference const* highest = _sortedThreatList.top();
+    ThreatReference const* highest = _sortedThreatList.front();
     // if the highest reference is offline, the entire list is offline, and we indicate this
     if (!highest->IsAvailable())
         return nullptr;
@@ -554,11 +550,9 @@ ThreatReference const* ThreatManager::ReselectVictim()
     if (_owner->IsWithinMeleeRange(highest->_victim))
         return highest;
     // If we get here, highest threat is ranged, but below 130% of current - there might be a melee that breaks 110% below us somewhere, so now we need to actually look at the next highest element
-    // luckily, this is a heap, so getting the next highest element is O(log n), and we're just gonna do that repeatedly until we've seen enough targets (or find a target)
-    auto it = _sortedThreatList.ordered_begin(), end = _sortedThreatList.ordered_end();
-    while (it != end)
+    // luckily, the list is kept sorted, so we just walk down it until we've seen enough targets (or find a target)
+    for (ThreatReference const* next : _sortedThreatList)
     {
-        ThreatReference const* next = *it;
         // if we've found current victim, we're done (nothing above is higher, and nothing below can be higher)
         if (next == oldVictimRef)
             return next;
@@ -569,7 +563,6 @@ ThreatReference const* ThreatManager::ReselectVictim()
         if (_owner->IsWithinMeleeRange(next->_victim))
             return next;
         // otherwise the next highest target may still be a melee above 110% and we need to look further
-        ++it;
     }
     // we should have found the old victim at some point in the loop above, so execution should never get to this point
     ASSERT(false, "Current victim not found in sorted threat list even though it has a reference - manager desync!");
@@ -583,7 +576,7 @@ void ThreatManager::ProcessAIUpdates()
     if (!ai)
         return;
     for (ObjectGuid const& guid : v)
-        if (ThreatReference const* ref = Trinity::Containers::MapGetValuePtr(_myThreatListEntries, guid))
+        if (ThreatReference const* ref = GetThreatListRef(guid))
             ai->JustStartedThreateningMe(ref->GetVictim());
 }
 
@@ -637,22 +630,25 @@ void ThreatManager::ProcessAIUpdates()
             threat *= victimMgr._singleSchoolModifiers[SPELL_SCHOOL_ARCANE];
             break;
         default:
-        {
-            auto it = victimMgr._multiSchoolModifiers.find(mask);
-            if (it != victimMgr._multiSchoolModifiers.end())
-            {
-                threat *= it->second;
-                break;
-            }
-            float mod = victim->GetTotalAuraMultiplierByMiscMask(SPELL_AURA_MOD_THREAT, mask);
-            victimMgr._multiSchoolModifiers[mask] = mod;
-            threat *= mod;
+            threat *= victimMgr.GetMultiSchoolModifier(mask);
             break;
-        }
     }
     return threat;
 }
 
+float ThreatManager::GetMultiSchoolModifier(uint32 schoolMask) const
+{
+    for (uint32 i = 0; i < _multiSchoolModifierCount; ++i)
+        if (_multiSchoolModifiers[i].first == schoolMask)
+            return _multiSchoolModifiers[i].second;
+
+    float const mod = _owner->GetTotalAuraMultiplierByMiscMask(SPELL_AURA_MOD_THREAT, schoolMask);
+    // units only ever see a handful of distinct multi-school masks - anything past that is recalculated every time
+    if (_multiSchoolModifierCount < MAX_CACHED_MULTI_SCHOOL_MODIFIERS)
+        _multiSchoolModifiers[_multiSchoolModifierCount++] = { schoolMask, mod };
+    return mod;
+}
+
 void ThreatManager::ForwardThreatForAssistingMe(Unit* assistant, float baseAmount, SpellInfo const* spell, bool ignoreModifiers)
 {
     if (spell && (spell->HasAttribute(SPELL_ATTR1_NO_THREAT) || spell->HasAttribute(SPELL_ATTR4_NO_HELPFUL_THREAT))) // shortcut, none of the calls would do anything
@@ -705,9 +701,9 @@ void ThreatManager::UpdateMyTempModifiers()
     {
         it->second->_tempModifier = mod;
         if (isIncrease)
-            it->second->HeapNotifyIncreased();
+            it->second->ListNotifyIncreased();
         else
-            it->second->HeapNotifyDecreased();
+            it->second->ListNotifyDecreased();
     } while ((++it) != _threatenedByMe.end());
 }
 
@@ -715,7 +711,7 @@ void ThreatManager::UpdateMySpellSchoolModifiers()
 {
     for (uint8 i = 0; i < MAX_SPELL_SCHOOL; ++i)
         _singleSchoolModifiers[i] = _owner->GetTotalAuraMultiplierByMiscMask(SPELL_AURA_MOD_THREAT, 1 << i);
-    _multiSchoolModifiers.clear();
+    _multiSchoolModifierCount = 0;
 }
 
 void ThreatManager::RegisterRedirectThreat(uint32 spellId, ObjectGuid const& victim, uint32 pct)
@@ -808,20 +804,40 @@ void ThreatManager::SendThreatListToClients(bool newHighest) const
 void ThreatManager::PutThreatListRef(ObjectGuid const& guid, ThreatReference* ref)
 {
     _needClientUpdate = true;
-    auto& inMap = _myThreatListEntries[guid];
-    ASSERT(!inMap, "Duplicate threat reference at %p being inserted on %s for %s - memory leak!", ref, _owner->GetGUID().ToString().c_str(), guid.ToString().c_str());
-    inMap = ref;
-    ref->_handle = _sortedThreatList.push(ref);
+    ASSERT(!GetThreatListRef(guid), "Duplicate threat reference at %p being inserted on %s for %s - memory leak!", ref, _owner->GetGUID().ToString().c_str(), guid.ToString().c_str());
+    ref->_tableIndex = uint32(_myThreatListEntries.size());
+    _myThreatListEntries.push_back(ref);
+    _myThreatListGuids.push_back(guid);
+
+    ref->_sortedIndex = uint32(_sortedThreatList.size());
+    _sortedThreatList.push_back(ref);
+    SortedListNotifyIncreased(ref);
 }
 
 void ThreatManager::PurgeThreatListRef(ObjectGuid const& guid)
 {
-    auto it = _myThreatListEntries.find(guid);
-    if (it == _myThreatListEntries.end())
+    ThreatReference* ref = GetThreatListRef(guid);
+    if (!ref)
         return;
-    ThreatReference* ref = it->second;
-    _myThreatListEntries.erase(it);
-    _sortedThreatList.erase(ref->_handle);
+
+    // swap the last entry into the hole in the unsorted table
+    uint32 const tableIndex = ref->_tableIndex;
+    if (tableIndex + 1 != _myThreatListEntries.size())
+    {
+        _myThreatListEntries[tableIndex] = _myThreatListEntries.back();
+        _myThreatListGuids[tableIndex] = _myThreatListGuids.back();
+        _myThreatListEntries[tableIndex]->_tableIndex = tableIndex;
+    }
+    _myThreatListEntries.pop_back();
+    _myThreatListGuids.pop_back();
+
+    // the sorted list has to keep its order, so everything below moves up one place
+    for (uint32 i = ref->_sortedIndex; i + 1 < _sortedThreatList.size(); ++i)
+    {
+        _sortedThreatList[i] = _sortedThreatList[i + 1];
+        _sortedThreatList[i]->_sortedIndex = i;
+    }
+    _sortedThreatList.pop_back();
 
     if (_fixateRef == ref)
         _fixateRef = nullptr;
@@ -829,6 +845,41 @@ void ThreatManager::PurgeThreatListRef(ObjectGuid const& guid)
         _currentVictimRef = nullptr;
 }
 
+ThreatReference* ThreatManager::GetThreatListRef(ObjectGuid const& guid) const
+{
+    // threat lists are short enough for a linear scan over packed guids to beat hashing them
+    auto it = std::find(_myThreatListGuids.begin(), _myThreatListGuids.end(), guid);
+    if (it == _myThreatListGuids.end())
+        return nullptr;
+    return _myThreatListEntries[std::distance(_myThreatListGuids.begin(), it)];
+}
+
+void ThreatManager::SortedListNotifyIncreased(ThreatReference* ref)
+{
+    uint32 index = ref->_sortedIndex;
+    while (index > 0 && CompareThreat(_sortedThreatList[index - 1], ref))
+    {
+        _sortedThreatList[index] = _sortedThreatList[index - 1];
+        _sortedThreatList[index]->_sortedIndex = index;
+        --index;
+    }
+    _sortedThreatList[index] = ref;
+    ref->_sortedIndex = index;
+}
+
+void ThreatManager::SortedListNotifyDecreased(ThreatReference* ref)
+{
+    uint32 index = ref->_sortedIndex;
+    while (index + 1 < _sortedThreatList.size() && CompareThreat(ref, _sortedThreatList[index + 1]))
+    {
+        _sortedThreatList[index] = _sortedThreatList[index + 1];
+        _sortedThreatList[index]->_sortedIndex = index;
+        ++index;
+    }
+    _sortedThreatList[index] = ref;
+    ref->_sortedIndex = index;
+}
+
 void ThreatManager::PutThreatenedByMeRef(ObjectGuid const& guid, ThreatReference* ref)
 {
     auto& inMap = _threatenedByMe[guid];
@@ -845,7 +896,7 @@ void ThreatManager::PurgeThreatenedByMeRef(ObjectGuid const& guid)
 
 void ThreatManager::UpdateRedirectInfo()
 {
-    _redirectInfo.clear();
+    _redirectInfoCount = 0;
     uint32 totalPct = 0;
     for (auto const& pair : _redirectRegistry) // (spellid, victim -> pct)
         for (auto const& victimPair : pair.second) // (victim,pct)
@@ -853,7 +904,9 @@ void ThreatManager::UpdateRedirectInfo()
             uint32 thisPct = std::min<uint32>(100 - totalPct, victimPair.second);
             if (thisPct > 0)
             {
-                _redirectInfo.push_back({ victimPair.first, thisPct });
+                if (_redirectInfoCount >= MAX_THREAT_REDIRECTS)
+                    return;
+                _redirectInfo[_redirectInfoCount++] = { victimPair.first, thisPct };
                 totalPct += thisPct;
                 ASSERT(totalPct <= 100);
                 if (totalPct == 100)
@@ -22,7 +22,6 @@
 #include "IteratorPair.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
-#include <boost/heap/fibonacci_heap.hpp>
 #include <array>
 #include <unordered_map>
 #include <vector>
@@ -47,8 +46,9 @@ class SpellInfo;
  *  - Adding threat will also create a combat reference between the units if one doesn't exist yet (even if the owner can't have a threat list!)        *
  *  - Ending combat between two units will also delete any threat references that may exist between them.                                               *
  *                                                                                                                                                      *
- * To manage a creature's threat list, ThreatManager maintains a heap of threat reference const pointers.                                               *
- * This heap is kept well-structured in all methods that modify ThreatReference, and is used to select the next target.                                 *
+ * To manage a creature's threat list, ThreatManager maintains a contiguous table of its threat references, plus a vector of the same references        *
+ * that is kept sorted by threat. Threat lists are small, and a reference that changes usually only moves by a few places, so every method              *
+ * that modifies a ThreatReference moves it to its new place in the sorted vector incrementally. Iterating either list never allocates.                 *
  *                                                                                                                                                      *
  * Selection uses the following properties on ThreatReference, in order:                                                                                *
  * - Online state (one of ONLINE, SUPPRESSED, OFFLINE):                                                                                                 *
@@ -65,8 +65,8 @@ class SpellInfo;
  * The current (= last selected) victim can be accessed using GetCurrentVictim.                                                                         *
  * Beyond that, ThreatManager has a variety of helpers and notifiers, which are documented inline below.                                                *
  *                                                                                                                                                      *
- * SPECIAL NOTE: Please be aware that any iterator may be invalidated if you modify a ThreatReference. The heap holds const pointers for a reason, but  *
- *                 that doesn't mean you're scot free. A variety of actions (casting spells, teleporting units, and so forth) can cause changes to      *
+ * SPECIAL NOTE: Please be aware that any iterator may be invalidated if you modify a ThreatReference. The lists hand out const pointers for a reason,  *
+ *                 but that doesn't mean you're scot free. A variety of actions (casting spells, teleporting units, and so forth) can cause changes to  *
  *                 the threat list. Use with care - or default to GetModifiableThreatList(), which inherently copies entries.                           *
 \********************************************************************************************************************************************************/
 
@@ -81,9 +81,10 @@ struct CompareThreatLessThan
 class TC_GAME_API ThreatManager
 {
     public:
-        typedef boost::heap::fibonacci_heap<ThreatReference const*, boost::heap::compare<CompareThreatLessThan>> threat_list_heap;
         class ThreatListIterator;
         static const uint32 THREAT_UPDATE_INTERVAL = 1000u;
+        static const uint32 MAX_THREAT_REDIRECTS = 8u;
+        static const uint32 MAX_CACHED_MULTI_SCHOOL_MODIFIERS = 8u;
 
         static bool CanHaveThreatList(Unit const* who);
 
@@ -116,15 +117,17 @@ class TC_GAME_API ThreatManager
         // returns ThreatReference amount if a ref exists, 0.0f otherwise
         float GetThreat(Unit const* who, bool includeOffline = false) const;
         size_t GetThreatListSize() const { return _sortedThreatList.size(); }
-        // fastest of the three threat list getters - gets the threat list in "arbitrary" order
+        // gets the threat list in "arbitrary" order
         // iterators will invalidate on adding/removing entries from the threat list; slightly less finicky than GetSorted.
         Trinity::IteratorPair<ThreatListIterator> GetUnsortedThreatList() const { return { _myThreatListEntries.begin(), _myThreatListEntries.end() }; }
-        // slightly slower than GetUnsorted, but, well...sorted - only use it if you need the sorted property, of course
+        // just as cheap as GetUnsorted, but sorted by threat
         // this iterator pair will invalidate on any modification (even indirect) of the threat list; spell casts and similar can all induce this!
         // note: current tank is NOT guaranteed to be the first entry in this list - check GetLastVictim separately if you want that!
-        Trinity::IteratorPair<threat_list_heap::ordered_iterator> GetSortedThreatList() const { return { _sortedThreatList.ordered_begin(), _sortedThreatList.ordered_end() }; }
-        // slowest of the three threat list getters (by far), but lets you modify the threat references - this is also sorted
+        Trinity::IteratorPair<ThreatListIterator> GetSortedThreatList() const { return { _sortedThreatList.begin(), _sortedThreatList.end() }; }
+        // copies the sorted threat list, which lets you modify the threat references
         std::vector<ThreatReference*> GetModifiableThreatList();
+        // same as above, but copies into a caller provided buffer so callers running every update can reuse its storage
+        void GetModifiableThreatList(std::vector<ThreatReference*>& list) const;
 
         // does any unit have a threat list entry with victim == this.owner?
         bool IsThreateningAnyone(bool includeOffline = false) const;
@@ -186,6 +189,7 @@ class TC_GAME_API ThreatManager
         static const CompareThreatLessThan CompareThreat;
         static bool CompareReferencesLT(ThreatReference const* a, ThreatReference const* b, float aWeight);
         static float CalculateModifiedThreat(float threat, Unit const* victim, SpellInfo const* spell);
+        float GetMultiSchoolModifier(uint32 schoolMask) const;
 
         // send opcodes (all for my own threat list)
         void SendClearAllThreatToClients() const;
@@ -195,11 +199,16 @@ class TC_GAME_API ThreatManager
         ///== MY THREAT LIST ==
         void PutThreatListRef(ObjectGuid const& guid, ThreatReference* ref);
         void PurgeThreatListRef(ObjectGuid const& guid);
+        ThreatReference* GetThreatListRef(ObjectGuid const& guid) const;
+        // moves a reference to its new place in the sorted list after its threat, online or taunt state changed
+        void SortedListNotifyIncreased(ThreatReference* ref);
+        void SortedListNotifyDecreased(ThreatReference* ref);
 
         bool _needClientUpdate;
         uint32 _updateTimer;
-        threat_list_heap _sortedThreatList;
-        std::unordered_map<ObjectGuid, ThreatReference*> _myThreatListEntries;
+        std::vector<ThreatReference*> _sortedThreatList; // highest threat first
+        std::vector<ThreatReference*> _myThreatListEntries; // in insertion order, swap-removed
+        std::vector<ObjectGuid> _myThreatListGuids; // victim guids matching _myThreatListEntries by index, scanned for lookups
 
         // AI notifies are delayed to ensure we are in a consistent state before we call out to arbitrary logic
         // threat references might register themselves here when ::UpdateOffline() is called - MAKE SURE THIS IS PROCESSED JUST BEFORE YOU EXIT THREATMANAGER LOGIC
@@ -218,11 +227,13 @@ class TC_GAME_API ThreatManager
         void PurgeThreatenedByMeRef(ObjectGuid const& guid);
         std::unordered_map<ObjectGuid, ThreatReference*> _threatenedByMe; // these refs are entries for myself on other units' threat lists
         std::array<float, MAX_SPELL_SCHOOL> _singleSchoolModifiers; // most spells are single school - we pre-calculate these and store them
-        mutable std::unordered_map<std::underlying_type<SpellSchoolMask>::type, float> _multiSchoolModifiers; // these are calculated on demand
+        mutable std::array<std::pair<uint32, float>, MAX_CACHED_MULTI_SCHOOL_MODIFIERS> _multiSchoolModifiers; // (mask, modifier) - these are calculated on demand, any masks beyond the first few are not cached
+        mutable uint32 _multiSchoolModifierCount;
 
         // redirect system (is kind of dumb, but that's because none of the redirection spells actually have any aura effect associated with them, so spellscript needs to deal with it)
         void UpdateRedirectInfo();
-        std::vector<std::pair<ObjectGuid, uint32>> _redirectInfo; // current redirection targets and percentages (updated from registry in ThreatManager::UpdateRedirectInfo)
+        std::array<std::pair<ObjectGuid, uint32>, MAX_THREAT_REDIRECTS> _redirectInfo; // current redirection targets and percentages (updated from registry in ThreatManager::UpdateRedirectInfo)
+        uint32 _redirectInfoCount;
         std::unordered_map<uint32, std::unordered_map<ObjectGuid, uint32>> _redirectRegistry; // spellid -> (victim -> pct); all redirection effects on us (removal individually managed by spell scripts because blizzard is dumb)
 
     public:
@@ -235,8 +246,8 @@ class TC_GAME_API ThreatManager
                 decltype(_myThreatListEntries)::const_iterator _it;
 
             public:
-                ThreatReference const* operator*() const { return _it->second; }
-                ThreatReference const* operator->() const { return _it->second; }
+                ThreatReference const* operator*() const { return *_it; }
+                ThreatReference const* operator->() const { return *_it; }
                 ThreatListIterator& operator++() { ++_it; return *this; }
                 bool operator==(ThreatListIterator const& o) const { return _it == o._it; }
                 bool operator!=(ThreatListIterator const& o) const { return _it != o._it; }
@@ -279,7 +290,7 @@ class TC_GAME_API ThreatReference
 
         ThreatReference(ThreatManager* mgr, Unit* victim) :
             _owner(reinterpret_cast<Creature*>(mgr->_owner)), _mgr(*mgr), _victim(victim),
-            _baseAmount(0.0f), _tempModifier(0), _taunted(TAUNT_STATE_NONE)
+            _baseAmount(0.0f), _tempModifier(0), _taunted(TAUNT_STATE_NONE), _tableIndex(0), _sortedIndex(0)
         {
             _online = ONLINE_STATE_OFFLINE;
         }
@@ -291,14 +302,15 @@ class TC_GAME_API ThreatReference
         void UpdateTauntState(TauntState state = TAUNT_STATE_NONE);
         Creature* const _owner;
         ThreatManager& _mgr;
-        void HeapNotifyIncreased() { _mgr._sortedThreatList.increase(_handle); }
-        void HeapNotifyDecreased() { _mgr._sortedThreatList.decrease(_handle); }
+        void ListNotifyIncreased() { _mgr.SortedListNotifyIncreased(this); }
+        void ListNotifyDecreased() { _mgr.SortedListNotifyDecreased(this); }
         Unit* const _victim;
         OnlineState _online;
         float _baseAmount;
         int32 _tempModifier; // Temporary effects (auras with SPELL_AURA_MOD_TOTAL_THREAT) - set from victim's threatmanager in ThreatManager::UpdateMyTempModifiers
         TauntState _taunted;
-        ThreatManager::threat_list_heap::handle_type _handle;
+        uint32 _tableIndex; // position in the owner's _myThreatListEntries
+        uint32 _sortedIndex; // position in the owner's _sortedThreatList
 
     public:
         ThreatReference(ThreatReference const&) = delete;
@@ -21,7 +21,7 @@
 #include "ObjectGuid.h"
 #include "Position.h"
 
-struct MovementInfo
+struct TC_GAME_API MovementInfo
 {
     // common
     ObjectGuid guid;
@@ -44,6 +44,9 @@ bool PlayerSocial::AddToSocialList(ObjectGuid const& friendGuid, SocialFlag flag
     if (GetNumberOfSocialsWithFlag(flag) >= (((flag & SOCIAL_FLAG_FRIEND) != 0) ? SOCIALMGR_FRIEND_LIMIT : SOCIALMGR_IGNORE_LIMIT))
         return false;
 
+    if (flag & SOCIAL_FLAG_IGNORED)
+        sSocialMgr->AddIgnoredBy(friendGuid, GetPlayerGUID());
+
     PlayerSocialMap::iterator itr = _playerSocialMap.find(friendGuid);
     if (itr != _playerSocialMap.end())
     {
@@ -79,6 +82,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid const& friendGuid, SocialFlag
     if (itr == _playerSocialMap.end())
         return;
 
+    if (itr->second.Flags & flag & SOCIAL_FLAG_IGNORED)
+        sSocialMgr->RemoveIgnoredBy(friendGuid, GetPlayerGUID());
+
     itr->second.Flags &= ~flag;
 
     if (!itr->second.Flags)
@@ -318,9 +324,50 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid const
 
             uint8 flag = fields[1].GetUInt8();
             social->_playerSocialMap[friendGuid] = FriendInfo(flag, fields[2].GetString());
+
+            if (flag & SOCIAL_FLAG_IGNORED)
+                AddIgnoredBy(friendGuid, guid);
         }
         while (result->NextRow());
     }
 
     return social;
 }
+
+void SocialMgr::RemovePlayerSocial(ObjectGuid const& guid)
+{
+    SocialMap::iterator itr = _socialMap.find(guid);
+    if (itr == _socialMap.end())
+        return;
+
+    for (PlayerSocial::PlayerSocialMap::value_type const& contact : itr->second._playerSocialMap)
+        if (contact.second.Flags & SOCIAL_FLAG_IGNORED)
+            RemoveIgnoredBy(contact.first, guid);
+
+    _socialMap.erase(itr);
+}
+
+GuidUnorderedSet const* SocialMgr::GetIgnoredBy(ObjectGuid const& guid) const
+{
+    IgnoredByMap::const_iterator itr = _ignoredBy.find(guid);
+    if (itr == _ignoredBy.end())
+        return nullptr;
+
+    return &itr->second;
+}
+
+void SocialMgr::AddIgnoredBy(ObjectGuid const& ignored, ObjectGuid const& by)
+{
+    _ignoredBy[ignored].insert(by);
+}
+
+void SocialMgr::RemoveIgnoredBy(ObjectGuid const& ignored, ObjectGuid const& by)
+{
+    IgnoredByMap::iterator itr = _ignoredBy.find(ignored);
+    if (itr == _ignoredBy.end())
+        return;
+
+    itr->second.erase(by);
+    if (itr->second.empty())
+        _ignoredBy.erase(itr);
+}
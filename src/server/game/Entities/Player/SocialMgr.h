@@ -22,6 +22,7 @@
 #include "Common.h"
 #include "ObjectGuid.h"
 #include <map>
+#include <unordered_map>
 
 class Player;
 class WorldPacket;
@@ -140,7 +141,9 @@ class SocialMgr
         static SocialMgr* instance();
 
         // Misc
-        void RemovePlayerSocial(ObjectGuid const& guid) { _socialMap.erase(guid); }
+        void RemovePlayerSocial(ObjectGuid const& guid);
+        /// Online players that have the given player on their ignore list, nullptr if there are none
+        GuidUnorderedSet const* GetIgnoredBy(ObjectGuid const& guid) const;
 
         static void GetFriendInfo(Player* player, ObjectGuid const& friendGUID, FriendInfo& friendInfo);
 
@@ -152,8 +155,17 @@ class SocialMgr
         PlayerSocial* LoadFromDB(PreparedQueryResult result, ObjectGuid const& guid);
 
     private:
+        friend class PlayerSocial;
+
+        // reverse ignore index, kept in sync with the ignore flags of loaded socials
+        void AddIgnoredBy(ObjectGuid const& ignored, ObjectGuid const& by);
+        void RemoveIgnoredBy(ObjectGuid const& ignored, ObjectGuid const& by);
+
         typedef std::map<ObjectGuid, PlayerSocial> SocialMap;
         SocialMap _socialMap;
+
+        typedef std::unordered_map<ObjectGuid, GuidUnorderedSet> IgnoredByMap;
+        IgnoredByMap _ignoredBy;
 };
 
 #define sSocialMgr SocialMgr::instance()
@@ -28,6 +28,7 @@
 #include "ChatTextBuilder.h"
 #include "ChatPackets.h"
 #include "CombatLogPackets.h"
+#include "CombatLogQueue.h"
 #include "CombatPackets.h"
 #include "Common.h"
 #include "ConditionMgr.h"
@@ -45,11 +46,13 @@
 #include "Log.h"
 #include "LootMgr.h"
 #include "LootPackets.h"
+#include "MapSpatialIndex.h"
 #include "MiscPackets.h"
 #include "MotionMaster.h"
 #include "MovementGenerator.h"
 #include "MovementPackets.h"
 #include "MovementPacketBuilder.h"
+#include "MovementRelay.h"
 #include "MovementStructures.h"
 #include "MoveSpline.h"
 #include "MoveSplineInit.h"
@@ -5010,9 +5013,27 @@ void Unit::RemoveAllGameObjects()
     }
 }
 
+CombatLogQueue* Unit::GetMapCombatLogQueue() const
+{
+    return IsInWorld() ? GetMap()->GetCombatLogQueue() : nullptr;
+}
+
 void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage* log)
 {
+    if (CombatLogQueue* combatLogQueue = GetMapCombatLogQueue())
+    {
+        BuildSpellNonMeleeDamageLog(combatLogQueue->BeginPacket(this, SMSG_SPELLNONMELEEDAMAGELOG), log);
+        combatLogQueue->EndPacket();
+        return;
+    }
+
     WorldPacket data(SMSG_SPELLNONMELEEDAMAGELOG, (16+4+4+4+1+4+4+1+1+4+4+1)); // we guess size
+    BuildSpellNonMeleeDamageLog(data, log);
+    SendMessageToSet(&data, true);
+}
+
+/*static*/ void Unit::BuildSpellNonMeleeDamageLog(ByteBuffer& data, SpellNonMeleeDamage const* log)
+{
     data << log->target->GetPackGUID();
     data << log->attacker->GetPackGUID();
     data << uint32(log->SpellID);
@@ -5046,7 +5067,6 @@ void Unit::SendSpellNonMeleeDamageLog(SpellNonMeleeDamage* log)
     //    data << float(log->GlanceChance);
     //    data << float(log->CrushChance);
     //}
-    SendMessageToSet(&data, true);
 }
 
 void Unit::SendSpellNonMeleeDamageLog(Unit* target, uint32 spellID, uint32 damage, SpellSchoolMask damageSchoolMask, uint32 absorbedDamage, uint32 resist, bool isPeriodic, uint32 blocked, bool criticalHit, bool split)
@@ -5093,12 +5113,7 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo)
 {
     AuraEffect const* aura = pInfo->auraEff;
 
-    WorldPackets::CombatLog::SpellPeriodicAuraLog periodicAuraLog;
-    periodicAuraLog.TargetGUID = GetGUID();
-    periodicAuraLog.CasterGUID = aura->GetCasterGUID();
-    periodicAuraLog.SpellID = aura->GetId();
-
-    WorldPackets::CombatLog::PeriodicAuraLogEffect& logEffect = periodicAuraLog.Entries.emplace_back();
+    WorldPackets::CombatLog::PeriodicAuraLogEffect logEffect;
     logEffect.Effect = aura->GetAuraType();
     logEffect.Amount = pInfo->damage;
     logEffect.OverHealOrKill = pInfo->overDamage;
@@ -5129,6 +5144,18 @@ void Unit::SendPeriodicAuraLog(SpellPeriodicAuraLogInfo* pInfo)
             return;
     }
 
+    if (CombatLogQueue* combatLogQueue = GetMapCombatLogQueue())
+    {
+        combatLogQueue->QueuePeriodicAuraLog(this, GetGUID(), aura->GetCasterGUID(), aura->GetId(), logEffect);
+        return;
+    }
+
+    WorldPackets::CombatLog::SpellPeriodicAuraLog periodicAuraLog;
+    periodicAuraLog.TargetGUID = GetGUID();
+    periodicAuraLog.CasterGUID = aura->GetCasterGUID();
+    periodicAuraLog.SpellID = aura->GetId();
+    periodicAuraLog.Entries.push_back(logEffect);
+
     SendMessageToSet(periodicAuraLog.Write(), true);
 }
 
@@ -5154,7 +5181,10 @@ void Unit::SendSpellDamageImmune(Unit* target, uint32 spellId)
 
 void Unit::SendAttackStateUpdate(CalcDamageInfo* damageInfo)
 {
-    WorldPackets::CombatLog::AttackerStateUpdate packet;
+    CombatLogQueue* combatLogQueue = GetMapCombatLogQueue();
+
+    // queued packets are written straight to the queue, don't reserve a buffer of their own
+    WorldPackets::CombatLog::AttackerStateUpdate packet(combatLogQueue ? 0 : 62);
     packet.HitInfo = damageInfo->HitInfo;
     packet.AttackerGUID = damageInfo->Attacker->GetGUID();
     packet.VictimGUID = damageInfo->Target->GetGUID();
@@ -5176,6 +5206,13 @@ void Unit::SendAttackStateUpdate(CalcDamageInfo* damageInfo)
     packet.BlockAmount = damageInfo->Blocked;
     packet.RageGained = damageInfo->RageGained;
 
+    if (combatLogQueue)
+    {
+        packet.WritePayload(combatLogQueue->BeginPacket(this, SMSG_ATTACKER_STATE_UPDATE));
+        combatLogQueue->EndPacket();
+        return;
+    }
+
     SendMessageToSet(packet.Write(), true);
 }
 
@@ -6181,8 +6218,21 @@ void Unit::UnsummonAllTotems()
 
 void Unit::SendHealSpellLog(HealInfo& healInfo, bool critical /*= false*/)
 {
+    if (CombatLogQueue* combatLogQueue = GetMapCombatLogQueue())
+    {
+        BuildHealSpellLog(combatLogQueue->BeginPacket(this, SMSG_SPELLHEALLOG), healInfo, critical);
+        combatLogQueue->EndPacket();
+        return;
+    }
+
     // we guess size
     WorldPacket data(SMSG_SPELLHEALLOG, 8 + 8 + 4 + 4 + 4 + 4 + 1 + 1);
+    BuildHealSpellLog(data, healInfo, critical);
+    SendMessageToSet(&data, true);
+}
+
+/*static*/ void Unit::BuildHealSpellLog(ByteBuffer& data, HealInfo const& healInfo, bool critical)
+{
     data << healInfo.GetTarget()->GetPackGUID();
     data << healInfo.GetHealer()->GetPackGUID();
     data << uint32(healInfo.GetSpellInfo()->Id);
@@ -6191,7 +6241,6 @@ void Unit::SendHealSpellLog(HealInfo& healInfo, bool critical /*= false*/)
     data << uint32(healInfo.GetAbsorb()); // Absorb amount
     data << uint8(critical ? 1 : 0);
     data << uint8(0); // unused
-    SendMessageToSet(&data, true);
 }
 
 int32 Unit::HealBySpell(HealInfo& healInfo, bool critical /*= false*/)
@@ -9552,6 +9601,9 @@ void Unit::AddToWorld()
 {
     WorldObject::AddToWorld();
 
+    if (MapSpatialIndex* spatialIndex = GetMap()->GetSpatialIndex())
+        spatialIndex->Insert(this);
+
     RemoveAurasWithInterruptFlags(SpellAuraInterruptFlags::EnterWorld);
 }
 
@@ -9562,6 +9614,13 @@ void Unit::RemoveFromWorld()
 
     if (IsInWorld())
     {
+        // queued combat log packets may still have us as their source
+        if (CombatLogQueue* combatLogQueue = GetMap()->GetCombatLogQueue())
+            combatLogQueue->Flush();
+
+        if (MovementRelay* movementRelay = GetMap()->GetMovementRelay())
+            movementRelay->RemoveMover(this);
+
         m_duringRemoveFromWorld = true;
         if (UnitAI* ai = GetAI())
             ai->LeavingWorld();
@@ -9602,6 +9661,9 @@ void Unit::RemoveFromWorld()
             }
         }
 
+        if (MapSpatialIndex* spatialIndex = GetMap()->GetSpatialIndex())
+            spatialIndex->Remove(this);
+
         WorldObject::RemoveFromWorld();
         m_duringRemoveFromWorld = false;
     }
@@ -11074,11 +11136,18 @@ void Unit::PlayOneShotAnimKitId(uint16 animKitId)
             Loot* loot = &creature->loot;
             loot->clear();
 
-            if (uint32 lootid = creature->GetCreatureTemplate()->lootid)
-                loot->FillLoot(lootid, LootTemplates_Creature, looter, false, false, creature->GetLootMode());
+            CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate();
+            // master looters are told at death whether the loot has items over the threshold, so it can't wait
+            if (sWorld->getBoolConfig(CONFIG_CORPSE_LAZY_LOOT) && (!group || group->GetLootMethod() != MASTER_LOOT))
+                loot->DeferCreatureLoot(creatureTemplate->lootid, creature->GetLootMode(), creatureTemplate->mingold, creatureTemplate->maxgold, looter);
+            else
+            {
+                if (uint32 lootid = creatureTemplate->lootid)
+                    loot->FillLoot(lootid, LootTemplates_Creature, looter, false, false, creature->GetLootMode());
 
-            if (creature->GetLootMode() > 0)
-                loot->generateMoneyLoot(creature->GetCreatureTemplate()->mingold, creature->GetCreatureTemplate()->maxgold);
+                if (creature->GetLootMode() > 0)
+                    loot->generateMoneyLoot(creatureTemplate->mingold, creatureTemplate->maxgold);
+            }
 
             if (group)
             {
@@ -13000,227 +13069,31 @@ void Unit::NearTeleportTo(Position const& pos, bool casting /*= false*/)
 
 void Unit::WriteMovementInfo(WorldPacket& data, Movement::ExtraMovementStatusElement* extras /*= nullptr*/, uint32* movementCounter /*= nullptr*/)
 {
-    MovementInfo const& mi = m_movementInfo;
-
-    bool hasMovementFlags = GetUnitMovementFlags() != 0;
-    bool hasMovementFlags2 = GetExtraUnitMovementFlags() != 0;
-    bool hasTimestamp = true;
-    bool hasOrientation = !G3D::fuzzyEq(GetOrientation(), 0.0f);
-    bool hasTransportData = GetTransGUID() != 0;
-    bool hasSpline = IsSplineEnabled();
-
-    bool hasTransportTime2 = hasTransportData && m_movementInfo.transport.time2 != 0;
-    bool hasTransportVehicleId = hasTransportData && m_movementInfo.transport.vehicleId != 0;
-    bool hasPitch = HasUnitMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || HasExtraUnitMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
-    bool hasFallDirection = HasUnitMovementFlag(MOVEMENTFLAG_FALLING);
-    bool hasFallData = hasFallDirection || m_movementInfo.jump.fallTime != 0;
-    bool hasSplineElevation = HasUnitMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
-
-    MovementStatusElements const* sequence = GetMovementStatusElementsSequence(static_cast<OpcodeClient>(data.GetOpcode()));
+    Movement::MovementStatusSequence const* sequence = GetMovementStatusSequence(static_cast<OpcodeClient>(data.GetOpcode()));
     if (!sequence)
     {
         TC_LOG_ERROR("network", "Unit::WriteMovementInfo: No movement sequence found for opcode %s", GetOpcodeNameForLogging(static_cast<OpcodeClient>(data.GetOpcode())).c_str());
         return;
     }
 
-    ObjectGuid guid = GetGUID();
-    ObjectGuid tguid = hasTransportData ? GetTransGUID() : ObjectGuid::Empty;
-
-    for (; *sequence != MSEEnd; ++sequence)
-    {
-        MovementStatusElements const& element = *sequence;
-
-        switch (element)
-        {
-            case MSEHasGuidByte0:
-            case MSEHasGuidByte1:
-            case MSEHasGuidByte2:
-            case MSEHasGuidByte3:
-            case MSEHasGuidByte4:
-            case MSEHasGuidByte5:
-            case MSEHasGuidByte6:
-            case MSEHasGuidByte7:
-                data.WriteBit(guid[element - MSEHasGuidByte0]);
-                break;
-            case MSEHasTransportGuidByte0:
-            case MSEHasTransportGuidByte1:
-            case MSEHasTransportGuidByte2:
-            case MSEHasTransportGuidByte3:
-            case MSEHasTransportGuidByte4:
-            case MSEHasTransportGuidByte5:
-            case MSEHasTransportGuidByte6:
-            case MSEHasTransportGuidByte7:
-                if (hasTransportData)
-                    data.WriteBit(tguid[element - MSEHasTransportGuidByte0]);
-                break;
-            case MSEGuidByte0:
-            case MSEGuidByte1:
-            case MSEGuidByte2:
-            case MSEGuidByte3:
-            case MSEGuidByte4:
-            case MSEGuidByte5:
-            case MSEGuidByte6:
-            case MSEGuidByte7:
-                data.WriteByteSeq(guid[element - MSEGuidByte0]);
-                break;
-            case MSETransportGuidByte0:
-            case MSETransportGuidByte1:
-            case MSETransportGuidByte2:
-            case MSETransportGuidByte3:
-            case MSETransportGuidByte4:
-            case MSETransportGuidByte5:
-            case MSETransportGuidByte6:
-            case MSETransportGuidByte7:
-                if (hasTransportData)
-                    data.WriteByteSeq(tguid[element - MSETransportGuidByte0]);
-                break;
-            case MSEHasMovementFlags:
-                data.WriteBit(!hasMovementFlags);
-                break;
-            case MSEHasMovementFlags2:
-                data.WriteBit(!hasMovementFlags2);
-                break;
-            case MSEHasTimestamp:
-                data.WriteBit(!hasTimestamp);
-                break;
-            case MSEHasOrientation:
-                data.WriteBit(!hasOrientation);
-                break;
-            case MSEHasTransportData:
-                data.WriteBit(hasTransportData);
-                break;
-            case MSEHasTransportTime2:
-                if (hasTransportData)
-                    data.WriteBit(hasTransportTime2);
-                break;
-            case MSEHasVehicleId:
-                if (hasTransportData)
-                    data.WriteBit(hasTransportVehicleId);
-                break;
-            case MSEHasPitch:
-                data.WriteBit(!hasPitch);
-                break;
-            case MSEHasFallData:
-                data.WriteBit(hasFallData);
-                break;
-            case MSEHasFallDirection:
-                if (hasFallData)
-                    data.WriteBit(hasFallDirection);
-                break;
-            case MSEHasSplineElevation:
-                data.WriteBit(!hasSplineElevation);
-                break;
-            case MSEHasSpline:
-                data.WriteBit(hasSpline);
-                break;
-            case MSEHasHeightChangeFailed:
-                data.WriteBit(mi.HasHeightChangeFailed());
-                break;
-            case MSEMovementFlags:
-                if (hasMovementFlags)
-                    data.WriteBits(GetUnitMovementFlags(), 30);
-                break;
-            case MSEMovementFlags2:
-                if (hasMovementFlags2)
-                    data.WriteBits(GetExtraUnitMovementFlags(), 12);
-                break;
-            case MSETimestamp:
-                if (hasTimestamp)
-                    data << mi.time;
-                break;
-            case MSEPositionX:
-                data << GetPositionX();
-                break;
-            case MSEPositionY:
-                data << GetPositionY();
-                break;
-            case MSEPositionZ:
-                data << GetPositionZ();
-                break;
-            case MSEOrientation:
-                if (hasOrientation)
-                    data << GetOrientation();
-                break;
-            case MSETransportPositionX:
-                if (hasTransportData)
-                    data << GetTransOffsetX();
-                break;
-            case MSETransportPositionY:
-                if (hasTransportData)
-                    data << GetTransOffsetY();
-                break;
-            case MSETransportPositionZ:
-                if (hasTransportData)
-                    data << GetTransOffsetZ();
-                break;
-            case MSETransportOrientation:
-                if (hasTransportData)
-                    data << GetTransOffsetO();
-                break;
-            case MSETransportSeat:
-                if (hasTransportData)
-                    data << GetTransSeat();
-                break;
-            case MSETransportTime:
-                if (hasTransportData)
-                    data << GetTransTime();
-                break;
-            case MSETransportTime2:
-                if (hasTransportData && hasTransportTime2)
-                    data << mi.transport.time2;
-                break;
-            case MSETransportVehicleId:
-                if (hasTransportData && hasTransportVehicleId)
-                    data << mi.transport.vehicleId;
-                break;
-            case MSEPitch:
-                if (hasPitch)
-                    data << mi.pitch;
-                break;
-            case MSEFallTime:
-                if (hasFallData)
-                    data << mi.jump.fallTime;
-                break;
-            case MSEFallVerticalSpeed:
-                if (hasFallData)
-                    data << mi.jump.zspeed;
-                break;
-            case MSEFallCosAngle:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.cosAngle;
-                break;
-            case MSEFallSinAngle:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.sinAngle;
-                break;
-            case MSEFallHorizontalSpeed:
-                if (hasFallData && hasFallDirection)
-                    data << mi.jump.xyspeed;
-                break;
-            case MSESplineElevation:
-                if (hasSplineElevation)
-                    data << mi.splineElevation;
-                break;
-            case MSECounter:
-                data << uint32(movementCounter ? *movementCounter : 0);
-                break;
-            case MSEZeroBit:
-                data.WriteBit(0);
-                break;
-            case MSEOneBit:
-                data.WriteBit(1);
-                break;
-            case MSEFlushBits:
-                data.FlushBits();
-                break;
-            case MSEExtraElement:
-                extras->WriteNextElement(data);
-                break;
-            default:
-                ASSERT(Movement::PrintInvalidSequenceElement(element, __FUNCTION__));
-                break;
-        }
-    }
+    Movement::MovementStatusWriter writer(data, m_movementInfo, *this, extras);
+    writer.HasMovementFlags = GetUnitMovementFlags() != 0;
+    writer.HasMovementFlags2 = GetExtraUnitMovementFlags() != 0;
+    writer.HasTimestamp = true;
+    writer.HasOrientation = !G3D::fuzzyEq(GetOrientation(), 0.0f);
+    writer.HasTransportData = GetTransGUID() != 0;
+    writer.HasSpline = IsSplineEnabled();
+    writer.HasTransportTime2 = writer.HasTransportData && m_movementInfo.transport.time2 != 0;
+    writer.HasTransportVehicleId = writer.HasTransportData && m_movementInfo.transport.vehicleId != 0;
+    writer.HasPitch = HasUnitMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || HasExtraUnitMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
+    writer.HasFallDirection = HasUnitMovementFlag(MOVEMENTFLAG_FALLING);
+    writer.HasFallData = writer.HasFallDirection || m_movementInfo.jump.fallTime != 0;
+    writer.HasSplineElevation = HasUnitMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
+    writer.Guid = GetGUID();
+    writer.TransportGuid = writer.HasTransportData ? GetTransGUID() : ObjectGuid::Empty;
+    writer.MovementCounter = movementCounter ? *movementCounter : 0;
+
+    sequence->Write(writer);
 }
 
 void Unit::SendTeleportPacket(Position const& pos)
@@ -72,6 +72,7 @@ struct SpellValue;
 class Aura;
 class AuraApplication;
 class AuraEffect;
+class CombatLogQueue;
 class Creature;
 class DynamicObject;
 class GameClient;
@@ -1878,6 +1879,11 @@ class TC_GAME_API Unit : public WorldObject
 
         void ProcSkillsAndReactives(bool isVictim, Unit* procTarget, uint32 typeMask, uint32 hitMask, WeaponAttackType attType);
 
+        // combat log packets are queued on the map instead of being sent right away if it batches them
+        CombatLogQueue* GetMapCombatLogQueue() const;
+        static void BuildSpellNonMeleeDamageLog(ByteBuffer& data, SpellNonMeleeDamage const* log);
+        static void BuildHealSpellLog(ByteBuffer& data, HealInfo const& healInfo, bool critical);
+
     protected:
         void SetFeared(bool apply);
         void SetConfused(bool apply);
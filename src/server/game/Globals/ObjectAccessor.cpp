@@ -29,6 +29,65 @@
 #include "Player.h"
 #include "Transport.h"
 #include "World.h"
+#include <array>
+
+namespace
+{
+// Global player lookups are made from every map thread at once. Each key only locks the shard it
+// hashes to, so readers looking up different players do not bounce a single reader count cache line
+template<class Key, class Hash = std::hash<Key>>
+class ShardedPlayerMap
+{
+public:
+    static constexpr std::size_t SHARD_COUNT = 64;
+
+    void Insert(Key const& key, Player* player)
+    {
+        Shard& shard = GetShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Players[key] = player;
+    }
+
+    void Remove(Key const& key)
+    {
+        Shard& shard = GetShard(key);
+        std::unique_lock<std::shared_mutex> lock(shard.Lock);
+        shard.Players.erase(key);
+    }
+
+    Player* Find(Key const& key)
+    {
+        Shard& shard = GetShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.Lock);
+        auto itr = shard.Players.find(key);
+        return itr != shard.Players.end() ? itr->second : nullptr;
+    }
+
+private:
+    struct alignas(64) Shard
+    {
+        std::shared_mutex Lock;
+        std::unordered_map<Key, Player*, Hash> Players;
+    };
+
+    Shard& GetShard(Key const& key)
+    {
+        // mix the high bits in, sequential guid counters would otherwise only use the low ones
+        std::size_t hash = Hash()(key);
+        hash ^= hash >> 17;
+        hash *= UI64LIT(0x9E3779B97F4A7C15);
+        return _shards[(hash >> 32) & (SHARD_COUNT - 1)];
+    }
+
+    std::array<Shard, SHARD_COUNT> _shards;
+};
+
+ShardedPlayerMap<ObjectGuid>& GetPlayerGuidShards()
+{
+    static ShardedPlayerMap<ObjectGuid> _shards;
+    return _shards;
+}
+}
 
 template<class T>
 void HashMapHolder<T>::Insert(T* o)
@@ -36,26 +95,27 @@ void HashMapHolder<T>::Insert(T* o)
     static_assert(std::is_same<Player, T>::value,
         "Only Player can be registered in global HashMapHolder");
 
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
+    {
+        std::unique_lock<std::shared_mutex> lock(*GetLock());
+        GetContainer()[o->GetGUID()] = o;
+    }
 
-    GetContainer()[o->GetGUID()] = o;
+    GetPlayerGuidShards().Insert(o->GetGUID(), o);
 }
 
 template<class T>
 void HashMapHolder<T>::Remove(T* o)
 {
-    std::unique_lock<std::shared_mutex> lock(*GetLock());
+    GetPlayerGuidShards().Remove(o->GetGUID());
 
+    std::unique_lock<std::shared_mutex> lock(*GetLock());
     GetContainer().erase(o->GetGUID());
 }
 
 template<class T>
 T* HashMapHolder<T>::Find(ObjectGuid guid)
 {
-    std::shared_lock<std::shared_mutex> lock(*GetLock());
-
-    typename MapType::iterator itr = GetContainer().find(guid);
-    return (itr != GetContainer().end()) ? itr->second : nullptr;
+    return GetPlayerGuidShards().Find(guid);
 }
 
 template<class T>
@@ -81,17 +141,16 @@ template class TC_GAME_API HashMapHolder<Player>;
 
 namespace PlayerNameMapHolder
 {
-typedef std::unordered_map<std::string, Player*> MapType;
-static MapType PlayerNameMap;
+static ShardedPlayerMap<std::string> PlayerNameMap;
 
 void Insert(Player* p)
 {
-    PlayerNameMap[p->GetName()] = p;
+    PlayerNameMap.Insert(p->GetName(), p);
 }
 
 void Remove(Player* p)
 {
-    PlayerNameMap.erase(p->GetName());
+    PlayerNameMap.Remove(p->GetName());
 }
 
 Player* Find(std::string const& name)
@@ -100,8 +159,7 @@ Player* Find(std::string const& name)
     if (!normalizePlayerName(charName))
         return nullptr;
 
-    auto itr = PlayerNameMap.find(charName);
-    return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
+    return PlayerNameMap.Find(charName);
 }
 } // namespace PlayerNameMapHolder
 
@@ -49,8 +49,10 @@ public:
 
     static void Remove(T* o);
 
+    // does not take the container lock, lookups are served by a sharded index
     static T* Find(ObjectGuid guid);
 
+    // only needed to iterate all players, lookups should use Find
     static MapType& GetContainer();
 
     static std::shared_mutex* GetLock();
@@ -5840,10 +5840,18 @@ void ObjectMgr::LoadNpcTextLocales()
     TC_LOG_INFO("server.loading", ">> Loaded %u NpcText locale strings in %u ms", uint32(_npcTextLocaleStore.size()), GetMSTimeDiffToNow(oldMSTime));
 }
 
-//not very fast function but it is called only once a day, or on starting-up
+void ObjectMgr::ProcessQueryCallbacks()
+{
+    _queryProcessor.ProcessReadyCallbacks();
+}
+
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
-    uint32 oldMSTime = getMSTime();
+    if (_expiredMailPass)
+    {
+        TC_LOG_INFO("misc", "Returning mails: previous pass is still running, skipped.");
+        return;
+    }
 
     time_t curTime = GameTime::GetGameTime();
     tm lt;
@@ -5858,112 +5866,183 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         stmt->setUInt64(0, basetime);
         CharacterDatabase.Execute(stmt);
     }
+
+    _expiredMailPass.emplace();
+    _expiredMailPass->BaseTime = basetime;
+    _expiredMailPass->StartTime = getMSTime();
+    _expiredMailPass->LastMailID = 0;
+    _expiredMailPass->Deleted = 0;
+    _expiredMailPass->Returned = 0;
+    _expiredMailPass->ServerUp = serverUp;
+
+    if (serverUp)
+    {
+        QueryNextExpiredMailBatch();
+        return;
+    }
+
+    while (LoadExpiredMailBatch(CharacterDatabase.Query(GetExpiredMailBatchStatement())))
+    {
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+        stmt->setUInt32(0, _expiredMailPass->LastMailID);
+        stmt->setUInt32(1, _expiredMailPass->Batch.back().MessageID);
+        ProcessExpiredMailBatch(CharacterDatabase.Query(stmt));
+    }
+
+    FinishExpiredMailPass();
+}
+
+CharacterDatabasePreparedStatement* ObjectMgr::GetExpiredMailBatchStatement() const
+{
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
-    stmt->setUInt64(0, basetime);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
+    stmt->setUInt64(0, _expiredMailPass->BaseTime);
+    stmt->setUInt32(1, _expiredMailPass->LastMailID);
+    stmt->setUInt32(2, sWorld->getIntConfig(CONFIG_CLEAN_OLD_MAIL_BATCH_SIZE));
+    return stmt;
+}
+
+bool ObjectMgr::LoadExpiredMailBatch(PreparedQueryResult result)
+{
+    _expiredMailPass->Batch.clear();
     if (!result)
+        return false;
+
+    do
     {
-        TC_LOG_INFO("server.loading", ">> No expired mails found.");
-        return;                                             // any mails need to be returned or deleted
-    }
+        Field* fields = result->Fetch();
+        ExpiredMail& mail = _expiredMailPass->Batch.emplace_back();
+        mail.MessageID   = fields[0].GetUInt32();
+        mail.MessageType = fields[1].GetUInt8();
+        mail.Sender      = fields[2].GetUInt32();
+        mail.Receiver    = fields[3].GetUInt32();
+        mail.HasItems    = fields[4].GetBool();
+        mail.Checked     = fields[5].GetUInt8();
+    } while (result->NextRow());
+
+    return true;
+}
 
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->setUInt32(0, (uint32)basetime);
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
+void ObjectMgr::ProcessExpiredMailBatch(PreparedQueryResult items)
+{
+    ExpiredMailPass& pass = *_expiredMailPass;
+
+    std::unordered_map<uint32 /*messageId*/, std::vector<ObjectGuid::LowType>> itemsCache;
+    if (items)
     {
-        MailItemInfo item;
         do
         {
             Field* fields = items->Fetch();
-            item.item_guid = fields[0].GetUInt32();
-            item.item_template = fields[1].GetUInt32();
-            uint32 mailId = fields[2].GetUInt32();
-            itemsCache[mailId].push_back(item);
+            itemsCache[fields[1].GetUInt32()].push_back(fields[0].GetUInt32());
         } while (items->NextRow());
     }
 
     uint32 deletedCount = 0;
     uint32 returnedCount = 0;
-    do
+    uint32 skippedCount = 0;
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    for (ExpiredMail const& mail : pass.Batch)
     {
-        Field* fields = result->Fetch();
-        ObjectGuid::LowType receiver = fields[3].GetUInt32();
-        if (serverUp && ObjectAccessor::FindConnectedPlayer(ObjectGuid(HighGuid::Player, receiver)))
+        if (pass.ServerUp && ObjectAccessor::FindConnectedPlayer(ObjectGuid(HighGuid::Player, mail.Receiver)))
+        {
+            ++skippedCount;
             continue;
-
-        Mail* m = new Mail;
-        m->messageID      = fields[0].GetUInt32();
-        m->messageType    = fields[1].GetUInt8();
-        m->sender         = fields[2].GetUInt32();
-        m->receiver       = receiver;
-        bool has_items    = fields[4].GetBool();
-        m->expire_time    = time_t(fields[5].GetUInt32());
-        m->deliver_time   = 0;
-        m->COD            = fields[6].GetUInt64();
-        m->checked        = fields[7].GetUInt8();
-        m->mailTemplateId = fields[8].GetInt16();
+        }
 
         // Delete or return mail
-        if (has_items)
+        if (mail.HasItems)
         {
-            // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
+            std::vector<ObjectGuid::LowType> const& mailItems = itemsCache[mail.MessageID];
 
             // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
+            if (mail.MessageType != MAIL_NORMAL || (mail.Checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
             {
                 // mail open and then not returned
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+                for (ObjectGuid::LowType itemGuid : mailItems)
                 {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
-                    stmt->setUInt32(0, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
+                    stmt->setUInt32(0, itemGuid);
+                    trans->Append(stmt);
                 }
 
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
-                stmt->setUInt32(0, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
+                stmt->setUInt32(0, mail.MessageID);
+                trans->Append(stmt);
             }
             else
             {
                 // Mail will be returned
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->setUInt32(0, m->receiver);
-                stmt->setUInt32(1, m->sender);
-                stmt->setUInt32(2, basetime + 30 * DAY);
-                stmt->setUInt32(3, basetime);
+                CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
+                stmt->setUInt32(0, mail.Receiver);
+                stmt->setUInt32(1, mail.Sender);
+                stmt->setUInt32(2, pass.BaseTime + 30 * DAY);
+                stmt->setUInt32(3, pass.BaseTime);
                 stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->setUInt32(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
+                stmt->setUInt32(5, mail.MessageID);
+                trans->Append(stmt);
+                for (ObjectGuid::LowType itemGuid : mailItems)
                 {
                     // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    stmt->setUInt32(0, mail.Sender);
+                    stmt->setUInt32(1, itemGuid);
+                    trans->Append(stmt);
 
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    stmt->setUInt32(0, mail.Sender);
+                    stmt->setUInt32(1, itemGuid);
+                    trans->Append(stmt);
                 }
-                delete m;
                 ++returnedCount;
                 continue;
             }
         }
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
-        delete m;
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
+        stmt->setUInt32(0, mail.MessageID);
+        trans->Append(stmt);
         ++deletedCount;
     }
-    while (result->NextRow());
 
-    TC_LOG_INFO("server.loading", ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    CharacterDatabase.CommitTransaction(trans);
+
+    pass.LastMailID = pass.Batch.back().MessageID;
+    pass.Deleted += deletedCount;
+    pass.Returned += returnedCount;
+
+    ++_expiredMailStatistics.Batches;
+    _expiredMailStatistics.Deleted += deletedCount;
+    _expiredMailStatistics.Returned += returnedCount;
+    _expiredMailStatistics.Skipped += skippedCount;
+}
+
+void ObjectMgr::QueryNextExpiredMailBatch()
+{
+    _queryProcessor.AddCallback(CharacterDatabase.AsyncQuery(GetExpiredMailBatchStatement())
+        .WithChainingPreparedCallback([this](QueryCallback& queryCallback, PreparedQueryResult result)
+    {
+        if (!LoadExpiredMailBatch(std::move(result)))
+        {
+            FinishExpiredMailPass();
+            return;
+        }
+
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+        stmt->setUInt32(0, _expiredMailPass->LastMailID);
+        stmt->setUInt32(1, _expiredMailPass->Batch.back().MessageID);
+        queryCallback.SetNextQuery(CharacterDatabase.AsyncQuery(stmt));
+    })
+        .WithPreparedCallback([this](PreparedQueryResult items)
+    {
+        ProcessExpiredMailBatch(std::move(items));
+        QueryNextExpiredMailBatch();
+    }));
+}
+
+void ObjectMgr::FinishExpiredMailPass()
+{
+    ExpiredMailPass const& pass = *_expiredMailPass;
+    TC_LOG_INFO("server.loading", ">> Processed %u expired mails: %u deleted and %u returned in %u ms", pass.Deleted + pass.Returned, pass.Deleted, pass.Returned, GetMSTimeDiffToNow(pass.StartTime));
+    _expiredMailPass.reset();
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
@@ -19,6 +19,7 @@
 #define _OBJECTMGR_H
 
 #include "Common.h"
+#include "AsyncCallbackProcessor.h"
 #include "ConditionMgr.h"
 #include "Corpse.h"
 #include "CreatureData.h"
@@ -31,11 +32,13 @@
 #include "NPCHandler.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
+#include "Optional.h"
 #include "Position.h"
 #include "QuestDef.h"
 #include "SharedDefines.h"
 #include "Trainer.h"
 #include "VehicleDefines.h"
+#include <atomic>
 #include <iterator>
 #include <map>
 #include <unordered_map>
@@ -1285,7 +1288,21 @@ class TC_GAME_API ObjectMgr
             return itr != _fishingBaseForAreaStore.end() ? itr->second : 0;
         }
 
+        struct ExpiredMailStatistics
+        {
+            std::atomic<uint64> Batches = 0;
+            std::atomic<uint64> Deleted = 0;
+            std::atomic<uint64> Returned = 0;
+            std::atomic<uint64> Skipped = 0;
+        };
+
+        // At startup all expired mails are processed right away, while the server is running
+        // they are loaded in batches in the background and applied by ProcessQueryCallbacks
         void ReturnOrDeleteOldMails(bool serverUp);
+        bool IsReturningOldMails() const { return _expiredMailPass.has_value(); }
+        ExpiredMailStatistics const& GetExpiredMailStatistics() const { return _expiredMailStatistics; }
+
+        void ProcessQueryCallbacks();
 
         CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1724,6 +1741,37 @@ class TC_GAME_API ObjectMgr
 
         MailLevelRewardContainer _mailLevelRewardStore;
 
+        struct ExpiredMail
+        {
+            uint32 MessageID;
+            uint8 MessageType;
+            ObjectGuid::LowType Sender;
+            ObjectGuid::LowType Receiver;
+            bool HasItems;
+            uint8 Checked;
+        };
+
+        struct ExpiredMailPass
+        {
+            uint64 BaseTime;
+            uint32 StartTime;
+            uint32 LastMailID;          // keyset cursor, batches are loaded in ascending id order
+            uint32 Deleted;
+            uint32 Returned;
+            bool ServerUp;              // mails of players that are online are left alone
+            std::vector<ExpiredMail> Batch;
+        };
+
+        CharacterDatabasePreparedStatement* GetExpiredMailBatchStatement() const;
+        bool LoadExpiredMailBatch(PreparedQueryResult result);
+        void ProcessExpiredMailBatch(PreparedQueryResult items);
+        void QueryNextExpiredMailBatch();
+        void FinishExpiredMailPass();
+
+        Optional<ExpiredMailPass> _expiredMailPass;
+        ExpiredMailStatistics _expiredMailStatistics;
+        QueryCallbackProcessor _queryProcessor;
+
         CreatureBaseStatsContainer _creatureBaseStatsStore;
 
         typedef std::map<uint32, PetLevelInfo*> PetLevelInfoContainer;
@@ -121,16 +121,27 @@ namespace Trinity
         float i_distSq;
         uint32 team;
         Player const* skipped_receiver;
+        std::vector<Player*>* i_receivers;
         MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = nullptr)
             : i_source(src), i_message(msg), i_distSq(dist * dist)
             , team(0)
             , skipped_receiver(skipped)
+            , i_receivers(nullptr)
         {
             if (own_team_only)
                 if (Player const* player = src->ToPlayer())
                     team = player->GetTeam();
         }
 
+        // collects the players the message would be delivered to instead of sending it
+        MessageDistDeliverer(WorldObject const* src, std::vector<Player*>& receivers, float dist)
+            : i_source(src), i_message(nullptr), i_distSq(dist * dist)
+            , team(0)
+            , skipped_receiver(nullptr)
+            , i_receivers(&receivers)
+        {
+        }
+
         void Visit(PlayerMapType &m);
         void Visit(CreatureMapType &m);
         void Visit(DynamicObjectMapType &m);
@@ -145,7 +156,10 @@ namespace Trinity
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->SendDirectMessage(i_message);
+            if (i_receivers)
+                i_receivers->push_back(player);
+            else
+                player->SendDirectMessage(i_message);
         }
     };
 
@@ -245,6 +259,9 @@ namespace Trinity
         WorldObjectLastSearcher(WorldObject const* searcher, WorldObject* & result, Check& check, uint32 mapTypeMask = GRID_MAP_TYPE_MASK_ALL)
             : _searcher(searcher), i_object(result), i_check(check), i_mapTypeMask(mapTypeMask) { }
 
+        // single candidate, for searches not walking the grids (MapSpatialIndex)
+        void VisitObject(WorldObject* object);
+
         void Visit(GameObjectMapType &m);
         void Visit(PlayerMapType &m);
         void Visit(CreatureMapType &m);
@@ -267,6 +284,9 @@ namespace Trinity
             : ContainerInserter<WorldObject*>(container),
               i_mapTypeMask(mapTypeMask), _searcher(searcher), i_check(check) { }
 
+        // single candidate, for searches not walking the grids (MapSpatialIndex)
+        void VisitObject(WorldObject* object);
+
         void Visit(PlayerMapType &m);
         void Visit(CreatureMapType &m);
         void Visit(CorpseMapType &m);
@@ -1613,6 +1633,20 @@ namespace Trinity
             std::vector<WorldPacket*> i_data_cache;         // 0 = default, i => i-1 locale index
     };
 
+    // Prepare using Builder localized packets with caching and send to player, one buffer is shared by all receivers of a locale
+    template<class Builder>
+    class SharedLocalizedPacketDo
+    {
+        public:
+            explicit SharedLocalizedPacketDo(Builder& builder) : i_builder(builder) { }
+
+            void operator()(Player* p);
+
+        private:
+            Builder& i_builder;
+            std::vector<SharedWorldPacket> i_data_cache;    // 0 = default, i => i-1 locale index
+    };
+
     // Prepare using Builder localized packets with caching and send to player
     template<class Builder>
     class LocalizedPacketListDo
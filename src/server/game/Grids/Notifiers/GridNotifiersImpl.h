@@ -179,6 +179,16 @@ void Trinity::WorldObjectSearcher<Check>::Visit(AreaTriggerMapType &m)
     }
 }
 
+template<class Check>
+void Trinity::WorldObjectLastSearcher<Check>::VisitObject(WorldObject* object)
+{
+    if (!object->IsInPhase(_searcher))
+        return;
+
+    if (i_check(object))
+        i_object = object;
+}
+
 template<class Check>
 void Trinity::WorldObjectLastSearcher<Check>::Visit(GameObjectMapType &m)
 {
@@ -275,6 +285,13 @@ void Trinity::WorldObjectLastSearcher<Check>::Visit(AreaTriggerMapType &m)
     }
 }
 
+template<class Check>
+void Trinity::WorldObjectListSearcher<Check>::VisitObject(WorldObject* object)
+{
+    if (i_check(object))
+        Insert(object);
+}
+
 template<class Check>
 void Trinity::WorldObjectListSearcher<Check>::Visit(PlayerMapType &m)
 {
@@ -582,6 +599,26 @@ void Trinity::LocalizedPacketDo<Builder>::operator()(Player* p)
     p->SendDirectMessage(data);
 }
 
+template<class Builder>
+void Trinity::SharedLocalizedPacketDo<Builder>::operator()(Player* p)
+{
+    LocaleConstant loc_idx = p->GetSession()->GetSessionDbLocaleIndex();
+    uint32 cache_idx = loc_idx+1;
+
+    // create if not cached yet
+    if (i_data_cache.size() < cache_idx + 1)
+        i_data_cache.resize(cache_idx + 1);
+
+    if (!i_data_cache[cache_idx])
+    {
+        std::shared_ptr<WorldPacket> data = std::make_shared<WorldPacket>();
+        i_builder(*data, loc_idx);
+        i_data_cache[cache_idx] = std::move(data);
+    }
+
+    p->GetSession()->SendPacket(i_data_cache[cache_idx]);
+}
+
 template<class Builder>
 void Trinity::LocalizedPacketListDo<Builder>::operator()(Player* p)
 {
@@ -152,32 +152,33 @@ void ObjectWorldLoader::Visit(CorpseMapType& /*m*/)
     }
 }
 
-void ObjectGridLoader::LoadN(void)
+void ObjectGridLoader::LoadN(uint32 firstCell /*= 0*/)
 {
     i_gameObjects = 0; i_creatures = 0; i_corpses = 0;
-    i_cell.data.Part.cell_y = 0;
-    for (uint32 x = 0; x < MAX_NUMBER_OF_CELLS; ++x)
+    for (uint32 cellIndex = firstCell; cellIndex < MAX_NUMBER_OF_CELLS * MAX_NUMBER_OF_CELLS; ++cellIndex)
+        LoadCell(cellIndex);
+    TC_LOG_DEBUG("maps", "%u GameObjects, %u Creatures, and %u Corpses/Bones loaded for grid %u on map %u", i_gameObjects, i_creatures, i_corpses, i_grid.GetGridId(), i_map->GetId());
+}
+
+void ObjectGridLoader::LoadCell(uint32 cellIndex)
+{
+    uint32 x = cellIndex / MAX_NUMBER_OF_CELLS;
+    uint32 y = cellIndex % MAX_NUMBER_OF_CELLS;
+    i_cell.data.Part.cell_x = x;
+    i_cell.data.Part.cell_y = y;
+
+    //Load creatures and game objects
     {
-        i_cell.data.Part.cell_x = x;
-        for (uint32 y = 0; y < MAX_NUMBER_OF_CELLS; ++y)
-        {
-            i_cell.data.Part.cell_y = y;
-
-            //Load creatures and game objects
-            {
-                TypeContainerVisitor<ObjectGridLoader, GridTypeMapContainer> visitor(*this);
-                i_grid.VisitGrid(x, y, visitor);
-            }
-
-            //Load corpses (not bones)
-            {
-                ObjectWorldLoader worker(*this);
-                TypeContainerVisitor<ObjectWorldLoader, WorldTypeMapContainer> visitor(worker);
-                i_grid.VisitGrid(x, y, visitor);
-            }
-        }
+        TypeContainerVisitor<ObjectGridLoader, GridTypeMapContainer> visitor(*this);
+        i_grid.VisitGrid(x, y, visitor);
+    }
+
+    //Load corpses (not bones)
+    {
+        ObjectWorldLoader worker(*this);
+        TypeContainerVisitor<ObjectWorldLoader, WorldTypeMapContainer> visitor(worker);
+        i_grid.VisitGrid(x, y, visitor);
     }
-    TC_LOG_DEBUG("maps", "%u GameObjects, %u Creatures, and %u Corpses/Bones loaded for grid %u on map %u", i_gameObjects, i_creatures, i_corpses, i_grid.GetGridId(), i_map->GetId());
 }
 
 template<class T>
@@ -42,7 +42,9 @@ class TC_GAME_API ObjectGridLoader
         void Visit(DynamicObjectMapType&) const { }
         void Visit(AreaTriggerMapType &) const { }
 
-        void LoadN(void);
+        // loads all cells of the grid starting at cell index firstCell, cells are numbered x * MAX_NUMBER_OF_CELLS + y
+        void LoadN(uint32 firstCell = 0);
+        void LoadCell(uint32 cellIndex);
 
         static void SetObjectCell(MapObject* obj, CellCoord const& cellCoord);
 
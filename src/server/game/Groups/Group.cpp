@@ -1826,6 +1826,8 @@ void Group::UpdatePlayerOutOfRange(Player* player)
 
 void Group::BroadcastAddonMessagePacket(WorldPacket const* packet, const std::string& prefix, bool ignorePlayersInBGRaid, int group, uint64 ignore)
 {
+    std::vector<WorldSession*> sessions;
+    sessions.reserve(GetMembersCount());
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* player = itr->GetSource();
@@ -1833,34 +1835,44 @@ void Group::BroadcastAddonMessagePacket(WorldPacket const* packet, const std::st
             continue;
 
         if (WorldSession* session = player->GetSession())
-            if (session && (group == -1 || itr->getSubGroup() == group))
+            if (group == -1 || itr->getSubGroup() == group)
                 if (session->IsAddonRegistered(prefix))
-                    session->SendPacket(packet);
+                    sessions.push_back(session);
     }
+
+    WorldSession::MulticastPacket(sessions, packet);
 }
 
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignoredPlayer)
 {
+    std::vector<WorldSession*> sessions;
+    sessions.reserve(GetMembersCount());
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* player = itr->GetSource();
         if (!player || (!ignoredPlayer.IsEmpty() && player->GetGUID() == ignoredPlayer) || (ignorePlayersInBGRaid && player->GetGroup() != this))
             continue;
 
-        if (player->GetSession() && (group == -1 || itr->getSubGroup() == group))
-            player->SendDirectMessage(packet);
+        if (WorldSession* session = player->GetSession())
+            if (group == -1 || itr->getSubGroup() == group)
+                sessions.push_back(session);
     }
+
+    WorldSession::MulticastPacket(sessions, packet);
 }
 
 void Group::BroadcastReadyCheck(WorldPacket const* packet)
 {
+    std::vector<WorldSession*> sessions;
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* player = itr->GetSource();
         if (player && player->GetSession())
             if (IsLeader(player->GetGUID()) || IsAssistant(player->GetGUID()))
-                player->SendDirectMessage(packet);
+                sessions.push_back(player->GetSession());
     }
+
+    WorldSession::MulticastPacket(sessions, packet);
 }
 
 void Group::OfflineReadyCheck()
@@ -585,7 +585,8 @@ Guild::Member::Member(ObjectGuid::LowType guildId, ObjectGuid guid, uint8 rankId
     m_totalActivity(0),
     m_weekActivity(0),
     m_totalReputation(0),
-    m_weekReputation(0)
+    m_weekReputation(0),
+    m_session(nullptr)
 {
     memset(m_bankWithdraw, 0, (GUILD_BANK_MAX_TABS) * sizeof(uint32));
 }
@@ -809,6 +810,14 @@ Player* Guild::Member::FindConnectedPlayer() const
     return ObjectAccessor::FindConnectedPlayer(m_guid);
 }
 
+WorldSession* Guild::Member::GetSessionInWorld() const
+{
+    if (m_session && m_session->GetPlayer() && m_session->GetPlayer()->IsInWorld())
+        return m_session;
+
+    return nullptr;
+}
+
 void Guild::Member::UpdateLogoutTime()
 {
     m_logoutTime = ::GameTime::GetGameTime();
@@ -1295,7 +1304,10 @@ Guild::Guild():
     m_newsLog(nullptr),
     _level(1),
     _experience(0),
-    _todayExperience(0)
+    _todayExperience(0),
+    _rosterCacheVersion(0),
+    _rosterCacheExpireTime(0),
+    _rosterVersion(0)
 {
     memset(&m_bankEventLog, 0, (GUILD_BANK_MAX_TABS + 1) * sizeof(LogHolder*));
 
@@ -1485,7 +1497,7 @@ void Guild::UpdateMemberData(Player* player, uint8 dataid, uint32 value)
                 TC_LOG_ERROR("guild", "Guild::UpdateMemberData: Called with incorrect DATAID %u (value %u)", dataid, value);
                 return;
         }
-        //HandleRoster();
+        _InvalidateRoster();
     }
 }
 
@@ -1496,6 +1508,7 @@ void Guild::OnPlayerStatusChange(Player* player, uint32 flag, bool state)
         if (state)
             member->AddFlag(flag);
         else member->RemFlag(flag);
+        _InvalidateRoster();
     }
 }
 
@@ -1517,9 +1530,27 @@ bool Guild::SetName(std::string const& name)
     return true;
 }
 
+Guild::RosterCacheStatistics& Guild::GetRosterCacheStatistics()
+{
+    static RosterCacheStatistics statistics;
+    return statistics;
+}
+
 void Guild::HandleRoster(WorldSession* session)
 {
-     WorldPackets::Guild::GuildRoster roster;
+    time_t const now = ::GameTime::GetGameTime();
+    uint32 const version = _rosterVersion.load();
+    if (_rosterCache && _rosterCacheVersion == version && now < _rosterCacheExpireTime)
+    {
+        ++GetRosterCacheStatistics().Hits;
+        TC_LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [%s] (cached)", session->GetPlayerInfo().c_str());
+        session->SendPacket(_rosterCache);
+        return;
+    }
+
+    ++GetRosterCacheStatistics().Misses;
+
+    WorldPackets::Guild::GuildRoster roster;
 
     roster.NumAccounts = int32(m_accountsNumber);
     roster.CreateDate = uint32(m_createdDate);
@@ -1572,7 +1603,21 @@ void Guild::HandleRoster(WorldSession* session)
     roster.InfoText = m_info;
 
     TC_LOG_DEBUG("guild", "SMSG_GUILD_ROSTER [%s]", session->GetPlayerInfo().c_str());
-    session->SendPacket(roster.Write());
+    roster.Write();
+
+    if (uint32 cacheTime = sWorld->getIntConfig(CONFIG_GUILD_ROSTER_CACHE_TIME))
+    {
+        // changes made while building are caught by the version read before
+        _rosterCache = std::make_shared<WorldPacket>(roster.Move());
+        _rosterCacheVersion = version;
+        _rosterCacheExpireTime = now + cacheTime;
+        session->SendPacket(_rosterCache);
+    }
+    else
+    {
+        _rosterCache.reset();
+        session->SendPacket(roster.GetRawPacket());
+    }
 }
 
 void Guild::SendQueryResponse(WorldSession* session)
@@ -1674,6 +1719,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string const& motd)
     else
     {
         m_motd = motd;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildMOTDChanged(this, motd);
 
@@ -1695,6 +1741,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string const& info)
     if (_HasRankRight(session->GetPlayer(), GR_RIGHT_MODIFY_GUILD_INFO))
     {
         m_info = info;
+        _InvalidateRoster();
 
         sScriptMgr->OnGuildInfoChanged(this, info);
 
@@ -1762,6 +1809,7 @@ void Guild::HandleSetNewGuildMaster(WorldSession* session, std::string const& na
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     _SetLeader(trans, newGuildMaster);
     oldGuildMaster->ChangeRank(trans, GR_INITIATE);
+    _InvalidateRoster();
     _BroadcastEvent(GE_LEADER_CHANGED, ObjectGuid::Empty, player->GetName().c_str(), newGuildMaster->GetName().c_str());
     CharacterDatabase.CommitTransaction(trans);
 }
@@ -1791,6 +1839,7 @@ void Guild::HandleSetMemberNote(WorldSession* session, std::string const& note,
             member->SetOfficerNote(note);
         else
             member->SetPublicNote(note);
+        _InvalidateRoster();
 
         SendMemberUpdateNote(note, guid, officer);
     }
@@ -2097,6 +2146,7 @@ void Guild::HandleUpdateMemberRank(WorldSession* session, ObjectGuid guid, bool
         uint32 newRankId = member->GetRankId() + (demote ? 1 : -1);
         CharacterDatabaseTransaction trans(nullptr);
         member->ChangeRank(trans, newRankId);
+        _InvalidateRoster();
         _LogEvent(demote ? GUILD_EVENT_LOG_DEMOTE_PLAYER : GUILD_EVENT_LOG_PROMOTE_PLAYER, player->GetGUID().GetCounter(), member->GetGUID().GetCounter(), newRankId);
         _BroadcastEvent(demote ? GE_DEMOTION : GE_PROMOTION, ObjectGuid::Empty, player->GetName().c_str(), name.c_str(), _GetRankName(newRankId).c_str());
     }
@@ -2263,6 +2313,8 @@ void Guild::HandleMemberLogout(WorldSession* session)
         member->SetStats(player);
         member->UpdateLogoutTime();
         member->ResetFlags();
+        member->SetSession(nullptr);
+        _InvalidateRoster();
     }
     _BroadcastEvent(GE_SIGNED_OFF, player->GetGUID(), player->GetName().c_str());
 
@@ -2454,6 +2506,9 @@ void Guild::SendLoginInfo(WorldSession* session)
     if (!member)
         return;
 
+    member->SetSession(session);
+    _InvalidateRoster();
+
     /*
         Login sequence:
           SMSG_GUILD_EVENT - GE_MOTD
@@ -2499,6 +2554,7 @@ void Guild::SendLoginInfo(WorldSession* session)
 
     member->SetStats(player);
     member->AddFlag(GUILDMEMBER_STATUS_ONLINE);
+    _InvalidateRoster();
 }
 
 void Guild::SendMemberUpdateNote(std::string const& note, ObjectGuid guid, bool isPublic) const
@@ -2767,11 +2823,15 @@ void Guild::BroadcastToGuild(WorldSession* session, bool officerOnly, std::strin
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, Language(language), session->GetPlayer(), nullptr, msg);
+        std::vector<WorldSession*> sessions;
         for (auto itr = m_members.begin(); itr != m_members.end(); ++itr)
-            if (Player* player = itr->second->FindConnectedPlayer())
-                if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
-                    !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
-                    player->SendDirectMessage(&data);
+            if (WorldSession* memberSession = itr->second->GetSession())
+                if (Player* player = memberSession->GetPlayer())
+                    if (_HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
+                        !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()))
+                        sessions.push_back(memberSession);
+
+        WorldSession::MulticastPacket(sessions, &data);
     }
 }
 
@@ -2781,36 +2841,50 @@ void Guild::BroadcastAddonToGuild(WorldSession* session, bool officerOnly, std::
     {
         WorldPacket data;
         ChatHandler::BuildChatPacket(data, officerOnly ? CHAT_MSG_OFFICER : CHAT_MSG_GUILD, LANG_ADDON, session->GetPlayer(), nullptr, msg, 0, "", DEFAULT_LOCALE, prefix);
+        std::vector<WorldSession*> sessions;
         for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
-            if (Player* player = itr->second->FindPlayer())
-                if (player->GetSession() && _HasRankRight(player, officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
-                    !player->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()) &&
-                    player->GetSession()->IsAddonRegistered(prefix))
-                        player->SendDirectMessage(&data);
+            if (WorldSession* memberSession = itr->second->GetSessionInWorld())
+                if (_HasRankRight(memberSession->GetPlayer(), officerOnly ? GR_RIGHT_OFFCHATLISTEN : GR_RIGHT_GCHATLISTEN) &&
+                    !memberSession->GetPlayer()->GetSocial()->HasIgnore(session->GetPlayer()->GetGUID()) &&
+                    memberSession->IsAddonRegistered(prefix))
+                    sessions.push_back(memberSession);
+
+        WorldSession::MulticastPacket(sessions, &data);
     }
 }
 
 void Guild::BroadcastPacketToRank(WorldPacket const* packet, uint8 rankId) const
 {
+    std::vector<WorldSession*> sessions;
     for (auto itr = m_members.begin(); itr != m_members.end(); ++itr)
         if (itr->second->IsRank(rankId))
-            if (Player* player = itr->second->FindConnectedPlayer())
-                player->SendDirectMessage(packet);
+            if (WorldSession* session = itr->second->GetSession())
+                if (session->GetPlayer())
+                    sessions.push_back(session);
+
+    WorldSession::MulticastPacket(sessions, packet);
 }
 
 void Guild::BroadcastPacket(WorldPacket const* packet) const
 {
+    std::vector<WorldSession*> sessions;
+    sessions.reserve(m_members.size());
     for (auto itr = m_members.begin(); itr != m_members.end(); ++itr)
-        if (Player* player = itr->second->FindPlayer())
-            player->SendDirectMessage(packet);
+        if (WorldSession* session = itr->second->GetSessionInWorld())
+            sessions.push_back(session);
+
+    WorldSession::MulticastPacket(sessions, packet);
 }
 
 void Guild::BroadcastPacketIfTrackingAchievement(WorldPacket const* packet, uint32 criteriaId) const
 {
+    std::vector<WorldSession*> sessions;
     for (Members::const_iterator itr = m_members.begin(); itr != m_members.end(); ++itr)
         if (itr->second->IsTrackingCriteriaId(criteriaId))
-            if (Player* player = itr->second->FindPlayer())
-                player->SendDirectMessage(packet);
+            if (WorldSession* session = itr->second->GetSessionInWorld())
+                sessions.push_back(session);
+
+    WorldSession::MulticastPacket(sessions, packet);
 }
 
 void Guild::MassInviteToEvent(WorldSession* session, uint32 minLevel, uint32 maxLevel, uint32 minRank)
@@ -3036,6 +3110,7 @@ void Guild::DeleteMember(CharacterDatabaseTransaction& trans, ObjectGuid guid, b
         delete member;
     }
     m_members.erase(lowguid);
+    _InvalidateRoster();
 
     // If player not online data in data field will be loaded from guild tabs no need to update it !!
     if (player)
@@ -3066,6 +3141,7 @@ bool Guild::ChangeMemberRank(CharacterDatabaseTransaction& trans, ObjectGuid gui
         if (Member* member = GetMember(guid))
         {
             member->ChangeRank(trans, newRank);
+            _InvalidateRoster();
             return true;
         }
     }
@@ -3211,6 +3287,7 @@ void Guild::_UpdateAccountsNumber()
         accountsIdSet.insert(itr->second->GetAccountId());
 
     m_accountsNumber = accountsIdSet.size();
+    _InvalidateRoster();
 }
 
 // Detects if player is the guild master.
@@ -3271,6 +3348,7 @@ void Guild::_SetLeader(CharacterDatabaseTransaction& trans, Member* pLeader)
 
     m_leaderGuid = pLeader->GetGUID();
     pLeader->ChangeRank(trans, GR_GUILDMASTER);
+    _InvalidateRoster();
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->setUInt32(0, m_leaderGuid.GetCounter());
@@ -3776,6 +3854,7 @@ void Guild::SendGuildRanksUpdate(ObjectGuid setterGuid, ObjectGuid targetGuid, u
 
     CharacterDatabaseTransaction trans(nullptr);
     member->ChangeRank(trans, rank);
+    _InvalidateRoster();
 
     TC_LOG_DEBUG("network", "SMSG_GUILD_RANKS_UPDATE [Broadcast] Target: %s, Issuer: %s, RankId: %u",
         targetGuid.ToString().c_str(), setterGuid.ToString().c_str(), rank);
@@ -3960,6 +4039,8 @@ void Guild::ResetTimes(bool weekly)
             player->SendDirectMessage(&data);
         }
     }
+
+    _InvalidateRoster();
 }
 
 void Guild::AddGuildNews(uint8 type, ObjectGuid guid, uint32 flags, uint32 value)
@@ -23,6 +23,8 @@
 #include "SharedDefines.h"
 
 #include <array>
+#include <atomic>
+#include <memory>
 #include <unordered_map>
 
 template<class T>
@@ -416,6 +418,12 @@ private:
         Player* FindPlayer() const;
         Player* FindConnectedPlayer() const;
 
+        // Session of the member while logged in, kept up to date by Guild::SendLoginInfo and Guild::HandleMemberLogout
+        void SetSession(WorldSession* session) { m_session = session; }
+        WorldSession* GetSession() const { return m_session; }
+        // Session of the member if its player is in world, same player as FindPlayer without the global lookup
+        WorldSession* GetSessionInWorld() const;
+
     private:
         ObjectGuid::LowType m_guildId;
         // Fields from characters table
@@ -443,6 +451,8 @@ private:
         uint32 m_totalReputation;
         uint32 m_weekReputation;
         GuildMemberProfessionData m_professions[GUILD_PROFESSION_COUNT];
+
+        WorldSession* m_session;
     };
 
     // Base class for event entries
@@ -759,6 +769,14 @@ private:
     typedef std::vector<BankTab*> BankTabs;
 
 public:
+    struct RosterCacheStatistics
+    {
+        std::atomic<uint64> Hits = 0;
+        std::atomic<uint64> Misses = 0;
+    };
+
+    static RosterCacheStatistics& GetRosterCacheStatistics();
+
     static void SendCommandResult(WorldSession* session, GuildCommandType type, GuildCommandError errCode, std::string const& param = "");
     static void SendSaveEmblemResult(WorldSession* session, GuildEmblemError errCode);
 
@@ -941,8 +959,17 @@ protected:
     uint32 _challengeGoldMaxLevel[MAX_GUILD_CHALLENGE_TYPES];
     uint32 _challengeXp[MAX_GUILD_CHALLENGE_TYPES];
 
+    // SMSG_GUILD_ROSTER built by HandleRoster, sent again until it expires or the roster version changes.
+    // The version is bumped from map threads too (zone, level, status changes), the cache itself is only used by HandleRoster.
+    std::shared_ptr<WorldPacket const> _rosterCache;
+    uint32 _rosterCacheVersion;
+    time_t _rosterCacheExpireTime;
+    std::atomic<uint32> _rosterVersion;
+
 private:
     inline uint8 _GetRanksSize() const { return uint8(m_ranks.size()); }
+    // Must be called whenever data shown in the roster changes
+    inline void _InvalidateRoster() { ++_rosterVersion; }
     inline const RankInfo* GetRankInfo(uint8 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
     inline RankInfo* GetRankInfo(uint8 rankId) { return rankId < _GetRanksSize() ? &m_ranks[rankId] : nullptr; }
     bool _HasRankRight(Player const* player, uint32 right) const;
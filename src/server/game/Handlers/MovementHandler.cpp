@@ -30,6 +30,7 @@
 #include "MovementGenerator.h"
 #include "MovementPacketSender.h"
 #include "MovementPackets.h"
+#include "MovementRelay.h"
 #include "MovementStructures.h"
 #include "Transport.h"
 #include "Battleground.h"
@@ -414,9 +415,19 @@ void WorldSession::HandleMovementOpcode(uint16 opcode, MovementInfo& movementInf
 
     mover->UpdatePosition(movementInfo.pos);
 
-    WorldPacket data(SMSG_MOVE_UPDATE);
-    mover->WriteMovementInfo(data);
-    mover->SendMessageToSet(&data, _player);
+    // heartbeats only carry the latest position and can be relayed at a lower rate, state changes are sent right away
+    MovementRelay* movementRelay = mover->GetMap()->GetMovementRelay();
+    if (movementRelay && opcode == MSG_MOVE_HEARTBEAT)
+        movementRelay->QueueHeartbeat(mover, _player);
+    else
+    {
+        if (movementRelay)
+            movementRelay->CancelHeartbeat(mover);
+
+        WorldPacket data(SMSG_MOVE_UPDATE);
+        mover->WriteMovementInfo(data);
+        mover->SendMessageToSet(&data, _player);
+    }
 
     if (plrMover)                                            // nothing is charmed, or player charmed
     {
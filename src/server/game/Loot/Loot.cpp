@@ -310,6 +310,70 @@ bool Loot::FillLoot(uint32 lootId, LootStore const& store, Player* lootOwner, bo
     return true;
 }
 
+Loot::LazyLootStatistics& Loot::GetLazyLootStatistics()
+{
+    static LazyLootStatistics statistics;
+    return statistics;
+}
+
+bool Loot::DeferCreatureLoot(uint32 lootId, uint16 lootMode, uint32 minGold, uint32 maxGold, Player* lootOwner)
+{
+    if (!lootOwner)
+        return false;
+
+    if (!LootTemplates_Creature.HaveLootFor(lootId))
+        lootId = 0;
+
+    if (!lootMode)
+        maxGold = 0;
+
+    if (!lootId && !maxGold)
+        return false;
+
+    _pendingCreatureLoot = PendingCreatureLoot{ lootId, lootMode, minGold, maxGold };
+
+    // same access rights as FillLoot sets up, they are needed before the loot is rolled
+    lootOwnerGUID = lootOwner->GetGUID();
+    if (lootId && lootOwner->GetGroup())
+        roundRobinPlayer = lootOwner->GetGUID();
+
+    ++GetLazyLootStatistics().Deferred;
+    return true;
+}
+
+void Loot::Materialize(Player* lootRecipient)
+{
+    if (!_pendingCreatureLoot)
+        return;
+
+    PendingCreatureLoot pending = *_pendingCreatureLoot;
+    _pendingCreatureLoot.reset();
+
+    // group members are tracked around the looter of the kill, or around the loot recipient if it left the map
+    Player* lootOwner = ObjectAccessor::GetPlayer(*lootRecipient, lootOwnerGUID);
+    if (!lootOwner)
+        lootOwner = lootRecipient;
+
+    ObjectGuid const roundRobinOwner = roundRobinPlayer;
+
+    if (pending.LootId)
+        FillLoot(pending.LootId, LootTemplates_Creature, lootOwner, false, false, pending.LootMode);
+
+    if (!roundRobinOwner.IsEmpty())
+        roundRobinPlayer = roundRobinOwner;
+
+    if (pending.MaxGold)
+        generateMoneyLoot(pending.MinGold, pending.MaxGold);
+
+    ++GetLazyLootStatistics().Materialized;
+}
+
+void Loot::DiscardPendingCreatureLoot()
+{
+    _pendingCreatureLoot.reset();
+    ++GetLazyLootStatistics().NeverOpened;
+}
+
 void Loot::FillNotNormalLootFor(Player* player, bool presentAtLooting)
 {
     ObjectGuid plguid = player->GetGUID();
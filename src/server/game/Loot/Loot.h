@@ -22,8 +22,10 @@
 #include "ConditionMgr.h"
 #include "ItemEnchantmentMgr.h"
 #include "ObjectGuid.h"
+#include "Optional.h"
 #include "RefManager.h"
 #include "SharedDefines.h"
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 
@@ -212,6 +214,13 @@ class LootValidatorRefManager : public RefManager<Loot, LootValidatorRef>
 
 struct TC_GAME_API Loot
 {
+    struct LazyLootStatistics
+    {
+        std::atomic<uint64> Deferred = 0;
+        std::atomic<uint64> Materialized = 0;
+        std::atomic<uint64> NeverOpened = 0;
+    };
+
     NotNormalLootItemMap const& GetPlayerQuestItems() const { return PlayerQuestItems; }
     NotNormalLootItemMap const& GetPlayerFFAItems() const { return PlayerFFAItems; }
     NotNormalLootItemMap const& GetPlayerNonQuestNonFFAConditionalItems() const { return PlayerNonQuestNonFFAConditionalItems; }
@@ -250,6 +259,9 @@ struct TC_GAME_API Loot
             delete itr->second;
         PlayerNonQuestNonFFAConditionalItems.clear();
 
+        if (_pendingCreatureLoot)
+            DiscardPendingCreatureLoot();
+
         PlayersLooting.clear();
         items.clear();
         quest_items.clear();
@@ -260,8 +272,8 @@ struct TC_GAME_API Loot
         i_LootValidatorRefManager.clearReferences();
     }
 
-    bool empty() const { return items.empty() && gold == 0; }
-    bool isLooted() const { return gold == 0 && unlootedCount == 0; }
+    bool empty() const { return !IsPending() && items.empty() && gold == 0; }
+    bool isLooted() const { return !IsPending() && gold == 0 && unlootedCount == 0; }
 
     void NotifyItemRemoved(uint8 lootIndex);
     void NotifyQuestItemRemoved(uint8 questIndex);
@@ -273,6 +285,15 @@ struct TC_GAME_API Loot
     void generateMoneyLoot(uint32 minAmount, uint32 maxAmount);
     bool FillLoot(uint32 lootId, LootStore const& store, Player* lootOwner, bool personal, bool noEmptyError = false, uint16 lootMode = LOOT_MODE_DEFAULT);
 
+    // Records the loot of a killed creature instead of rolling it, Materialize does what FillLoot and generateMoneyLoot would have done.
+    // Until then the loot counts as neither empty nor looted. Returns false if the creature can't drop anything.
+    bool DeferCreatureLoot(uint32 lootId, uint16 lootMode, uint32 minGold, uint32 maxGold, Player* lootOwner);
+    // lootRecipient must be a player with loot rights on the creature, it is used if the looter of the kill is no longer on the map
+    void Materialize(Player* lootRecipient);
+    bool IsPending() const { return _pendingCreatureLoot.has_value(); }
+
+    static LazyLootStatistics& GetLazyLootStatistics();
+
     // Inserts the item into the loot (called by LootTemplate processors)
     void AddItem(LootStoreItem const & item);
 
@@ -288,6 +309,15 @@ struct TC_GAME_API Loot
     void BuildLootResponse(WorldPackets::Loot::LootResponse& packet, Player* viewer, PermissionTypes permission = ALL_PERMISSION) const;
 
     private:
+        struct PendingCreatureLoot
+        {
+            uint32 LootId;
+            uint16 LootMode;
+            uint32 MinGold;
+            uint32 MaxGold;
+        };
+
+        void DiscardPendingCreatureLoot();
         void FillNotNormalLootFor(Player* player, bool presentAtLooting);
         NotNormalLootItemList* FillFFALoot(Player* player);
         NotNormalLootItemList* FillQuestLoot(Player* player);
@@ -297,6 +327,7 @@ struct TC_GAME_API Loot
         NotNormalLootItemMap PlayerQuestItems;
         NotNormalLootItemMap PlayerFFAItems;
         NotNormalLootItemMap PlayerNonQuestNonFFAConditionalItems;
+        Optional<PendingCreatureLoot> _pendingCreatureLoot;
 
         // All rolls are registered here. They need to know, when the loot is not valid anymore
         LootValidatorRefManager i_LootValidatorRefManager;
@@ -16,6 +16,7 @@
  */
 
 #include "LootMgr.h"
+#include "AliasTable.h"
 #include "Containers.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
@@ -28,6 +29,8 @@
 #include "SpellMgr.h"
 #include "Util.h"
 #include "World.h"
+#include <algorithm>
+#include <iterator>
 
 static Rates const qualityToRate[MAX_ITEM_QUALITY] =
 {
@@ -53,12 +56,12 @@ LootStore LootTemplates_Reference("reference_loot_template",         "reference
 LootStore LootTemplates_Skinning("skinning_loot_template",           "creature skinning id",            true);
 LootStore LootTemplates_Spell("spell_loot_template",                 "spell id (random item creating)", false);
 
-// Selects invalid loot items to be removed from group possible entries (before rolling)
+// Selects invalid loot items that can't be rolled from a group
 struct LootGroupInvalidSelector
 {
     explicit LootGroupInvalidSelector(Loot const& loot, uint16 lootMode) : _loot(loot), _lootMode(lootMode) { }
 
-    bool operator()(LootStoreItem* item) const
+    bool operator()(LootStoreItem const* item) const
     {
         if (!(item->lootmode & _lootMode))
             return true;
@@ -80,10 +83,11 @@ private:
 class LootTemplate::LootGroup                               // A set of loot definitions for items (refs are not allowed)
 {
     public:
-        LootGroup() { }
+        LootGroup() : ExclusiveChances(true) { }
         ~LootGroup();
 
         void AddEntry(LootStoreItem* item);                 // Adds an entry to the group (at loading stage)
+        void Compile();                                     // Builds the roll tables once all entries are added
         bool HasQuestDrop() const;                          // True if group includes at least 1 quest drop entry
         bool HasQuestDropForPlayer(Player const* player) const;
                                                             // The same for active quests of the player
@@ -101,6 +105,13 @@ class LootTemplate::LootGroup                               // A set of loot def
         LootStoreItemList ExplicitlyChanced;                // Entries with chances defined in DB
         LootStoreItemList EqualChanced;                     // Zero chances - every entry takes the same chance
 
+        // Roll tables built by Compile
+        std::vector<LootStoreItem const*> ExplicitlyChancedTable;
+        std::vector<LootStoreItem const*> EqualChancedTable;
+        // picks from ExplicitlyChancedTable, the extra last index is the chance that no explicitly chanced entry drops
+        Trinity::AliasTable ExplicitlyChancedRoll;
+        bool ExclusiveChances;                              // explicit chances add up to 100% at most, an entry that can't drop only lowers the group chance
+
         LootStoreItem const* Roll(Loot& loot, uint16 lootMode) const;   // Rolls an item from the group, returns nullptr if all miss their chances
 
         // This class must never be copied - storing pointers
@@ -124,6 +135,13 @@ void LootStore::Verify() const
         i->second->Verify(*this, i->first);
 }
 
+// Builds the roll tables of all templates, references are linked to the reference templates loaded at the time
+void LootStore::Compile()
+{
+    for (LootTemplateMap::const_iterator i = m_LootTemplates.begin(); i != m_LootTemplates.end(); ++i)
+        i->second->Compile();
+}
+
 // Loads a *_loot_template DB table into loot store
 // All checks of the loaded template are called from here, no error reports at loot generation required
 uint32 LootStore::LoadLootTable()
@@ -190,6 +208,7 @@ uint32 LootStore::LoadLootTable()
     }
     while (result->NextRow());
 
+    Compile();
     Verify();                                           // Checks validity of the loot store
 
     return count;
@@ -391,32 +410,77 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
         EqualChanced.push_back(item);
 }
 
+// Builds the roll tables once all entries are added
+void LootTemplate::LootGroup::Compile()
+{
+    ExplicitlyChancedTable.assign(ExplicitlyChanced.begin(), ExplicitlyChanced.end());
+    EqualChancedTable.assign(EqualChanced.begin(), EqualChanced.end());
+
+    // entries are checked in order, each one takes its chance from what the previous ones left
+    // and an entry of 100% or more takes all of it
+    std::vector<double> weights;
+    weights.reserve(ExplicitlyChancedTable.size() + 1);
+    double left = 100.0;
+    double total = 0.0;
+    for (LootStoreItem const* item : ExplicitlyChancedTable)
+    {
+        double chance = item->chance >= 100.0f ? left : std::min(double(std::max(item->chance, 0.0f)), left);
+        weights.push_back(chance);
+        left -= chance;
+        total += std::max(item->chance, 0.0f);
+    }
+    weights.push_back(left);
+
+    // when the chances overlap, an entry that can't drop hands its share to the next ones and the table can't be used
+    ExclusiveChances = total <= 100.0;
+
+    ExplicitlyChancedRoll.Build(weights);
+}
+
 // Rolls an item from the group, returns nullptr if all miss their chances
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    if (!ExplicitlyChancedTable.empty())                    // First explicitly chanced entries are checked
     {
-        float roll = rand_chance();
-
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        if (ExclusiveChances)
+        {
+            uint32 index = ExplicitlyChancedRoll.Pick();
+            if (index < ExplicitlyChancedTable.size() && !isInvalid(ExplicitlyChancedTable[index]))
+                return ExplicitlyChancedTable[index];
+        }
+        else
         {
-            LootStoreItem* item = *itr;
-            if (item->chance >= 100.0f)
-                return item;
+            float roll = rand_chance();
+
+            for (LootStoreItem const* item : ExplicitlyChancedTable)
+            {
+                if (isInvalid(item))
+                    continue;
 
-            roll -= item->chance;
-            if (roll < 0)
-                return item;
+                if (item->chance >= 100.0f)
+                    return item;
+
+                roll -= item->chance;
+                if (roll < 0)
+                    return item;
+            }
         }
     }
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
+    if (!EqualChancedTable.empty())                         // If nothing selected yet - an item is taken from equal-chanced part
+    {
+        // retrying among the entries that can drop keeps the pick uniform over them
+        LootStoreItem const* item = Trinity::Containers::SelectRandomContainerElement(EqualChancedTable);
+        if (!isInvalid(item))
+            return item;
+
+        std::vector<LootStoreItem const*> possibleLoot;
+        std::remove_copy_if(EqualChancedTable.begin(), EqualChancedTable.end(), std::back_inserter(possibleLoot), isInvalid);
+        if (!possibleLoot.empty())
+            return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
+    }
 
     return nullptr;                                            // Empty drop from the group
 }
@@ -554,6 +618,19 @@ void LootTemplate::AddEntry(LootStoreItem* item)
         Entries.push_back(item);
 }
 
+// Builds the flat roll tables of the template and links its references (at loading stage)
+void LootTemplate::Compile()
+{
+    CompiledEntries.clear();
+    CompiledEntries.reserve(Entries.size());
+    for (LootStoreItem const* item : Entries)
+        CompiledEntries.push_back({ item, item->reference > 0 ? LootTemplates_Reference.GetLootFor(item->reference) : nullptr });
+
+    for (LootGroup* group : Groups)
+        if (group)
+            group->Compile();
+}
+
 void LootTemplate::CopyConditions(const ConditionContainer& conditions)
 {
     for (LootStoreItemList::iterator i = Entries.begin(); i != Entries.end(); ++i)
@@ -594,9 +671,9 @@ void LootTemplate::Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId
     }
 
     // Rolling non-grouped items
-    for (LootStoreItemList::const_iterator i = Entries.begin(); i != Entries.end(); ++i)
+    for (CompiledEntry const& entry : CompiledEntries)
     {
-        LootStoreItem* item = *i;
+        LootStoreItem const* item = entry.Item;
         if (!(item->lootmode & lootMode))                       // Do not add if mode mismatch
             continue;
 
@@ -605,7 +682,7 @@ void LootTemplate::Process(Loot& loot, bool rate, uint16 lootMode, uint8 groupId
 
         if (item->reference > 0)                            // References processing
         {
-            LootTemplate const* Referenced = LootTemplates_Reference.GetLootFor(item->reference);
+            LootTemplate const* Referenced = entry.Reference;
             if (!Referenced)
                 continue;                                       // Error message already printed at loading stage
 
@@ -1167,6 +1244,19 @@ void LoadLootTemplates_Reference()
     // output error for any still listed ids (not referenced from any loot table)
     LootTemplates_Reference.ReportUnusedIds(lootIdSet);
 
+    // link the other stores to the new reference templates
+    LootTemplates_Creature.Compile();
+    LootTemplates_Fishing.Compile();
+    LootTemplates_Gameobject.Compile();
+    LootTemplates_Item.Compile();
+    LootTemplates_Milling.Compile();
+    LootTemplates_Pickpocketing.Compile();
+    LootTemplates_Skinning.Compile();
+    LootTemplates_Disenchant.Compile();
+    LootTemplates_Prospecting.Compile();
+    LootTemplates_Mail.Compile();
+    LootTemplates_Spell.Compile();
+
     TC_LOG_INFO("server.loading", ">> Loaded refence loot templates in %u ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
@@ -68,6 +68,7 @@ class TC_GAME_API LootStore
         virtual ~LootStore() { Clear(); }
 
         void Verify() const;
+        void Compile();                                     // (Re)builds the roll tables of all templates, must follow a reload of reference templates
 
         uint32 LoadAndCollectLootIds(LootIdSet& ids_set);
         void CheckLootRefs(LootIdSet* ref_set = nullptr) const; // check existence reference and remove it from ref_set
@@ -117,6 +118,9 @@ class TC_GAME_API LootTemplate
         // True if template includes at least 1 quest drop for an active quest of the player
         bool HasQuestDropForPlayer(LootTemplateMap const& store, Player const* player, uint8 groupId = 0) const;
 
+        // Builds the flat roll tables of the template and links its references (at loading stage)
+        void Compile();
+
         // Checks integrity of the template
         void Verify(LootStore const& store, uint32 Id) const;
         void CheckLootRefs(LootTemplateMap const& store, LootIdSet* ref_set) const;
@@ -124,8 +128,15 @@ class TC_GAME_API LootTemplate
         bool isReference(uint32 id);
 
     private:
+        struct CompiledEntry
+        {
+            LootStoreItem const* Item;
+            LootTemplate const* Reference;                  // referenced template, nullptr for plain entries or missing references
+        };
+
         LootStoreItemList Entries;                          // not grouped only
         LootGroups        Groups;                           // groups have own (optimised) processing, grouped entries go there
+        std::vector<CompiledEntry> CompiledEntries;         // Entries as rolled by Process, built by Compile
 
         // Objects of this class must never be copied, we are storing pointers in container
         LootTemplate(LootTemplate const&) = delete;
@@ -0,0 +1,146 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "CombatLogQueue.h"
+#include "CellImpl.h"
+#include "Errors.h"
+#include "GridNotifiers.h"
+#include "Player.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+CombatLogQueue::Statistics& CombatLogQueue::GetStatistics()
+{
+    static Statistics statistics;
+    return statistics;
+}
+
+ByteBuffer& CombatLogQueue::BeginPacket(Unit* source, OpcodeServer opcode)
+{
+    ASSERT(!_pendingSource, "CombatLogQueue::BeginPacket - packet %s is still being written", GetOpcodeNameForLogging(_pendingOpcode).c_str());
+
+    _pendingSource = source;
+    _pendingOpcode = opcode;
+    _pendingOffset = uint32(_payload.wpos());
+    return _payload;
+}
+
+void CombatLogQueue::EndPacket()
+{
+    ASSERT(_pendingSource);
+
+    _events.push_back({ _pendingSource, _pendingOpcode, _pendingOffset, uint32(_payload.wpos()) - _pendingOffset });
+    _pendingSource = nullptr;
+    ++GetStatistics().QueuedEvents;
+}
+
+void CombatLogQueue::QueuePeriodicAuraLog(Unit* source, ObjectGuid const& targetGuid, ObjectGuid const& casterGuid, int32 spellId, WorldPackets::CombatLog::PeriodicAuraLogEffect const& effect)
+{
+    _events.push_back({ source, SMSG_PERIODIC_AURA_LOG, uint32(_periodicAuraLogs.size()), 0 });
+    _periodicAuraLogs.push_back({ targetGuid, casterGuid, spellId, effect });
+    ++GetStatistics().QueuedEvents;
+}
+
+void CombatLogQueue::Flush()
+{
+    if (_events.empty())
+        return;
+
+    // keep the events of each source together, in the order they were queued
+    std::stable_sort(_events.begin(), _events.end(), [](Event const& left, Event const& right) { return left.Source < right.Source; });
+
+    for (std::size_t i = 0; i < _events.size();)
+    {
+        Unit* source = _events[i].Source;
+        std::size_t end = i + 1;
+        while (end < _events.size() && _events[end].Source == source)
+            ++end;
+
+        // same receivers as Unit::SendMessageToSet(packet, true)
+        _receivers.clear();
+        if (Player* player = source->ToPlayer())
+            _receivers.push_back(player);
+
+        Trinity::MessageDistDeliverer notifier(source, _receivers, source->GetVisibilityRange());
+        Cell::VisitWorldObjects(source, notifier, source->GetVisibilityRange());
+
+        while (!_receivers.empty() && i < end)
+        {
+            Event const& event = _events[i];
+            if (event.Opcode == SMSG_PERIODIC_AURA_LOG)
+            {
+                i = SendPeriodicAuraLogs(i, end);
+                continue;
+            }
+
+            WorldPacket packet(event.Opcode, event.Size);
+            packet.append(_payload.contents() + event.Offset, event.Size);
+            SendToReceivers(std::move(packet));
+            ++i;
+        }
+
+        i = end;
+    }
+
+    _events.clear();
+    _periodicAuraLogs.clear();
+    _payload.clear();
+}
+
+std::size_t CombatLogQueue::SendPeriodicAuraLogs(std::size_t first, std::size_t last)
+{
+    PeriodicAuraLog const& log = _periodicAuraLogs[_events[first].Offset];
+
+    WorldPackets::CombatLog::SpellPeriodicAuraLog packet;
+    packet.TargetGUID = log.TargetGUID;
+    packet.CasterGUID = log.CasterGUID;
+    packet.SpellID = log.SpellID;
+    packet.Entries.push_back(log.Effect);
+
+    // ticks of the other effects of the same aura go into the same packet
+    std::size_t next = first + 1;
+    for (; next < last && _events[next].Opcode == SMSG_PERIODIC_AURA_LOG; ++next)
+    {
+        PeriodicAuraLog const& other = _periodicAuraLogs[_events[next].Offset];
+        if (other.TargetGUID != log.TargetGUID || other.CasterGUID != log.CasterGUID || other.SpellID != log.SpellID)
+            break;
+
+        packet.Entries.push_back(other.Effect);
+    }
+
+    if (std::size_t merged = packet.Entries.size() - 1)
+    {
+        // each merged entry would have been a packet of its own, with a header and a copy of the guids and spell id
+        std::size_t const packetOverhead = sizeof(uint16) + sizeof(uint16) + PackedGuid(log.TargetGUID).size() + PackedGuid(log.CasterGUID).size() + sizeof(int32) + sizeof(int32);
+        Statistics& statistics = GetStatistics();
+        statistics.PacketsSaved += merged * _receivers.size();
+        statistics.BytesSaved += merged * packetOverhead * _receivers.size();
+    }
+
+    packet.Write();
+    SendToReceivers(packet.Move());
+    return next;
+}
+
+void CombatLogQueue::SendToReceivers(WorldPacket&& packet)
+{
+    SharedWorldPacket shared = std::make_shared<WorldPacket>(std::move(packet));
+    for (Player* receiver : _receivers)
+        receiver->GetSession()->SendPacket(shared);
+
+    GetStatistics().PacketsSent += _receivers.size();
+}
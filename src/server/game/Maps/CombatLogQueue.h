@@ -0,0 +1,94 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _COMBAT_LOG_QUEUE_H
+#define _COMBAT_LOG_QUEUE_H
+
+#include "ByteBuffer.h"
+#include "CombatLogPackets.h"
+#include "ObjectGuid.h"
+#include "Opcodes.h"
+#include <atomic>
+#include <vector>
+
+class Player;
+class Unit;
+
+// Combat log packets of a map, collected during the map update and broadcast in one pass at its end.
+// Payloads are appended to a single buffer that keeps its capacity between updates, and each packet is
+// built once and shared by all receivers in range of its source, which are searched once per source.
+// Periodic aura logs of the same aura landing in the same update are merged into a single packet.
+class TC_GAME_API CombatLogQueue
+{
+    public:
+        struct Statistics
+        {
+            std::atomic<uint64> QueuedEvents = 0;
+            std::atomic<uint64> PacketsSent = 0;
+            std::atomic<uint64> PacketsSaved = 0;
+            std::atomic<uint64> BytesSaved = 0;
+        };
+
+        CombatLogQueue() : _pendingOpcode(OpcodeServer(NULL_OPCODE)), _pendingSource(nullptr), _pendingOffset(0) { }
+        CombatLogQueue(CombatLogQueue const&) = delete;
+        CombatLogQueue& operator=(CombatLogQueue const&) = delete;
+
+        // Returns the buffer the payload of a packet sent by source has to be written to, finished by EndPacket
+        ByteBuffer& BeginPacket(Unit* source, OpcodeServer opcode);
+        void EndPacket();
+
+        void QueuePeriodicAuraLog(Unit* source, ObjectGuid const& targetGuid, ObjectGuid const& casterGuid, int32 spellId, WorldPackets::CombatLog::PeriodicAuraLogEffect const& effect);
+
+        // Sends everything queued so far, must be called before a source leaves the map
+        void Flush();
+        bool IsEmpty() const { return _events.empty(); }
+
+        static Statistics& GetStatistics();
+
+    private:
+        struct Event
+        {
+            Unit* Source;
+            OpcodeServer Opcode;
+            uint32 Offset;  // into _payload, or into _periodicAuraLogs for SMSG_PERIODIC_AURA_LOG
+            uint32 Size;
+        };
+
+        struct PeriodicAuraLog
+        {
+            ObjectGuid TargetGUID;
+            ObjectGuid CasterGUID;
+            int32 SpellID;
+            WorldPackets::CombatLog::PeriodicAuraLogEffect Effect;
+        };
+
+        std::size_t SendPeriodicAuraLogs(std::size_t first, std::size_t last);
+        void SendToReceivers(WorldPacket&& packet);
+
+        std::vector<Event> _events;
+        std::vector<PeriodicAuraLog> _periodicAuraLogs;
+        ByteBuffer _payload;
+
+        OpcodeServer _pendingOpcode;
+        Unit* _pendingSource;
+        uint32 _pendingOffset;
+
+        // receivers of the source currently being flushed, reused between sources
+        std::vector<Player*> _receivers;
+};
+
+#endif
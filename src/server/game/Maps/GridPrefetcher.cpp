@@ -0,0 +1,117 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPrefetcher.h"
+#include "GridDefines.h"
+#include "TerrainMgr.h"
+
+GridPrefetcher* GridPrefetcher::instance()
+{
+    static GridPrefetcher instance;
+    return &instance;
+}
+
+GridPrefetcher::Statistics& GridPrefetcher::GetStatistics()
+{
+    static Statistics statistics{ };
+    return statistics;
+}
+
+void GridPrefetcher::Activate(std::size_t numThreads)
+{
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.emplace_back(&GridPrefetcher::WorkerThread, this);
+}
+
+void GridPrefetcher::Deactivate()
+{
+    _cancelationToken = true;
+
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+        thread.join();
+
+    _workerThreads.clear();
+
+    ReleaseTerrains();
+}
+
+uint64 GridPrefetcher::MakeRequestKey(TerrainInfo const* terrain, int32 gx, int32 gy)
+{
+    return (uint64(terrain->GetId()) << 32) | uint32(gx * MAX_NUMBER_OF_GRIDS + gy);
+}
+
+void GridPrefetcher::Queue(std::shared_ptr<TerrainInfo> const& terrain, int32 gx, int32 gy)
+{
+    uint64 key = MakeRequestKey(terrain.get(), gx, gy);
+    {
+        std::lock_guard<std::mutex> lock(_pendingLock);
+        if (!_pending.insert(key).second)
+            return;
+    }
+
+    GridPrefetchRequest* request = new GridPrefetchRequest();
+    request->Terrain = terrain;
+    request->Key = key;
+    request->GridX = gx;
+    request->GridY = gy;
+    _queue.Push(request);
+}
+
+void GridPrefetcher::WorkerThread()
+{
+    while (true)
+    {
+        GridPrefetchRequest* request = nullptr;
+
+        _queue.WaitAndPop(request);
+
+        if (_cancelationToken)
+            return;
+
+        if (!request)
+            continue;
+
+        std::shared_ptr<TerrainInfo> terrain = request->Terrain.lock();
+        if (terrain)
+        {
+            terrain->PrefetchMapAndVMap(request->GridX, request->GridY);
+            ++GetStatistics().TerrainPrefetches;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_pendingLock);
+            _pending.erase(request->Key);
+
+            // the map may have released the terrain meanwhile, hand the reference over to world thread
+            if (terrain)
+                _finishedTerrains.push_back(std::move(terrain));
+        }
+
+        delete request;
+    }
+}
+
+void GridPrefetcher::ReleaseTerrains()
+{
+    std::vector<std::shared_ptr<TerrainInfo>> finishedTerrains;
+    {
+        std::lock_guard<std::mutex> lock(_pendingLock);
+        finishedTerrains.swap(_finishedTerrains);
+    }
+}
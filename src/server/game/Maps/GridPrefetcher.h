@@ -0,0 +1,86 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _GRID_PREFETCHER_H
+#define _GRID_PREFETCHER_H
+
+#include "Define.h"
+#include "ProducerConsumerQueue.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+class TerrainInfo;
+
+struct GridPrefetchRequest
+{
+    std::weak_ptr<TerrainInfo> Terrain;     // queued jobs must not keep unloaded maps alive
+    uint64 Key = 0;
+    int32 GridX = 0;
+    int32 GridY = 0;
+};
+
+// Loads terrain files of grids players are heading to before the map needs them
+class TC_GAME_API GridPrefetcher
+{
+    public:
+        struct Statistics
+        {
+            std::atomic<uint64> GridsLoaded;
+            std::atomic<uint64> GridLoadTimeMicroseconds;
+            std::atomic<uint64> TerrainPrefetches;
+            std::atomic<uint64> TerrainPrefetchHits;
+            std::atomic<uint64> ObjectPrefetches;
+        };
+
+        static GridPrefetcher* instance();
+
+        void Activate(std::size_t numThreads);
+        void Deactivate();
+        bool IsActive() const { return !_workerThreads.empty(); }
+
+        // grid coordinates are terrain file coordinates, not NGrid coordinates
+        void Queue(std::shared_ptr<TerrainInfo> const& terrain, int32 gx, int32 gy);
+
+        // drops terrain references taken by finished jobs, must be called from world thread so TerrainInfo is never destroyed by prefetch threads
+        void ReleaseTerrains();
+
+        static Statistics& GetStatistics();
+
+    private:
+        GridPrefetcher() : _cancelationToken(false) { }
+        ~GridPrefetcher() = default;
+
+        void WorkerThread();
+
+        static uint64 MakeRequestKey(TerrainInfo const* terrain, int32 gx, int32 gy);
+
+        ProducerConsumerQueue<GridPrefetchRequest*> _queue;
+        std::vector<std::thread> _workerThreads;
+        std::atomic<bool> _cancelationToken;
+
+        std::mutex _pendingLock;
+        std::unordered_set<uint64> _pending;
+        std::vector<std::shared_ptr<TerrainInfo>> _finishedTerrains;
+};
+
+#define sGridPrefetcher GridPrefetcher::instance()
+
+#endif
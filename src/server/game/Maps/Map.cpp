@@ -16,9 +16,11 @@
  */
 
 #include "Map.h"
+#include "AsyncPathfinder.h"
 #include "BattlefieldMgr.h"
 #include "Battleground.h"
 #include "CellImpl.h"
+#include "CombatLogQueue.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
 #include "DynamicTree.h"
@@ -26,6 +28,7 @@
 #include "GameTime.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
+#include "GridPrefetcher.h"
 #include "GridStates.h"
 #include "Group.h"
 #include "InstanceScript.h"
@@ -33,12 +36,15 @@
 #include "InstanceSaveMgr.h"
 #include "Log.h"
 #include "MapManager.h"
+#include "MapSpatialIndex.h"
 #include "MiscPackets.h"
 #include "MotionMaster.h"
+#include "MovementRelay.h"
 #include "ObjectAccessor.h"
 #include "ObjectGridLoader.h"
 #include "ObjectMgr.h"
 #include "OutdoorPvPMgr.h"
+#include "PathCache.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "PhasingHandler.h"
@@ -56,6 +62,7 @@
 #ifdef ELUNA
 #include "LuaEngine.h"
 #endif
+#include <chrono>
 #include <unordered_set>
 #include <vector>
 
@@ -74,6 +81,9 @@ Map::~Map()
 {
     // UnloadAll must be called before deleting the map
 
+    // pathfinder threads may still be searching on this map's nav mesh
+    AsyncPathfinder::WaitForMap(this);
+
     sScriptMgr->OnDestroyMap(this);
 
     // Delete all waiting spawns, else there will be a memory leak
@@ -128,7 +138,7 @@ m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry), m_terrain(sTerrainMgr.LoadTerrain(id)),  m_forceEnabledNavMeshFilterFlags(0), m_forceDisabledNavMeshFilterFlags(0),
-i_scriptLock(false), _respawnCheckTimer(0)
+m_pathCache(std::make_unique<PathCache>()), m_pathRequestsInFlight(std::make_unique<PathRequestCounter>()), m_prefetchedCellCount(0), i_scriptLock(false), _respawnCheckTimer(0)
 {
     for (uint32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
     {
@@ -141,6 +151,15 @@ i_scriptLock(false), _respawnCheckTimer(0)
 
     _zonePlayerCountMap.clear();
 
+    if (sWorld->getBoolConfig(CONFIG_SPATIAL_INDEX_UNITS))
+        m_spatialIndex = std::make_unique<MapSpatialIndex>();
+
+    if (sWorld->getBoolConfig(CONFIG_COMBAT_LOG_BATCHING))
+        m_combatLogQueue = std::make_unique<CombatLogQueue>();
+
+    if (sWorld->getBoolConfig(CONFIG_MOVEMENT_RELAY))
+        m_movementRelay = std::make_unique<MovementRelay>(sWorld->getFloatConfig(CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE), sWorld->getIntConfig(CONFIG_MOVEMENT_RELAY_FAR_INTERVAL));
+
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
 
@@ -379,6 +398,7 @@ void Map::EnsureGridLoadedForActiveObject(const Cell &cell, WorldObject* object)
 //Create NGrid and load the object data in it
 bool Map::EnsureGridLoaded(const Cell &cell)
 {
+    std::chrono::steady_clock::time_point loadStart = std::chrono::steady_clock::now();
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
     NGridType *grid = getNGrid(cell.GridX(), cell.GridY());
 
@@ -389,16 +409,97 @@ bool Map::EnsureGridLoaded(const Cell &cell)
 
         setGridObjectDataLoaded(true, cell.GridX(), cell.GridY());
 
+        // a prefetched grid may already have part of its cells spawned, continue after them
+        uint32 firstCell = 0;
+        if (!m_gridsToPrefetch.empty() && m_gridsToPrefetch.front() == GridCoord(cell.GridX(), cell.GridY()))
+        {
+            firstCell = m_prefetchedCellCount;
+            m_prefetchedCellCount = 0;
+            m_gridsToPrefetch.erase(m_gridsToPrefetch.begin());
+        }
+
         ObjectGridLoader loader(*grid, this, cell);
-        loader.LoadN();
+        loader.LoadN(firstCell);
 
         Balance();
+
+        GridPrefetcher::Statistics& statistics = GridPrefetcher::GetStatistics();
+        ++statistics.GridsLoaded;
+        statistics.GridLoadTimeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStart).count();
         return true;
     }
 
     return false;
 }
 
+void Map::PrefetchGridAhead(WorldObject const* object, float oldX, float oldY)
+{
+    bool prefetchTerrain = sGridPrefetcher->IsActive();
+    bool prefetchObjects = sWorld->getBoolConfig(CONFIG_GRID_PREFETCH_OBJECTS);
+    if (!prefetchTerrain && !prefetchObjects)
+        return;
+
+    float dx = object->GetPositionX() - oldX;
+    float dy = object->GetPositionY() - oldY;
+    float length = std::sqrt(dx * dx + dy * dy);
+    if (length < 0.1f)
+        return;
+
+    float distance = sWorld->getFloatConfig(CONFIG_GRID_PREFETCH_DISTANCE);
+    float x = object->GetPositionX() + dx / length * distance;
+    float y = object->GetPositionY() + dy / length * distance;
+    Trinity::NormalizeMapCoord(x);
+    Trinity::NormalizeMapCoord(y);
+
+    GridCoord gridCoord = Trinity::ComputeGridCoord(x, y);
+    if (!gridCoord.IsCoordValid() || IsGridLoaded(gridCoord))
+        return;
+
+    if (prefetchTerrain && !getNGrid(gridCoord.x_coord, gridCoord.y_coord))
+        sGridPrefetcher->Queue(m_terrain, (MAX_NUMBER_OF_GRIDS - 1) - gridCoord.x_coord, (MAX_NUMBER_OF_GRIDS - 1) - gridCoord.y_coord);
+
+    if (prefetchObjects && std::find(m_gridsToPrefetch.begin(), m_gridsToPrefetch.end(), gridCoord) == m_gridsToPrefetch.end())
+        m_gridsToPrefetch.push_back(gridCoord);
+}
+
+void Map::LoadPrefetchedGrids()
+{
+    // spawn objects cell by cell until the budget of this update is spent instead of the whole grid when the player crosses the border
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(sWorld->getIntConfig(CONFIG_GRID_PREFETCH_OBJECTS_BUDGET));
+    bool spawnedAny = false;
+    while (!m_gridsToPrefetch.empty())
+    {
+        GridCoord gridCoord = m_gridsToPrefetch.front();
+        if (IsGridLoaded(gridCoord))
+        {
+            m_gridsToPrefetch.erase(m_gridsToPrefetch.begin());
+            m_prefetchedCellCount = 0;
+            continue;
+        }
+
+        // always make progress, even if the budget is smaller than a single cell
+        if (spawnedAny && std::chrono::steady_clock::now() >= deadline)
+            break;
+
+        EnsureGridCreated(gridCoord);
+        NGridType* grid = getNGrid(gridCoord.x_coord, gridCoord.y_coord);
+        Cell cell(CellCoord(gridCoord.x_coord * MAX_NUMBER_OF_CELLS, gridCoord.y_coord * MAX_NUMBER_OF_CELLS));
+        ObjectGridLoader loader(*grid, this, cell);
+        loader.LoadCell(m_prefetchedCellCount++);
+        spawnedAny = true;
+
+        if (m_prefetchedCellCount < MAX_NUMBER_OF_CELLS * MAX_NUMBER_OF_CELLS)
+            continue;
+
+        setGridObjectDataLoaded(true, gridCoord.x_coord, gridCoord.y_coord);
+        Balance();
+
+        m_gridsToPrefetch.erase(m_gridsToPrefetch.begin());
+        m_prefetchedCellCount = 0;
+        ++GridPrefetcher::GetStatistics().ObjectPrefetches;
+    }
+}
+
 void Map::GridMarkNoUnload(uint32 x, uint32 y)
 {
     // First make sure this grid is loaded
@@ -634,6 +735,8 @@ void Map::Update(uint32 t_diff)
     else
         _respawnCheckTimer -= t_diff;
 
+    LoadPrefetchedGrids();
+
     /// update active cells around players and active objects
     resetMarkedCells();
 
@@ -718,6 +821,12 @@ void Map::Update(uint32 t_diff)
         obj->Update(t_diff);
     }
 
+    if (m_combatLogQueue)
+        m_combatLogQueue->Flush();
+
+    if (m_movementRelay)
+        m_movementRelay->Flush();
+
     SendObjectUpdates();
 
     ///- Process necessary scripts
@@ -946,12 +1055,19 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
     Cell old_cell(player->GetPositionX(), player->GetPositionY());
     Cell new_cell(x, y);
 
+    float oldX = player->GetPositionX();
+    float oldY = player->GetPositionY();
+
     player->Relocate(x, y, z, orientation);
+    if (m_spatialIndex)
+        m_spatialIndex->Update(player);
     if (player->IsVehicle())
         player->GetVehicleKit()->RelocatePassengers();
 
     if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
     {
+        PrefetchGridAhead(player, oldX, oldY);
+
         TC_LOG_DEBUG("maps", "Player %s relocation grid[%u, %u]cell[%u, %u]->grid[%u, %u]cell[%u, %u]", player->GetName().c_str(), old_cell.GridX(), old_cell.GridY(), old_cell.CellX(), old_cell.CellY(), new_cell.GridX(), new_cell.GridY(), new_cell.CellX(), new_cell.CellY());
 
         player->RemoveFromGrid();
@@ -988,6 +1104,8 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     else
     {
         creature->Relocate(x, y, z, ang);
+        if (m_spatialIndex)
+            m_spatialIndex->Update(creature);
         if (creature->IsVehicle())
             creature->GetVehicleKit()->RelocatePassengers();
         creature->UpdateObjectVisibility(false);
@@ -1134,6 +1252,8 @@ void Map::MoveAllCreaturesInMoveList()
         {
             // update pos
             c->Relocate(c->_newPosition);
+            if (m_spatialIndex)
+                m_spatialIndex->Update(c);
             if (c->IsVehicle())
                 c->GetVehicleKit()->RelocatePassengers();
             //CreatureRelocationNotify(c, new_cell, new_cell.cellCoord());
@@ -1349,6 +1469,8 @@ bool Map::CreatureRespawnRelocation(Creature* c, bool diffGridOnly)
     if (CreatureCellRelocation(c, resp_cell))
     {
         c->Relocate(resp_x, resp_y, resp_z, resp_o);
+        if (m_spatialIndex)
+            m_spatialIndex->Update(c);
         c->GetMotionMaster()->Initialize();                 // prevent possible problems with default move generators
         //CreatureRelocationNotify(c, resp_cell, resp_cell.GetCellCoord());
         c->UpdatePositionData();
@@ -1438,6 +1560,10 @@ bool Map::UnloadGrid(NGridType& ngrid, bool unloadAll)
 
         delete &ngrid;
         setNGrid(nullptr, x, y);
+
+        // objects of a partially prefetched grid are gone with it, start over if it gets prefetched again
+        if (!m_gridsToPrefetch.empty() && m_gridsToPrefetch.front() == GridCoord(x, y))
+            m_prefetchedCellCount = 0;
     }
     int gx = (MAX_NUMBER_OF_GRIDS - 1) - x;
     int gy = (MAX_NUMBER_OF_GRIDS - 1) - y;
@@ -3102,6 +3228,31 @@ BattlegroundMap::~BattlegroundMap()
     }
 }
 
+void BattlegroundMap::Update(uint32 diff)
+{
+    // the battleground is updated together with its map, finished ones are still deleted by BattlegroundMgr
+    if (!m_bg || m_bg->ToBeDeleted() || !sWorld->getBoolConfig(CONFIG_BATTLEGROUND_UPDATE_IN_MAP_THREADS))
+    {
+        Map::Update(diff);
+        return;
+    }
+
+    // covers the player and creature updates too, a kill may end the match
+    m_bg->SetUpdatingInMapThread(true);
+    m_bg->Update(diff);
+    Map::Update(diff);
+    m_bg->SetUpdatingInMapThread(false);
+}
+
+void BattlegroundMap::DelayedUpdate(uint32 diff)
+{
+    // world thread, what the battleground deferred while all maps were updated
+    if (m_bg && !m_bg->ToBeDeleted() && sWorld->getBoolConfig(CONFIG_BATTLEGROUND_UPDATE_IN_MAP_THREADS))
+        m_bg->UpdateDeferred(diff);
+
+    Map::DelayedUpdate(diff);
+}
+
 void BattlegroundMap::InitVisibilityDistance()
 {
     //init visibility distance for BG/Arenas
@@ -36,18 +36,24 @@
 #include "Transaction.h"
 #include "Weather.h"
 #include <boost/heap/fibonacci_heap.hpp>
+#include <atomic>
 #include <bitset>
 #include <list>
 #include <memory>
 
 class Battleground;
 class BattlegroundMap;
+class CombatLogQueue;
 class CreatureGroup;
 class Group;
 class InstanceMap;
 class InstanceSave;
 class InstanceScript;
+class MapSpatialIndex;
+class MovementRelay;
 class Object;
+class PathCache;
+class PathRequestCounter;
 class PhaseShift;
 class Player;
 class SpawnedPoolData;
@@ -250,6 +256,16 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void SetForceDisabledNavMeshFilterFlag(uint16 flag) { m_forceDisabledNavMeshFilterFlags |= flag; }
         void RemoveForceDisabledNavMeshFilterFlag(uint16 flag) { m_forceDisabledNavMeshFilterFlags &= ~flag; }
 
+        PathCache& GetPathCache() { return *m_pathCache; }
+        PathRequestCounter& GetPathRequestsInFlight() { return *m_pathRequestsInFlight; }
+
+        // nullptr unless enabled in config
+        MapSpatialIndex* GetSpatialIndex() const { return m_spatialIndex.get(); }
+        // nullptr unless enabled in config
+        CombatLogQueue* GetCombatLogQueue() const { return m_combatLogQueue.get(); }
+        // nullptr unless enabled in config
+        MovementRelay* GetMovementRelay() const { return m_movementRelay.get(); }
+
 
         void GetFullTerrainStatusForPosition(PhaseShift const& phaseShift, float x, float y, float z, PositionFullTerrainStatus& data, map_liquidHeaderTypeFlags reqLiquidType = map_liquidHeaderTypeFlags::AllLiquids, float collisionHeight = 2.03128f); // DEFAULT_COLLISION_HEIGHT in Object.h
         ZLiquidStatus GetLiquidStatus(PhaseShift const& phaseShift, float x, float y, float z, map_liquidHeaderTypeFlags ReqLiquidType, LiquidData* data = nullptr, float collisionHeight = 2.03128f); // DEFAULT_COLLISION_HEIGHT in Object.h
@@ -543,6 +559,10 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedForActiveObject(Cell const&, WorldObject* object);
 
+        // queue the grid an object is heading to, based on its movement since oldX/oldY
+        void PrefetchGridAhead(WorldObject const* object, float oldX, float oldY);
+        void LoadPrefetchedGrids();
+
         void buildNGridLinkage(NGridType* pNGridType) { pNGridType->link(this); }
 
         NGridType* getNGrid(uint32 x, uint32 y) const
@@ -597,6 +617,13 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::shared_ptr<TerrainInfo> m_terrain;
         uint16 m_forceEnabledNavMeshFilterFlags;
         uint16 m_forceDisabledNavMeshFilterFlags;
+        std::unique_ptr<PathCache> m_pathCache;
+        std::unique_ptr<PathRequestCounter> m_pathRequestsInFlight;
+        std::vector<GridCoord> m_gridsToPrefetch;
+        uint32 m_prefetchedCellCount;                       // cells of m_gridsToPrefetch.front() with objects already spawned
+        std::unique_ptr<MapSpatialIndex> m_spatialIndex;
+        std::unique_ptr<CombatLogQueue> m_combatLogQueue;
+        std::unique_ptr<MovementRelay> m_movementRelay;
 
         NGridType* i_grids[MAX_NUMBER_OF_GRIDS][MAX_NUMBER_OF_GRIDS];
         std::bitset<TOTAL_NUMBER_OF_CELLS_PER_MAP*TOTAL_NUMBER_OF_CELLS_PER_MAP> marked_cells;
@@ -825,6 +852,8 @@ class TC_GAME_API BattlegroundMap : public Map
         BattlegroundMap(uint32 id, time_t, uint32 InstanceId, uint8 spawnMode);
         ~BattlegroundMap();
 
+        void Update(uint32 diff) override;
+        void DelayedUpdate(uint32 diff) override;
         bool AddPlayerToMap(Player*) override;
         void RemovePlayerFromMap(Player*, bool) override;
         EnterState CannotEnter(Player* player) override;
@@ -16,10 +16,12 @@
  */
 
 #include "MapManager.h"
+#include "AsyncPathfinder.h"
 #include "Battleground.h"
 #include "Containers.h"
 #include "DatabaseEnv.h"
 #include "DBCStores.h"
+#include "GridPrefetcher.h"
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "Log.h"
@@ -64,6 +66,12 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (uint32 pathThreads = sWorld->getIntConfig(CONFIG_MMAP_ASYNC_PATH_THREADS))
+        sAsyncPathfinder->Activate(pathThreads);
+
+    if (uint32 prefetchThreads = sWorld->getIntConfig(CONFIG_GRID_PREFETCH_THREADS))
+        sGridPrefetcher->Activate(prefetchThreads);
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -422,6 +430,12 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    if (sAsyncPathfinder->IsActive())
+        sAsyncPathfinder->Deactivate();
+
+    if (sGridPrefetcher->IsActive())
+        sGridPrefetcher->Deactivate();
+
     Map::DeleteStateMachine();
 }
 
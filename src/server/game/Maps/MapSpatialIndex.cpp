@@ -0,0 +1,159 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapSpatialIndex.h"
+#include "CellImpl.h"
+#include "Errors.h"
+#include "GridDefines.h"
+#include "Unit.h"
+
+uint32 MapSpatialIndex::GetBucketId(float x, float y)
+{
+    CellCoord cellCoord = Trinity::ComputeCellCoord(x, y);
+    return cellCoord.GetId();
+}
+
+void MapSpatialIndex::Insert(Unit* unit)
+{
+    if (_locations.find(unit) != _locations.end())
+        return;
+
+    InsertInBucket(unit, GetBucketId(unit->GetPositionX(), unit->GetPositionY()));
+}
+
+void MapSpatialIndex::Update(Unit* unit)
+{
+    auto itr = _locations.find(unit);
+    if (itr == _locations.end())
+        return;
+
+    uint32 bucketId = GetBucketId(unit->GetPositionX(), unit->GetPositionY());
+    if (bucketId != itr->second.BucketId)
+    {
+        RemoveFromBucket(itr->second);
+        _locations.erase(itr);
+        InsertInBucket(unit, bucketId);
+        return;
+    }
+
+    Bucket& bucket = _buckets[bucketId];
+    uint32 slot = itr->second.Slot;
+    bucket.X[slot] = unit->GetPositionX();
+    bucket.Y[slot] = unit->GetPositionY();
+}
+
+void MapSpatialIndex::Remove(Unit* unit)
+{
+    auto itr = _locations.find(unit);
+    if (itr == _locations.end())
+        return;
+
+    RemoveFromBucket(itr->second);
+    _locations.erase(itr);
+}
+
+void MapSpatialIndex::InsertInBucket(Unit* unit, uint32 bucketId)
+{
+    Bucket& bucket = _buckets[bucketId];
+    _locations[unit] = { bucketId, uint32(bucket.Units.size()) };
+
+    bucket.X.push_back(unit->GetPositionX());
+    bucket.Y.push_back(unit->GetPositionY());
+    bucket.TypeMask.push_back(uint8(unit->GetTypeId() == TYPEID_PLAYER ? GRID_MAP_TYPE_MASK_PLAYER : GRID_MAP_TYPE_MASK_CREATURE));
+    bucket.Units.push_back(unit);
+}
+
+void MapSpatialIndex::RemoveFromBucket(Location const& location)
+{
+    auto bucketItr = _buckets.find(location.BucketId);
+    ASSERT(bucketItr != _buckets.end());
+
+    // swap with the last element to keep the arrays dense
+    Bucket& bucket = bucketItr->second;
+    uint32 last = uint32(bucket.Units.size() - 1);
+    if (location.Slot != last)
+    {
+        bucket.X[location.Slot] = bucket.X[last];
+        bucket.Y[location.Slot] = bucket.Y[last];
+        bucket.TypeMask[location.Slot] = bucket.TypeMask[last];
+        bucket.Units[location.Slot] = bucket.Units[last];
+        _locations[bucket.Units[location.Slot]].Slot = location.Slot;
+    }
+
+    bucket.X.pop_back();
+    bucket.Y.pop_back();
+    bucket.TypeMask.pop_back();
+    bucket.Units.pop_back();
+
+    if (bucket.Units.empty())
+        _buckets.erase(bucketItr);
+}
+
+bool MapSpatialIndex::Query(float x, float y, float radius, float padding, uint32 typeMask, std::vector<WorldObject*>& result) const
+{
+    CellCoord standingCell = Trinity::ComputeCellCoord(x, y);
+    if (!standingCell.IsCoordValid())
+        return true;
+
+    // same cell range as Cell::Visit
+    if (radius > SIZE_OF_GRIDS)
+        radius = SIZE_OF_GRIDS;
+
+    CellArea area = Cell::CalculateCellArea(x, y, radius);
+    if ((area.high_bound.x_coord > (area.low_bound.x_coord + 4)) && (area.high_bound.y_coord > (area.low_bound.y_coord + 4)))
+        return false;
+
+    float const range = radius + padding;
+    for (uint32 cellX = area.low_bound.x_coord; cellX <= area.high_bound.x_coord; ++cellX)
+    {
+        for (uint32 cellY = area.low_bound.y_coord; cellY <= area.high_bound.y_coord; ++cellY)
+        {
+            auto itr = _buckets.find(CellCoord(cellX, cellY).GetId());
+            if (itr == _buckets.end())
+                continue;
+
+            Bucket const& bucket = itr->second;
+            std::size_t const count = bucket.Units.size();
+            float const* posX = bucket.X.data();
+            float const* posY = bucket.Y.data();
+            uint8 const* unitTypeMask = bucket.TypeMask.data();
+
+            // combat reach changes without the unit moving (scale, display id, scripts), read the current value
+            _combatReach.resize(count);
+            float* combatReach = _combatReach.data();
+            for (std::size_t i = 0; i < count; ++i)
+                combatReach[i] = bucket.Units[i]->GetCombatReach();
+
+            // branch free pass over the coordinate arrays, the compiler vectorizes it
+            _inRange.resize(count);
+            uint8* inRange = _inRange.data();
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                float dx = posX[i] - x;
+                float dy = posY[i] - y;
+                float maxDist = range + combatReach[i];
+                inRange[i] = uint8((dx * dx + dy * dy <= maxDist * maxDist) & ((unitTypeMask[i] & typeMask) != 0));
+            }
+
+            for (std::size_t i = 0; i < count; ++i)
+                if (inRange[i])
+                    result.push_back(bucket.Units[i]);
+        }
+    }
+
+    return true;
+}
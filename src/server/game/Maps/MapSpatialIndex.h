@@ -0,0 +1,74 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAP_SPATIAL_INDEX_H
+#define _MAP_SPATIAL_INDEX_H
+
+#include "Define.h"
+#include <unordered_map>
+#include <vector>
+
+class Unit;
+class WorldObject;
+
+// Positions of all units in world on a map, bucketed by grid cell and stored
+// as contiguous arrays so range searches filter them without walking the grids
+class TC_GAME_API MapSpatialIndex
+{
+    public:
+        MapSpatialIndex() = default;
+        MapSpatialIndex(MapSpatialIndex const&) = delete;
+        MapSpatialIndex& operator=(MapSpatialIndex const&) = delete;
+
+        void Insert(Unit* unit);
+        void Update(Unit* unit);
+        void Remove(Unit* unit);
+
+        // Appends units matching typeMask from the cells Cell::Visit would search for radius,
+        // whose 2d distance to x, y is at most radius + padding + their combat reach.
+        // Returns false if the area is too big for the index, the grids must be searched instead.
+        bool Query(float x, float y, float radius, float padding, uint32 typeMask, std::vector<WorldObject*>& result) const;
+
+    private:
+        struct Bucket
+        {
+            std::vector<float> X;
+            std::vector<float> Y;
+            std::vector<uint8> TypeMask;
+            std::vector<Unit*> Units;
+        };
+
+        struct Location
+        {
+            uint32 BucketId;
+            uint32 Slot;
+        };
+
+        static uint32 GetBucketId(float x, float y);
+
+        void InsertInBucket(Unit* unit, uint32 bucketId);
+        void RemoveFromBucket(Location const& location);
+
+        std::unordered_map<uint32, Bucket> _buckets;
+        std::unordered_map<Unit*, Location> _locations;
+
+        // per slot combat reach and result of the distance pass, reused between queries
+        mutable std::vector<float> _combatReach;
+        mutable std::vector<uint8> _inRange;
+};
+
+#endif
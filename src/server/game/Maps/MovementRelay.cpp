@@ -0,0 +1,130 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MovementRelay.h"
+#include "CellImpl.h"
+#include "GameTime.h"
+#include "GridNotifiers.h"
+#include "Player.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+MovementRelay::Statistics& MovementRelay::GetStatistics()
+{
+    static Statistics statistics;
+    return statistics;
+}
+
+void MovementRelay::QueueHeartbeat(Unit* mover, Player const* skipped)
+{
+    auto itr = _pending.try_emplace(mover, PendingHeartbeat{ skipped ? skipped->GetGUID() : ObjectGuid::Empty, 0 });
+    if (!itr.second)
+        ++itr.first->second.Merged;
+
+    ++GetStatistics().QueuedHeartbeats;
+}
+
+void MovementRelay::CancelHeartbeat(Unit* mover)
+{
+    _pending.erase(mover);
+}
+
+void MovementRelay::RemoveMover(Unit* mover)
+{
+    _pending.erase(mover);
+    _lastSent.erase(mover->GetGUID());
+}
+
+uint32 MovementRelay::GetInterval(float distance, float visibilityRange) const
+{
+    if (distance <= _nearDistance || visibilityRange <= _nearDistance)
+        return 0;
+
+    float const ratio = std::min((distance - _nearDistance) / (visibilityRange - _nearDistance), 1.0f);
+    return uint32(_farInterval * ratio);
+}
+
+void MovementRelay::Flush()
+{
+    if (_pending.empty())
+        return;
+
+    uint32 const now = GameTime::GetGameTimeMS();
+    Statistics& statistics = GetStatistics();
+
+    for (auto const& [mover, heartbeat] : _pending)
+    {
+        float const visibilityRange = mover->GetVisibilityRange();
+
+        // same receivers as Unit::SendMessageToSet(packet, skipped)
+        _receivers.clear();
+        if (Player* player = mover->ToPlayer())
+            _receivers.push_back(player);
+
+        Trinity::MessageDistDeliverer notifier(mover, _receivers, visibilityRange);
+        Cell::VisitWorldObjects(mover, notifier, visibilityRange);
+
+        WorldPacket data(SMSG_MOVE_UPDATE);
+        mover->WriteMovementInfo(data);
+        std::size_t const packetSize = data.size() + sizeof(uint16) + sizeof(uint16);
+        SharedWorldPacket packet = std::make_shared<WorldPacket>(std::move(data));
+
+        std::unordered_map<ObjectGuid, uint32>& lastSent = _lastSent[mover->GetGUID()];
+        uint32 sent = 0;
+        uint32 throttled = 0;
+        for (Player* receiver : _receivers)
+        {
+            if (receiver->GetGUID() == heartbeat.SkippedGUID)
+                continue;
+
+            WorldObject const* seer = receiver->m_seer ? receiver->m_seer : receiver;
+            if (uint32 interval = GetInterval(seer->GetExactDist2d(mover), visibilityRange))
+            {
+                auto itr = lastSent.find(receiver->GetGUID());
+                if (itr != lastSent.end() && now - itr->second < interval)
+                {
+                    ++throttled;
+                    continue;
+                }
+
+                lastSent[receiver->GetGUID()] = now;
+            }
+
+            receiver->GetSession()->SendPacket(packet);
+            ++sent;
+        }
+
+        // viewers that left the reduced rate range are forgotten once they could have been sent to again
+        if (lastSent.size() > _receivers.size())
+        {
+            for (auto itr = lastSent.begin(); itr != lastSent.end();)
+            {
+                if (now - itr->second > _farInterval)
+                    itr = lastSent.erase(itr);
+                else
+                    ++itr;
+            }
+        }
+
+        uint64 const saved = uint64(heartbeat.Merged) * (sent + throttled) + throttled;
+        statistics.PacketsSent += sent;
+        statistics.PacketsSaved += saved;
+        statistics.BytesSaved += saved * packetSize;
+    }
+
+    _pending.clear();
+}
@@ -0,0 +1,80 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MOVEMENT_RELAY_H
+#define _MOVEMENT_RELAY_H
+
+#include "ObjectGuid.h"
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+class Player;
+class Unit;
+
+// Movement heartbeats of client controlled units of a map, relayed to the players around them at the end of the map update.
+// All heartbeats of a mover received during one update are merged into a single packet carrying its latest position,
+// which is built once for all viewers. Viewers farther away than the near distance receive it at a lower rate, down to
+// one packet per far interval at the edge of the visibility range. Movement state changes are never delayed.
+class TC_GAME_API MovementRelay
+{
+    public:
+        struct Statistics
+        {
+            std::atomic<uint64> QueuedHeartbeats = 0;
+            std::atomic<uint64> PacketsSent = 0;
+            std::atomic<uint64> PacketsSaved = 0;
+            std::atomic<uint64> BytesSaved = 0;
+        };
+
+        MovementRelay(float nearDistance, uint32 farInterval) : _nearDistance(nearDistance), _farInterval(farInterval) { }
+        MovementRelay(MovementRelay const&) = delete;
+        MovementRelay& operator=(MovementRelay const&) = delete;
+
+        // Queues the current movement of mover for its viewers, skipped is the player whose client moves it
+        void QueueHeartbeat(Unit* mover, Player const* skipped);
+        // Drops the queued heartbeat of mover, after a packet with newer movement was sent to its viewers
+        void CancelHeartbeat(Unit* mover);
+        // Must be called before a mover leaves the map
+        void RemoveMover(Unit* mover);
+
+        void Flush();
+        bool IsEmpty() const { return _pending.empty(); }
+
+        static Statistics& GetStatistics();
+
+    private:
+        struct PendingHeartbeat
+        {
+            ObjectGuid SkippedGUID;
+            uint32 Merged;  // heartbeats of the same update replaced by this one
+        };
+
+        uint32 GetInterval(float distance, float visibilityRange) const;
+
+        float _nearDistance;
+        uint32 _farInterval;
+
+        std::unordered_map<Unit*, PendingHeartbeat> _pending;
+        // time of the last heartbeat sent to viewers in reduced rate range, by mover and viewer
+        std::unordered_map<ObjectGuid, std::unordered_map<ObjectGuid, uint32>> _lastSent;
+
+        // receivers of the mover currently being flushed, reused between movers
+        std::vector<Player*> _receivers;
+};
+
+#endif
@@ -20,7 +20,9 @@
 #include "DisableMgr.h"
 #include "DynamicTree.h"
 #include "GridMap.h"
+#include "GridPrefetcher.h"
 #include "Log.h"
+#include "MapTree.h"
 #include "Memory.h"
 #include "MMapFactory.h"
 #include "PhasingHandler.h"
@@ -183,6 +185,80 @@ void TerrainInfo::LoadMapAndVMapImpl(int32 gx, int32 gy)
     _loadedGrids[GetBitsetIndex(gx, gy)] = true;
 }
 
+void TerrainInfo::PrefetchMapAndVMap(int32 gx, int32 gy)
+{
+    {
+        std::lock_guard<std::mutex> lock(_loadMutex);
+        if (_loadedGrids[GetBitsetIndex(gx, gy)])
+            return;
+    }
+
+    PrefetchMapAndVMapImpl(gx, gy);
+}
+
+static void ReadFileForPrefetch(std::string const& fileName)
+{
+    // only reads the file to have it in OS cache when the map thread loads it
+    auto file = Trinity::make_unique_ptr_with_deleter(fopen(fileName.c_str(), "rb"), &::fclose);
+    if (!file)
+        return;
+
+    char buffer[64 * 1024];
+    while (fread(buffer, 1, sizeof(buffer), file.get()) == sizeof(buffer))
+        ;
+}
+
+void TerrainInfo::PrefetchMapAndVMapImpl(int32 gx, int32 gy)
+{
+    int32 index = GetBitsetIndex(gx, gy);
+    bool alreadyPrefetched;
+    {
+        std::lock_guard<std::mutex> lock(_prefetchMutex);
+        alreadyPrefetched = _prefetchedGridMaps.find(index) != _prefetchedGridMaps.end();
+    }
+
+    // GridMap is self contained and can be fully loaded here
+    if (!alreadyPrefetched)
+    {
+        std::string fileName = Trinity::StringFormat("%smaps/%03u%02u%02u.map", sWorld->GetDataPath().c_str(), GetId(), gx, gy);
+        std::unique_ptr<GridMap> gridMap = std::make_unique<GridMap>();
+        if (gridMap->loadData(fileName.c_str()) == GridMap::LoadResult::Ok)
+        {
+            std::lock_guard<std::mutex> lock(_prefetchMutex);
+            _prefetchedGridMaps.try_emplace(index, PrefetchedGridMap{ std::move(gridMap), getMSTime() });
+        }
+    }
+
+    // vmap and mmap tiles are linked into trees used by running map updates, those are only read ahead
+    if (VMAP::VMapFactory::createOrGetVMapManager()->isMapLoadingEnabled())
+        ReadFileForPrefetch(sWorld->GetDataPath() + "vmaps/" + VMAP::StaticMapTree::getTileFileName(GetId(), gx, gy));
+
+    if (DisableMgr::IsPathfindingEnabled(GetId()))
+        ReadFileForPrefetch(Trinity::StringFormat("%smmaps/%03u%02i%02i.mmtile", sWorld->GetDataPath().c_str(), GetId(), gx, gy));
+
+    for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
+        childTerrain->PrefetchMapAndVMapImpl(gx, gy);
+}
+
+void TerrainInfo::RemoveExpiredPrefetchedGridMaps()
+{
+    {
+        uint32 now = getMSTime();
+        std::lock_guard<std::mutex> lock(_prefetchMutex);
+        for (auto itr = _prefetchedGridMaps.begin(); itr != _prefetchedGridMaps.end();)
+        {
+            // keep grids prefetched recently, the player heading to them may still be on the way
+            if (getMSTimeDiff(itr->second.PrefetchTime, now) >= uint32(CleanupInterval.count()) || _loadedGrids[itr->first])
+                itr = _prefetchedGridMaps.erase(itr);
+            else
+                ++itr;
+        }
+    }
+
+    for (std::shared_ptr<TerrainInfo> const& childTerrain : _childTerrain)
+        childTerrain->RemoveExpiredPrefetchedGridMaps();
+}
+
 void TerrainInfo::LoadMMapInstanceImpl(uint32 mapId, uint32 instanceId)
 {
     MMAP::MMapFactory::createOrGetMMapManager()->loadMapInstance(sWorld->GetDataPath(), _mapId, mapId, instanceId);
@@ -196,6 +272,18 @@ void TerrainInfo::LoadMap(int32 gx, int32 gy)
     if (!_gridFileExists[GetBitsetIndex(gx, gy)])
         return;
 
+    {
+        std::lock_guard<std::mutex> lock(_prefetchMutex);
+        auto itr = _prefetchedGridMaps.find(GetBitsetIndex(gx, gy));
+        if (itr != _prefetchedGridMaps.end())
+        {
+            _gridMap[gx][gy] = std::move(itr->second.Map);
+            _prefetchedGridMaps.erase(itr);
+            ++GridPrefetcher::GetStatistics().TerrainPrefetchHits;
+            return;
+        }
+    }
+
     // map file name
     std::string fileName = Trinity::StringFormat("%smaps/%03u%02u%02u.map", sWorld->GetDataPath().c_str(), GetId(), gx, gy);
     TC_LOG_DEBUG("maps", "Loading map %s", fileName.c_str());
@@ -312,11 +400,15 @@ void TerrainInfo::CleanUpGrids(uint32 diff)
         return;
 
     // delete those GridMap objects which have refcount = 0
+    std::lock_guard<std::mutex> lock(_loadMutex);
     for (int32 x = 0; x < MAX_NUMBER_OF_GRIDS; ++x)
         for (int32 y = 0; y < MAX_NUMBER_OF_GRIDS; ++y)
             if (_loadedGrids[GetBitsetIndex(x, y)] && !_referenceCountFromMap[x][y])
                 UnloadMapImpl(x, y);
 
+    // prefetched grids nobody walked into
+    RemoveExpiredPrefetchedGridMaps();
+
     _cleanupTimer.Reset(CleanupInterval.count());
 }
 
@@ -785,6 +877,8 @@ void TerrainMgr::UnloadAll()
 
 void TerrainMgr::Update(uint32 diff)
 {
+    sGridPrefetcher->ReleaseTerrains();
+
     // global garbage collection
     for (auto& [mapId, terrainRef] : _terrainMaps)
         if (std::shared_ptr<TerrainInfo> terrain = terrainRef.lock())
@@ -59,12 +59,17 @@ public:
     void LoadMapAndVMap(int32 gx, int32 gy);
     void LoadMMapInstance(uint32 mapId, uint32 instanceId);
 
+    // Reads grid files ahead of LoadMapAndVMap, called from prefetch threads
+    void PrefetchMapAndVMap(int32 gx, int32 gy);
+
 private:
     void LoadMapAndVMapImpl(int32 gx, int32 gy);
     void LoadMMapInstanceImpl(uint32 mapId, uint32 instanceId);
     void LoadMap(int32 gx, int32 gy);
     void LoadVMap(int32 gx, int32 gy);
     void LoadMMap(int32 gx, int32 gy);
+    void PrefetchMapAndVMapImpl(int32 gx, int32 gy);
+    void RemoveExpiredPrefetchedGridMaps();
 
 public:
     void UnloadMap(int32 gx, int32 gy);
@@ -115,6 +120,16 @@ private:
     std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _loadedGrids;
     std::bitset<MAX_NUMBER_OF_GRIDS* MAX_NUMBER_OF_GRIDS> _gridFileExists; // cache what grids are available for this map (not including parent/child maps)
 
+    // grid maps loaded by prefetch threads, waiting to be picked up by LoadMap
+    struct PrefetchedGridMap
+    {
+        std::unique_ptr<GridMap> Map;
+        uint32 PrefetchTime;    // getMSTime()
+    };
+
+    std::mutex _prefetchMutex;
+    std::unordered_map<int32, PrefetchedGridMap> _prefetchedGridMaps;
+
     static constexpr Milliseconds CleanupInterval = 1min;
 
     // global garbage collection timer
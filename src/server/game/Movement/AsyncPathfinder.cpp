@@ -0,0 +1,152 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "AsyncPathfinder.h"
+#include "Log.h"
+#include "Map.h"
+#include "MMapFactory.h"
+#include "MMapManager.h"
+#include "World.h"
+
+void PathRequest::Cancel()
+{
+    PathRequestState expected = PathRequestState::Queued;
+    State.compare_exchange_strong(expected, PathRequestState::Cancelled);
+}
+
+bool PathRequestCounter::TryAcquire(uint32 limit)
+{
+    uint32 count = _count.load(std::memory_order_relaxed);
+    do
+    {
+        if (count >= limit)
+            return false;
+    } while (!_count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+
+    return true;
+}
+
+void PathRequestCounter::Release()
+{
+    // decremented under the lock, Wait can't return and let the map destroy the counter before this is done with it
+    std::lock_guard<std::mutex> lock(_lock);
+    if (--_count == 0)
+        _idle.notify_all();
+}
+
+void PathRequestCounter::Wait()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _idle.wait(lock, [this] { return _count.load() == 0; });
+}
+
+AsyncPathfinder* AsyncPathfinder::instance()
+{
+    static AsyncPathfinder instance;
+    return &instance;
+}
+
+void AsyncPathfinder::Activate(std::size_t numThreads)
+{
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.emplace_back(&AsyncPathfinder::WorkerThread, this);
+}
+
+void AsyncPathfinder::Deactivate()
+{
+    _cancelationToken = true;
+
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+        thread.join();
+
+    _workerThreads.clear();
+}
+
+std::shared_ptr<PathRequest> AsyncPathfinder::Queue(Map* map, uint32 meshMapId, dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint, dtQueryFilter const& filter)
+{
+    PathRequestCounter& inFlight = map->GetPathRequestsInFlight();
+    if (!inFlight.TryAcquire(sWorld->getIntConfig(CONFIG_MMAP_ASYNC_PATH_MAX_REQUESTS)))
+        return nullptr;
+
+    std::shared_ptr<PathRequest> request = std::make_shared<PathRequest>();
+    request->MeshMapId = meshMapId;
+    request->StartPoly = startPoly;
+    request->EndPoly = endPoly;
+    std::copy(startPoint, startPoint + VERTEX_SIZE, request->StartPoint);
+    std::copy(endPoint, endPoint + VERTEX_SIZE, request->EndPoint);
+    request->Filter = filter;
+    request->InFlightCounter = &inFlight;
+
+    _queue.Push(request);
+    return request;
+}
+
+void AsyncPathfinder::WaitForMap(Map* map)
+{
+    map->GetPathRequestsInFlight().Wait();
+}
+
+void AsyncPathfinder::WorkerThread()
+{
+    while (true)
+    {
+        std::shared_ptr<PathRequest> request;
+
+        _queue.WaitAndPop(request);
+
+        if (_cancelationToken)
+            break;
+
+        if (!request)
+            continue;
+
+        PathRequestState expected = PathRequestState::Queued;
+        if (request->State.compare_exchange_strong(expected, PathRequestState::Running))
+        {
+            Process(*request);
+            request->State.store(PathRequestState::Completed, std::memory_order_release);
+        }
+
+        request->InFlightCounter->Release();
+    }
+
+    MMAP::MMapFactory::createOrGetMMapManager()->FreeThreadNavMeshQueries();
+}
+
+void AsyncPathfinder::Process(PathRequest& request)
+{
+    // keeps the map thread from adding or removing tiles during the search
+    std::shared_lock<std::shared_mutex> navMeshLock;
+    dtNavMeshQuery const* query = MMAP::MMapFactory::createOrGetMMapManager()->GetThreadNavMeshQuery(request.MeshMapId, navMeshLock);
+    if (!query)
+        return;
+
+    int pathLength = 0;
+    dtStatus result = query->findPath(request.StartPoly, request.EndPoly, request.StartPoint, request.EndPoint, &request.Filter,
+        request.Path, &pathLength, MAX_PATH_LENGTH);
+
+    if (dtStatusFailed(result))
+    {
+        TC_LOG_DEBUG("maps.mmaps", "AsyncPathfinder: findPath failed for mapId %03u", request.MeshMapId);
+        return;
+    }
+
+    request.PathLength = uint32(pathLength);
+}
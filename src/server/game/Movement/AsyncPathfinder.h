@@ -0,0 +1,111 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _ASYNC_PATHFINDER_H
+#define _ASYNC_PATHFINDER_H
+
+#include "Define.h"
+#include "PathGenerator.h"
+#include "ProducerConsumerQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class Map;
+
+enum class PathRequestState : uint8
+{
+    Queued,
+    Running,
+    Completed,
+    Cancelled
+};
+
+// Searches of one map that are queued or running on pathfinder threads
+class TC_GAME_API PathRequestCounter
+{
+    public:
+        PathRequestCounter() : _count(0) { }
+
+        // counts a new search unless limit searches are already in flight
+        bool TryAcquire(uint32 limit);
+        void Release();
+
+        // blocks until no search is in flight
+        void Wait();
+
+    private:
+        std::atomic<uint32> _count;
+        std::mutex _lock;
+        std::condition_variable _idle;
+};
+
+// Poly corridor search between two known polygons, executed on a pathfinder thread
+// Everything a worker needs is copied into the request, it never touches game objects
+struct PathRequest
+{
+    uint32 MeshMapId = 0;
+    dtPolyRef StartPoly = 0;
+    dtPolyRef EndPoly = 0;
+    float StartPoint[VERTEX_SIZE] = { };
+    float EndPoint[VERTEX_SIZE] = { };
+    dtQueryFilter Filter;
+
+    dtPolyRef Path[MAX_PATH_LENGTH] = { };
+    uint32 PathLength = 0;
+
+    std::atomic<PathRequestState> State = PathRequestState::Queued;
+    PathRequestCounter* InFlightCounter = nullptr;
+
+    bool IsCompleted() const { return State.load(std::memory_order_acquire) == PathRequestState::Completed; }
+    void Cancel();
+};
+
+class TC_GAME_API AsyncPathfinder
+{
+    public:
+        static AsyncPathfinder* instance();
+
+        void Activate(std::size_t numThreads);
+        void Deactivate();
+        bool IsActive() const { return !_workerThreads.empty(); }
+
+        // returns nullptr when the map already has too many searches in flight, caller should search synchronously
+        std::shared_ptr<PathRequest> Queue(Map* map, uint32 meshMapId, dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint, dtQueryFilter const& filter);
+
+        // blocks until no search queued by this map is still being processed
+        static void WaitForMap(Map* map);
+
+    private:
+        AsyncPathfinder() : _cancelationToken(false) { }
+        ~AsyncPathfinder() = default;
+
+        void WorkerThread();
+        static void Process(PathRequest& request);
+
+        ProducerConsumerQueue<std::shared_ptr<PathRequest>> _queue;
+        std::vector<std::thread> _workerThreads;
+        std::atomic<bool> _cancelationToken;
+};
+
+#define sAsyncPathfinder AsyncPathfinder::instance()
+
+#endif
@@ -93,6 +93,7 @@ void ChaseMovementGenerator::Initialize(Unit* owner)
     owner->AddUnitState(UNIT_STATE_CHASE);
     owner->SetWalk(false);
     _pathGenerator = std::make_unique<PathGenerator>(owner);
+    _pathGenerator->SetUseAsync(true);
     _moveTimer.Reset(0);
 }
 
@@ -197,6 +198,9 @@ void ChaseMovementGenerator::Finalize(Unit* owner)
     owner->ClearUnitState(UNIT_STATE_CHASE | UNIT_STATE_CHASE_MOVE);
     if (Creature* cOwner = owner->ToCreature())
         cOwner->SetCannotReachTarget(false);
+
+    if (_pathGenerator)
+        _pathGenerator->CancelPathRequest();
 }
 
 ChaseMovementPositionCheckResult ChaseMovementGenerator::checkPosition(ChasePositionCheckOptions checkOptions, Unit* owner, Unit* target, Position const* destination /*nullptr*/) const
@@ -244,6 +248,14 @@ void ChaseMovementGenerator::launchSpline(Unit* owner, Unit* target, Position& d
         startPoint.m_positionZ = owner->GetFloorZ();
 
     bool success = _pathGenerator->CalculatePath(startPoint, destination, owner->IsFlying());
+
+    // the path is still being searched in the background, keep the current spline and check again on the next position check
+    if (_pathGenerator->GetPathType() & PATHFIND_PENDING)
+    {
+        _moveTimer.Reset(0);
+        return;
+    }
+
     uint32 deniedPathResultTypes = PATHFIND_NOPATH | PATHFIND_INCOMPLETE;
     if ((!owner->IsFlying() || (target->IsInWater() && !owner->CanEnterWater())) && !owner->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING)) // only flying and swimming units and units with pathfinding disabled may use shortcuts an
         deniedPathResultTypes |= PATHFIND_SHORTCUT;
@@ -43,6 +43,7 @@ void FleeingMovementGenerator<T>::DoInitialize(T* owner)
 
     owner->SetFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_FLEEING);
     owner->AddUnitState(UNIT_STATE_FLEEING);
+    _pendingDestination.reset();
     SetTargetLocation(owner);
 }
 
@@ -57,6 +58,9 @@ void FleeingMovementGenerator<Player>::DoFinalize(Player* owner)
     owner->RemoveFlag(UNIT_FIELD_FLAGS, UNIT_FLAG_FLEEING);
     owner->ClearUnitState(UNIT_STATE_FLEEING);
     owner->StopMoving();
+
+    if (_path)
+        _path->CancelPathRequest();
 }
 
 template<>
@@ -66,6 +70,9 @@ void FleeingMovementGenerator<Creature>::DoFinalize(Creature* owner)
     owner->ClearUnitState(UNIT_STATE_FLEEING | UNIT_STATE_FLEEING_MOVE);
     if (owner->GetVictim())
         owner->SetTarget(owner->EnsureVictim()->GetGUID());
+
+    if (_path)
+        _path->CancelPathRequest();
 }
 
 template<class T>
@@ -112,20 +119,39 @@ void FleeingMovementGenerator<T>::SetTargetLocation(T* owner)
     owner->AddUnitState(UNIT_STATE_FLEEING_MOVE);
 
     Position destination = owner->GetPosition();
-    GetPoint(owner, destination);
-
-    // Add LOS check for target point
-    if (!owner->IsWithinLOS(destination.GetPositionX(), destination.GetPositionY(), destination.GetPositionZ()))
+    if (_pendingDestination)
     {
-        _timer.Reset(200);
-        return;
+        destination = *_pendingDestination;
+        _pendingDestination.reset();
+    }
+    else
+    {
+        GetPoint(owner, destination);
+
+        // Add LOS check for target point
+        if (!owner->IsWithinLOS(destination.GetPositionX(), destination.GetPositionY(), destination.GetPositionZ()))
+        {
+            _timer.Reset(200);
+            return;
+        }
     }
 
     if (!_path)
+    {
         _path = new PathGenerator(owner);
+        _path->SetUseAsync(true);
+    }
 
     _path->SetPathLengthLimit(30.0f);
     bool result = _path->CalculatePath(destination.GetPositionX(), destination.GetPositionY(), destination.GetPositionZ());
+    if (_path->GetPathType() & PATHFIND_PENDING)
+    {
+        // the path is searched in the background, pick it up for the same destination soon
+        _pendingDestination = destination;
+        _timer.Reset(100);
+        return;
+    }
+
     if (!result || (_path->GetPathType() & PATHFIND_NOPATH)
         || (_path->GetPathType() & PATHFIND_SHORTCUT)
         || (_path->GetPathType() & PATHFIND_FARFROMPOLY))
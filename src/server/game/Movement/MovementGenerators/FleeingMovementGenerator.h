@@ -19,6 +19,8 @@
 #define TRINITY_FLEEINGMOVEMENTGENERATOR_H
 
 #include "MovementGenerator.h"
+#include "Optional.h"
+#include "Position.h"
 #include "Timer.h"
 
 template<class T>
@@ -41,6 +43,7 @@ class FleeingMovementGenerator : public MovementGeneratorMedium< T, FleeingMovem
 
         PathGenerator* _path;
         ObjectGuid _fleeTargetGUID;
+        Optional<Position> _pendingDestination; // destination of a path still searched in the background
         TimeTracker _timer;
         bool _interrupt;
 };
@@ -71,6 +71,7 @@ void RandomMovementGenerator<Creature>::DoInitialize(Creature* owner)
     // Retail seems to let a creature walk 2 up to 10 splines before triggering a pause
     _wanderSteps = urand(2, 10);
 
+    _pendingDestination.reset();
     _timer.Reset(0);
 }
 
@@ -83,6 +84,10 @@ void RandomMovementGenerator<Creature>::DoFinalize(Creature* owner)
     owner->ClearUnitState(UNIT_STATE_ROAMING);
     owner->StopMoving();
     owner->SetWalk(false);
+
+    if (_path)
+        _path->CancelPathRequest();
+    _pendingDestination.reset();
 }
 
 template<class T>
@@ -113,21 +118,40 @@ void RandomMovementGenerator<Creature>::SetRandomLocation(Creature* owner)
     owner->AddUnitState(UNIT_STATE_ROAMING_MOVE);
 
     Position position(_reference);
-    float distance = _wanderDistance > 0.1f ? frand(0.1f, _wanderDistance) : _wanderDistance;
-    float angle = frand(0.f, static_cast<float>(M_PI * 2));
-    owner->MovePositionToFirstCollision(position, distance, angle);
-    if (owner->GetPosition().GetExactDist(position) < 0.1f)
+    if (_pendingDestination)
     {
-        // the path is too short for the spline system to be accepted. Let's try again soon.
-        _timer.Reset(500);
-        return;
+        position = *_pendingDestination;
+        _pendingDestination.reset();
+    }
+    else
+    {
+        float distance = _wanderDistance > 0.1f ? frand(0.1f, _wanderDistance) : _wanderDistance;
+        float angle = frand(0.f, static_cast<float>(M_PI * 2));
+        owner->MovePositionToFirstCollision(position, distance, angle);
+        if (owner->GetPosition().GetExactDist(position) < 0.1f)
+        {
+            // the path is too short for the spline system to be accepted. Let's try again soon.
+            _timer.Reset(500);
+            return;
+        }
     }
 
     if (!_path)
+    {
         _path = new PathGenerator(owner);
+        _path->SetUseAsync(true);
+    }
 
     _path->SetPathLengthLimit(30.0f);
     bool result = _path->CalculatePath(position.GetPositionX(), position.GetPositionY(), position.GetPositionZ());
+    if (_path->GetPathType() & PATHFIND_PENDING)
+    {
+        // the path is searched in the background, pick it up for the same destination soon
+        _pendingDestination = position;
+        _timer.Reset(100);
+        return;
+    }
+
     // PATHFIND_FARFROMPOLY shouldn't be checked as creatures in water are most likely far from poly
     if (!result || (_path->GetPathType() & PATHFIND_NOPATH)
         || (_path->GetPathType() & PATHFIND_SHORTCUT)
@@ -19,6 +19,7 @@
 #define TRINITY_RANDOMMOTIONGENERATOR_H
 
 #include "MovementGenerator.h"
+#include "Optional.h"
 #include "Position.h"
 #include "Timer.h"
 
@@ -45,6 +46,7 @@ class RandomMovementGenerator : public MovementGeneratorMedium< T, RandomMovemen
         PathGenerator* _path;
         TimeTracker _timer;
         Position _reference;
+        Optional<Position> _pendingDestination; // destination of a path still searched in the background
         float _wanderDistance;
         uint8 _wanderSteps;
         bool _interrupt;
@@ -18,8 +18,11 @@
 #include "MovementStructures.h"
 #include "Log.h"
 #include "Player.h"
+#include <G3D/g3dmath.h>
+#include <iterator>
+#include <utility>
 
-MovementStatusElements const MovementUpdate[] =
+constexpr MovementStatusElements MovementUpdate[] =
 {
     MSEHasFallData,
     MSEHasGuidByte3,
@@ -92,7 +95,7 @@ MovementStatusElements const MovementUpdate[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementFallLand[] =
+constexpr MovementStatusElements MovementFallLand[] =
 {
     MSEPositionX,
     MSEPositionY,
@@ -164,7 +167,7 @@ MovementStatusElements const MovementFallLand[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementHeartBeat[] =
+constexpr MovementStatusElements MovementHeartBeat[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -236,7 +239,7 @@ MovementStatusElements const MovementHeartBeat[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementJump[] =
+constexpr MovementStatusElements MovementJump[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -308,7 +311,7 @@ MovementStatusElements const MovementJump[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetFacing[] =
+constexpr MovementStatusElements MovementSetFacing[] =
 {
     MSEPositionX,
     MSEPositionY,
@@ -380,7 +383,7 @@ MovementStatusElements const MovementSetFacing[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetPitch[] =
+constexpr MovementStatusElements MovementSetPitch[] =
 {
     MSEPositionX,
     MSEPositionZ,
@@ -452,7 +455,7 @@ MovementStatusElements const MovementSetPitch[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartBackward[] =
+constexpr MovementStatusElements MovementStartBackward[] =
 {
     MSEPositionX,
     MSEPositionZ,
@@ -524,7 +527,7 @@ MovementStatusElements const MovementStartBackward[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartForward[] =
+constexpr MovementStatusElements MovementStartForward[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -596,7 +599,7 @@ MovementStatusElements const MovementStartForward[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartStrafeLeft[] =
+constexpr MovementStatusElements MovementStartStrafeLeft[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -668,7 +671,7 @@ MovementStatusElements const MovementStartStrafeLeft[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartStrafeRight[] =
+constexpr MovementStatusElements MovementStartStrafeRight[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -740,7 +743,7 @@ MovementStatusElements const MovementStartStrafeRight[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartTurnLeft[] =
+constexpr MovementStatusElements MovementStartTurnLeft[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -812,7 +815,7 @@ MovementStatusElements const MovementStartTurnLeft[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartTurnRight[] =
+constexpr MovementStatusElements MovementStartTurnRight[] =
 {
     MSEPositionX,
     MSEPositionZ,
@@ -884,7 +887,7 @@ MovementStatusElements const MovementStartTurnRight[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStop[] =
+constexpr MovementStatusElements MovementStop[] =
 {
     MSEPositionX,
     MSEPositionY,
@@ -956,7 +959,7 @@ MovementStatusElements const MovementStop[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStopStrafe[] =
+constexpr MovementStatusElements MovementStopStrafe[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -1028,7 +1031,7 @@ MovementStatusElements const MovementStopStrafe[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStopTurn[] =
+constexpr MovementStatusElements MovementStopTurn[] =
 {
     MSEPositionX,
     MSEPositionZ,
@@ -1100,7 +1103,7 @@ MovementStatusElements const MovementStopTurn[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartAscend[] =
+constexpr MovementStatusElements MovementStartAscend[] =
 {
     MSEPositionX,
     MSEPositionY,
@@ -1172,7 +1175,7 @@ MovementStatusElements const MovementStartAscend[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartDescend[] =
+constexpr MovementStatusElements MovementStartDescend[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -1244,7 +1247,7 @@ MovementStatusElements const MovementStartDescend[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartSwim[] =
+constexpr MovementStatusElements MovementStartSwim[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -1316,7 +1319,7 @@ MovementStatusElements const MovementStartSwim[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStopSwim[] =
+constexpr MovementStatusElements MovementStopSwim[] =
 {
     MSEPositionX,
     MSEPositionY,
@@ -1388,7 +1391,7 @@ MovementStatusElements const MovementStopSwim[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStopAscend[] =
+constexpr MovementStatusElements MovementStopAscend[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -1460,7 +1463,7 @@ MovementStatusElements const MovementStopAscend[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStopPitch[] =
+constexpr MovementStatusElements MovementStopPitch[] =
 {
     MSEPositionX,
     MSEPositionZ,
@@ -1532,7 +1535,7 @@ MovementStatusElements const MovementStopPitch[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartPitchDown[] =
+constexpr MovementStatusElements MovementStartPitchDown[] =
 {
     MSEPositionX,
     MSEPositionZ,
@@ -1604,7 +1607,7 @@ MovementStatusElements const MovementStartPitchDown[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementStartPitchUp[] =
+constexpr MovementStatusElements MovementStartPitchUp[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -1676,7 +1679,7 @@ MovementStatusElements const MovementStartPitchUp[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveChngTransport[]=
+constexpr MovementStatusElements MoveChngTransport[]=
 {
     MSEPositionY,
     MSEPositionX,
@@ -1748,7 +1751,7 @@ MovementStatusElements const MoveChngTransport[]=
     MSEEnd,
 };
 
-MovementStatusElements const MoveSplineDone[] =
+constexpr MovementStatusElements MoveSplineDone[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -1827,7 +1830,7 @@ MovementStatusElements const MoveSplineDone[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveNotActiveMover[] =
+constexpr MovementStatusElements MoveNotActiveMover[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -1906,7 +1909,7 @@ MovementStatusElements const MoveNotActiveMover[] =
     MSEEnd,
 };
 
-MovementStatusElements const DismissControlledVehicle[] =
+constexpr MovementStatusElements DismissControlledVehicle[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -1985,7 +1988,7 @@ MovementStatusElements const DismissControlledVehicle[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetRunMode[] =
+constexpr MovementStatusElements MovementSetRunMode[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -2057,7 +2060,7 @@ MovementStatusElements const MovementSetRunMode[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetWalkMode[] =
+constexpr MovementStatusElements MovementSetWalkMode[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -2129,7 +2132,7 @@ MovementStatusElements const MovementSetWalkMode[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCanFly[] =
+constexpr MovementStatusElements MovementSetCanFly[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -2201,7 +2204,7 @@ MovementStatusElements const MovementSetCanFly[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
+constexpr MovementStatusElements MovementSetCanTransitionBetweenSwimAndFlyAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -2274,7 +2277,7 @@ MovementStatusElements const MovementSetCanTransitionBetweenSwimAndFlyAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateSwimSpeed[] =
+constexpr MovementStatusElements MovementUpdateSwimSpeed[] =
 {
     MSEHasMovementFlags,
     MSEHasGuidByte2,
@@ -2348,7 +2351,7 @@ MovementStatusElements const MovementUpdateSwimSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateRunSpeed[] =
+constexpr MovementStatusElements MovementUpdateRunSpeed[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -2422,7 +2425,7 @@ MovementStatusElements const MovementUpdateRunSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateFlightSpeed[] =
+constexpr MovementStatusElements MovementUpdateFlightSpeed[] =
 {
     MSEPositionY,
     MSEExtraElement,
@@ -2496,7 +2499,7 @@ MovementStatusElements const MovementUpdateFlightSpeed[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementSetCollisionHeight[] =
+constexpr MovementStatusElements MovementSetCollisionHeight[] =
 {
     MSEExtraElement,
     MSEHasGuidByte6,
@@ -2521,7 +2524,7 @@ MovementStatusElements const MovementSetCollisionHeight[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateCollisionHeight[] =
+constexpr MovementStatusElements MovementUpdateCollisionHeight[] =
 {
     MSEPositionZ,
     MSEExtraElement,
@@ -2595,7 +2598,7 @@ MovementStatusElements const MovementUpdateCollisionHeight[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceRunSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceRunSpeedChangeAck[] =
 {
     MSECounter,
     MSEPositionX,
@@ -2669,7 +2672,7 @@ MovementStatusElements const MovementForceRunSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetCollisionHeightAck[] =
+constexpr MovementStatusElements MovementSetCollisionHeightAck[] =
 {
     MSEExtraElement, // Height
     MSEPositionX,
@@ -2744,7 +2747,7 @@ MovementStatusElements const MovementSetCollisionHeightAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceFlightSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceFlightSpeedChangeAck[] =
 {
     MSECounter,
     MSEPositionZ,
@@ -2818,7 +2821,7 @@ MovementStatusElements const MovementForceFlightSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementSetCanFlyAck[] =
+constexpr MovementStatusElements MovementSetCanFlyAck[] =
 {
     MSEPositionY,
     MSECounter,
@@ -2891,7 +2894,7 @@ MovementStatusElements const MovementSetCanFlyAck[] =
     MSEEnd,
 };
 
-MovementStatusElements MoveForceSwimBackSpeedChangeAck[] =
+constexpr MovementStatusElements MoveForceSwimBackSpeedChangeAck[] =
 {
     MSEExtraElement,
     MSEPositionX,
@@ -2974,7 +2977,7 @@ MovementStatusElements MoveForceSwimBackSpeedChangeAck[] =
 };
 
 //4.3.4
-MovementStatusElements MoveForceFlightBackSpeedChangeAck[] =
+constexpr MovementStatusElements MoveForceFlightBackSpeedChangeAck[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -3056,7 +3059,7 @@ MovementStatusElements MoveForceFlightBackSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceSwimSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceSwimSpeedChangeAck[] =
 {
     MSEPositionX,
     MSECounter,
@@ -3131,7 +3134,7 @@ MovementStatusElements const MovementForceSwimSpeedChangeAck[] =
 };
 
 
-MovementStatusElements const MovementForceWalkSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceWalkSpeedChangeAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -3205,7 +3208,7 @@ MovementStatusElements const MovementForceWalkSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementForceRunBackSpeedChangeAck[] =
+constexpr MovementStatusElements MovementForceRunBackSpeedChangeAck[] =
 {
     MSEExtraElement,
     MSECounter,
@@ -3279,7 +3282,7 @@ MovementStatusElements const MovementForceRunBackSpeedChangeAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateRunBackSpeed[] =
+constexpr MovementStatusElements MovementUpdateRunBackSpeed[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte2,
@@ -3340,7 +3343,7 @@ MovementStatusElements const MovementUpdateRunBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementUpdateWalkSpeed[] =
+constexpr MovementStatusElements MovementUpdateWalkSpeed[] =
 {
     MSEHasOrientation,
     MSEZeroBit,
@@ -3401,7 +3404,7 @@ MovementStatusElements const MovementUpdateWalkSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const ForceMoveRootAck[] =
+constexpr MovementStatusElements ForceMoveRootAck[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -3474,7 +3477,7 @@ MovementStatusElements const ForceMoveRootAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const ForceMoveUnrootAck[] =
+constexpr MovementStatusElements ForceMoveUnrootAck[] =
 {
     MSECounter,
     MSEPositionZ,
@@ -3548,7 +3551,7 @@ MovementStatusElements const ForceMoveUnrootAck[] =
 };
 
 //4.3.4
-MovementStatusElements MoveUpdateSwimBackSpeed[] =
+constexpr MovementStatusElements MoveUpdateSwimBackSpeed[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte2,
@@ -3622,7 +3625,7 @@ MovementStatusElements MoveUpdateSwimBackSpeed[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementFallReset[] =
+constexpr MovementStatusElements MovementFallReset[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -3694,7 +3697,7 @@ MovementStatusElements const MovementFallReset[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementFeatherFallAck[] =
+constexpr MovementStatusElements MovementFeatherFallAck[] =
 {
     MSEPositionZ,
     MSECounter,
@@ -3767,7 +3770,7 @@ MovementStatusElements const MovementFeatherFallAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementGravityDisableAck[] =
+constexpr MovementStatusElements MovementGravityDisableAck[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -3840,7 +3843,7 @@ MovementStatusElements const MovementGravityDisableAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementGravityEnableAck[] =
+constexpr MovementStatusElements MovementGravityEnableAck[] =
 {
     MSEPositionZ,
     MSEPositionX,
@@ -3913,7 +3916,7 @@ MovementStatusElements const MovementGravityEnableAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementHoverAck[] =
+constexpr MovementStatusElements MovementHoverAck[] =
 {
     MSECounter,
     MSEPositionZ,
@@ -3986,7 +3989,7 @@ MovementStatusElements const MovementHoverAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementKnockBackAck[] =
+constexpr MovementStatusElements MovementKnockBackAck[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -4059,7 +4062,7 @@ MovementStatusElements const MovementKnockBackAck[] =
     MSEEnd,
 };
 
-MovementStatusElements const MovementWaterWalkAck[] =
+constexpr MovementStatusElements MovementWaterWalkAck[] =
 {
     MSEPositionY,
     MSEPositionZ,
@@ -4132,7 +4135,7 @@ MovementStatusElements const MovementWaterWalkAck[] =
     MSEEnd
 };
 
-MovementStatusElements const MovementUpdateKnockBack[] =
+constexpr MovementStatusElements MovementUpdateKnockBack[] =
 {
     MSEZeroBit,
     MSEHasGuidByte4,
@@ -4192,7 +4195,7 @@ MovementStatusElements const MovementUpdateKnockBack[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWalkSpeed[] =
+constexpr MovementStatusElements SplineMoveSetWalkSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte6,
@@ -4214,7 +4217,7 @@ MovementStatusElements const SplineMoveSetWalkSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunSpeed[] =
+constexpr MovementStatusElements SplineMoveSetRunSpeed[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte0,
@@ -4236,7 +4239,7 @@ MovementStatusElements const SplineMoveSetRunSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunBackSpeed[] =
+constexpr MovementStatusElements SplineMoveSetRunBackSpeed[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte2,
@@ -4258,7 +4261,7 @@ MovementStatusElements const SplineMoveSetRunBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetSwimSpeed[] =
+constexpr MovementStatusElements SplineMoveSetSwimSpeed[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte2,
@@ -4280,7 +4283,7 @@ MovementStatusElements const SplineMoveSetSwimSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetSwimBackSpeed[] =
+constexpr MovementStatusElements SplineMoveSetSwimBackSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte1,
@@ -4302,7 +4305,7 @@ MovementStatusElements const SplineMoveSetSwimBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetTurnRate[] =
+constexpr MovementStatusElements SplineMoveSetTurnRate[] =
 {
     MSEHasGuidByte2,
     MSEHasGuidByte4,
@@ -4324,7 +4327,7 @@ MovementStatusElements const SplineMoveSetTurnRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlightSpeed[] =
+constexpr MovementStatusElements SplineMoveSetFlightSpeed[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte4,
@@ -4346,7 +4349,7 @@ MovementStatusElements const SplineMoveSetFlightSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlightBackSpeed[] =
+constexpr MovementStatusElements SplineMoveSetFlightBackSpeed[] =
 {
     MSEHasGuidByte2,
     MSEHasGuidByte1,
@@ -4368,7 +4371,7 @@ MovementStatusElements const SplineMoveSetFlightBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetPitchRate[] =
+constexpr MovementStatusElements SplineMoveSetPitchRate[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -4390,7 +4393,7 @@ MovementStatusElements const SplineMoveSetPitchRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetWalkSpeed[] =
+constexpr MovementStatusElements MoveSetWalkSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte4,
@@ -4413,7 +4416,7 @@ MovementStatusElements const MoveSetWalkSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetRunSpeed[] =
+constexpr MovementStatusElements MoveSetRunSpeed[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte1,
@@ -4436,7 +4439,7 @@ MovementStatusElements const MoveSetRunSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetRunBackSpeed[] =
+constexpr MovementStatusElements MoveSetRunBackSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte6,
@@ -4459,7 +4462,7 @@ MovementStatusElements const MoveSetRunBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetSwimSpeed[] =
+constexpr MovementStatusElements MoveSetSwimSpeed[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte4,
@@ -4482,7 +4485,7 @@ MovementStatusElements const MoveSetSwimSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetSwimBackSpeed[] =
+constexpr MovementStatusElements MoveSetSwimBackSpeed[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte2,
@@ -4505,7 +4508,7 @@ MovementStatusElements const MoveSetSwimBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetTurnRate[] =
+constexpr MovementStatusElements MoveSetTurnRate[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte2,
@@ -4528,7 +4531,7 @@ MovementStatusElements const MoveSetTurnRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetFlightSpeed[] =
+constexpr MovementStatusElements MoveSetFlightSpeed[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte5,
@@ -4551,7 +4554,7 @@ MovementStatusElements const MoveSetFlightSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetFlightBackSpeed[] =
+constexpr MovementStatusElements MoveSetFlightBackSpeed[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte2,
@@ -4574,7 +4577,7 @@ MovementStatusElements const MoveSetFlightBackSpeed[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetPitchRate[] =
+constexpr MovementStatusElements MoveSetPitchRate[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte2,
@@ -4597,7 +4600,7 @@ MovementStatusElements const MoveSetPitchRate[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWalkMode[] =
+constexpr MovementStatusElements SplineMoveSetWalkMode[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte6,
@@ -4618,7 +4621,7 @@ MovementStatusElements const SplineMoveSetWalkMode[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetRunMode[] =
+constexpr MovementStatusElements SplineMoveSetRunMode[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte6,
@@ -4639,7 +4642,7 @@ MovementStatusElements const SplineMoveSetRunMode[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveGravityDisable[] =
+constexpr MovementStatusElements SplineMoveGravityDisable[] =
 {
     MSEHasGuidByte7,
     MSEHasGuidByte3,
@@ -4660,7 +4663,7 @@ MovementStatusElements const SplineMoveGravityDisable[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveGravityEnable[] =
+constexpr MovementStatusElements SplineMoveGravityEnable[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte4,
@@ -4681,7 +4684,7 @@ MovementStatusElements const SplineMoveGravityEnable[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetHover[] =
+constexpr MovementStatusElements SplineMoveSetHover[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte7,
@@ -4702,7 +4705,7 @@ MovementStatusElements const SplineMoveSetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnsetHover[] =
+constexpr MovementStatusElements SplineMoveUnsetHover[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte7,
@@ -4723,7 +4726,7 @@ MovementStatusElements const SplineMoveUnsetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveStartSwim[] =
+constexpr MovementStatusElements SplineMoveStartSwim[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte6,
@@ -4744,7 +4747,7 @@ MovementStatusElements const SplineMoveStartSwim[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveStopSwim[] =
+constexpr MovementStatusElements SplineMoveStopSwim[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte1,
@@ -4765,7 +4768,7 @@ MovementStatusElements const SplineMoveStopSwim[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFlying[] =
+constexpr MovementStatusElements SplineMoveSetFlying[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte4,
@@ -4786,7 +4789,7 @@ MovementStatusElements const SplineMoveSetFlying[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnsetFlying[] =
+constexpr MovementStatusElements SplineMoveUnsetFlying[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte0,
@@ -4807,7 +4810,7 @@ MovementStatusElements const SplineMoveUnsetFlying[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetWaterWalk[] =
+constexpr MovementStatusElements SplineMoveSetWaterWalk[] =
 {
     MSEHasGuidByte6,
     MSEHasGuidByte1,
@@ -4828,7 +4831,7 @@ MovementStatusElements const SplineMoveSetWaterWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetLandWalk[] =
+constexpr MovementStatusElements SplineMoveSetLandWalk[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte0,
@@ -4849,7 +4852,7 @@ MovementStatusElements const SplineMoveSetLandWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetFeatherFall[] =
+constexpr MovementStatusElements SplineMoveSetFeatherFall[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte2,
@@ -4870,7 +4873,7 @@ MovementStatusElements const SplineMoveSetFeatherFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveSetNormalFall[] =
+constexpr MovementStatusElements SplineMoveSetNormalFall[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte5,
@@ -4891,7 +4894,7 @@ MovementStatusElements const SplineMoveSetNormalFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveRoot[] =
+constexpr MovementStatusElements SplineMoveRoot[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte4,
@@ -4912,7 +4915,7 @@ MovementStatusElements const SplineMoveRoot[] =
     MSEEnd,
 };
 
-MovementStatusElements const SplineMoveUnroot[] =
+constexpr MovementStatusElements SplineMoveUnroot[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte1,
@@ -4933,7 +4936,7 @@ MovementStatusElements const SplineMoveUnroot[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetCanFly[] =
+constexpr MovementStatusElements MoveSetCanFly[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte6,
@@ -4955,7 +4958,7 @@ MovementStatusElements const MoveSetCanFly[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetCanFly[] =
+constexpr MovementStatusElements MoveUnsetCanFly[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte4,
@@ -4977,7 +4980,7 @@ MovementStatusElements const MoveUnsetCanFly[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveSetHover[] =
+constexpr MovementStatusElements MoveSetHover[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte4,
@@ -4999,7 +5002,7 @@ MovementStatusElements const MoveSetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetHover[] =
+constexpr MovementStatusElements MoveUnsetHover[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte6,
@@ -5021,7 +5024,7 @@ MovementStatusElements const MoveUnsetHover[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveWaterWalk[] =
+constexpr MovementStatusElements MoveWaterWalk[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte7,
@@ -5043,7 +5046,7 @@ MovementStatusElements const MoveWaterWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveLandWalk[] =
+constexpr MovementStatusElements MoveLandWalk[] =
 {
     MSEHasGuidByte5,
     MSEHasGuidByte1,
@@ -5065,7 +5068,7 @@ MovementStatusElements const MoveLandWalk[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveFeatherFall[] =
+constexpr MovementStatusElements MoveFeatherFall[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte1,
@@ -5087,7 +5090,7 @@ MovementStatusElements const MoveFeatherFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveNormalFall[] =
+constexpr MovementStatusElements MoveNormalFall[] =
 {
     MSECounter,
     MSEHasGuidByte3,
@@ -5109,7 +5112,7 @@ MovementStatusElements const MoveNormalFall[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveRoot[] =
+constexpr MovementStatusElements MoveRoot[] =
 {
     MSEHasGuidByte2,
     MSEHasGuidByte7,
@@ -5131,7 +5134,7 @@ MovementStatusElements const MoveRoot[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnroot[] =
+constexpr MovementStatusElements MoveUnroot[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte1,
@@ -5153,7 +5156,7 @@ MovementStatusElements const MoveUnroot[] =
     MSEEnd,
 };
 
-MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
+constexpr MovementStatusElements ChangeSeatsOnControlledVehicle[] =
 {
     MSEPositionY,
     MSEPositionX,
@@ -5242,7 +5245,7 @@ MovementStatusElements const ChangeSeatsOnControlledVehicle[] =
     MSEEnd,
 };
 
-MovementStatusElements const CastSpellEmbeddedMovement[] =
+constexpr MovementStatusElements CastSpellEmbeddedMovement[] =
 {
     MSEPositionZ,
     MSEPositionY,
@@ -5314,7 +5317,7 @@ MovementStatusElements const CastSpellEmbeddedMovement[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveGravityDisable[] =
+constexpr MovementStatusElements MoveGravityDisable[] =
 {
     MSEHasGuidByte0,
     MSEHasGuidByte1,
@@ -5336,7 +5339,7 @@ MovementStatusElements const MoveGravityDisable[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveGravityEnable[] =
+constexpr MovementStatusElements MoveGravityEnable[] =
 {
     MSEHasGuidByte1,
     MSEHasGuidByte4,
@@ -5358,7 +5361,7 @@ MovementStatusElements const MoveGravityEnable[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUpdateFlightBackSpeed[] =
+constexpr MovementStatusElements MoveUpdateFlightBackSpeed[] =
 {
     MSEPositionY,
     MSEExtraElement,
@@ -5430,7 +5433,7 @@ MovementStatusElements const MoveUpdateFlightBackSpeed[] =
     MSEEnd
 };
 
-MovementStatusElements const MoveSetCanTransitionBetweenSwimAndFly[] =
+constexpr MovementStatusElements MoveSetCanTransitionBetweenSwimAndFly[] =
 {
     MSEHasGuidByte4,
     MSEHasGuidByte5,
@@ -5452,7 +5455,7 @@ MovementStatusElements const MoveSetCanTransitionBetweenSwimAndFly[] =
     MSEEnd,
 };
 
-MovementStatusElements const MoveUnsetCanTransitionBetweenSwimAndFly[] =
+constexpr MovementStatusElements MoveUnsetCanTransitionBetweenSwimAndFly[] =
 {
     MSEHasGuidByte3,
     MSEHasGuidByte4,
@@ -5603,230 +5606,599 @@ void Movement::PacketSender::Send() const
     }
 }
 
-MovementStatusElements const* GetMovementStatusElementsSequence(uint32 opcode)
+template<MovementStatusElements Element>
+inline void Movement::MovementStatusReader::Read()
+{
+    if constexpr (Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7)
+        Guid[Element - MSEHasGuidByte0] = Data.ReadBit();
+    else if constexpr (Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7)
+    {
+        if (HasTransportData)
+            TransportGuid[Element - MSEHasTransportGuidByte0] = Data.ReadBit();
+    }
+    else if constexpr (Element >= MSEGuidByte0 && Element <= MSEGuidByte7)
+        Data.ReadByteSeq(Guid[Element - MSEGuidByte0]);
+    else if constexpr (Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7)
+    {
+        if (HasTransportData)
+            Data.ReadByteSeq(TransportGuid[Element - MSETransportGuidByte0]);
+    }
+    else if constexpr (Element == MSEHasMovementFlags)
+        HasMovementFlags = !Data.ReadBit();
+    else if constexpr (Element == MSEHasMovementFlags2)
+        HasMovementFlags2 = !Data.ReadBit();
+    else if constexpr (Element == MSEHasTimestamp)
+        HasTimestamp = !Data.ReadBit();
+    else if constexpr (Element == MSEHasOrientation)
+        HasOrientation = !Data.ReadBit();
+    else if constexpr (Element == MSEHasTransportData)
+        HasTransportData = Data.ReadBit();
+    else if constexpr (Element == MSEHasTransportTime2)
+    {
+        if (HasTransportData)
+            HasTransportTime2 = Data.ReadBit();
+    }
+    else if constexpr (Element == MSEHasVehicleId)
+    {
+        if (HasTransportData)
+            HasTransportVehicleId = Data.ReadBit();
+    }
+    else if constexpr (Element == MSEHasPitch)
+        HasPitch = !Data.ReadBit();
+    else if constexpr (Element == MSEHasFallData)
+        HasFallData = Data.ReadBit();
+    else if constexpr (Element == MSEHasFallDirection)
+    {
+        if (HasFallData)
+            HasFallDirection = Data.ReadBit();
+    }
+    else if constexpr (Element == MSEHasSplineElevation)
+        HasSplineElevation = !Data.ReadBit();
+    else if constexpr (Element == MSEHasSpline || Element == MSEHasHeightChangeFailed || Element == MSEZeroBit || Element == MSEOneBit)
+        Data.ReadBit();
+    else if constexpr (Element == MSEMovementFlags)
+    {
+        if (HasMovementFlags)
+            Info.flags = Data.ReadBits(30);
+    }
+    else if constexpr (Element == MSEMovementFlags2)
+    {
+        if (HasMovementFlags2)
+            Info.flags2 = Data.ReadBits(12);
+    }
+    else if constexpr (Element == MSETimestamp)
+    {
+        if (HasTimestamp)
+            Data >> Info.time;
+    }
+    else if constexpr (Element == MSEPositionX)
+        Data >> Info.pos.m_positionX;
+    else if constexpr (Element == MSEPositionY)
+        Data >> Info.pos.m_positionY;
+    else if constexpr (Element == MSEPositionZ)
+        Data >> Info.pos.m_positionZ;
+    else if constexpr (Element == MSEOrientation)
+    {
+        if (HasOrientation)
+            Info.pos.SetOrientation(Data.read<float>());
+    }
+    else if constexpr (Element == MSETransportPositionX)
+    {
+        if (HasTransportData)
+            Data >> Info.transport.pos.m_positionX;
+    }
+    else if constexpr (Element == MSETransportPositionY)
+    {
+        if (HasTransportData)
+            Data >> Info.transport.pos.m_positionY;
+    }
+    else if constexpr (Element == MSETransportPositionZ)
+    {
+        if (HasTransportData)
+            Data >> Info.transport.pos.m_positionZ;
+    }
+    else if constexpr (Element == MSETransportOrientation)
+    {
+        if (HasTransportData)
+            Info.transport.pos.SetOrientation(Data.read<float>());
+    }
+    else if constexpr (Element == MSETransportSeat)
+    {
+        if (HasTransportData)
+            Data >> Info.transport.seat;
+    }
+    else if constexpr (Element == MSETransportTime)
+    {
+        if (HasTransportData)
+            Data >> Info.transport.time;
+    }
+    else if constexpr (Element == MSETransportTime2)
+    {
+        if (HasTransportData && HasTransportTime2)
+            Data >> Info.transport.time2;
+    }
+    else if constexpr (Element == MSETransportVehicleId)
+    {
+        if (HasTransportData && HasTransportVehicleId)
+            Data >> Info.transport.vehicleId;
+    }
+    else if constexpr (Element == MSEPitch)
+    {
+        if (HasPitch)
+            Info.pitch = G3D::wrap(Data.read<float>(), float(-M_PI), float(M_PI));
+    }
+    else if constexpr (Element == MSEFallTime)
+    {
+        if (HasFallData)
+            Data >> Info.jump.fallTime;
+    }
+    else if constexpr (Element == MSEFallVerticalSpeed)
+    {
+        if (HasFallData)
+            Data >> Info.jump.zspeed;
+    }
+    else if constexpr (Element == MSEFallCosAngle)
+    {
+        if (HasFallData && HasFallDirection)
+            Data >> Info.jump.cosAngle;
+    }
+    else if constexpr (Element == MSEFallSinAngle)
+    {
+        if (HasFallData && HasFallDirection)
+            Data >> Info.jump.sinAngle;
+    }
+    else if constexpr (Element == MSEFallHorizontalSpeed)
+    {
+        if (HasFallData && HasFallDirection)
+            Data >> Info.jump.xyspeed;
+    }
+    else if constexpr (Element == MSESplineElevation)
+    {
+        if (HasSplineElevation)
+            Data >> Info.splineElevation;
+    }
+    else if constexpr (Element == MSECounter)
+        Data >> Info.movementCounter;
+    else if constexpr (Element == MSEExtraElement)
+        Extras->ReadNextElement(Data);
+    else
+        ASSERT(PrintInvalidSequenceElement(Element, __FUNCTION__));
+}
+
+template<MovementStatusElements Element>
+inline void Movement::MovementStatusWriter::Write()
+{
+    if constexpr (Element >= MSEHasGuidByte0 && Element <= MSEHasGuidByte7)
+        Data.WriteBit(Guid[Element - MSEHasGuidByte0]);
+    else if constexpr (Element >= MSEHasTransportGuidByte0 && Element <= MSEHasTransportGuidByte7)
+    {
+        if (HasTransportData)
+            Data.WriteBit(TransportGuid[Element - MSEHasTransportGuidByte0]);
+    }
+    else if constexpr (Element >= MSEGuidByte0 && Element <= MSEGuidByte7)
+        Data.WriteByteSeq(Guid[Element - MSEGuidByte0]);
+    else if constexpr (Element >= MSETransportGuidByte0 && Element <= MSETransportGuidByte7)
+    {
+        if (HasTransportData)
+            Data.WriteByteSeq(TransportGuid[Element - MSETransportGuidByte0]);
+    }
+    else if constexpr (Element == MSEHasMovementFlags)
+        Data.WriteBit(!HasMovementFlags);
+    else if constexpr (Element == MSEHasMovementFlags2)
+        Data.WriteBit(!HasMovementFlags2);
+    else if constexpr (Element == MSEHasTimestamp)
+        Data.WriteBit(!HasTimestamp);
+    else if constexpr (Element == MSEHasOrientation)
+        Data.WriteBit(!HasOrientation);
+    else if constexpr (Element == MSEHasTransportData)
+        Data.WriteBit(HasTransportData);
+    else if constexpr (Element == MSEHasTransportTime2)
+    {
+        if (HasTransportData)
+            Data.WriteBit(HasTransportTime2);
+    }
+    else if constexpr (Element == MSEHasVehicleId)
+    {
+        if (HasTransportData)
+            Data.WriteBit(HasTransportVehicleId);
+    }
+    else if constexpr (Element == MSEHasPitch)
+        Data.WriteBit(!HasPitch);
+    else if constexpr (Element == MSEHasFallData)
+        Data.WriteBit(HasFallData);
+    else if constexpr (Element == MSEHasFallDirection)
+    {
+        if (HasFallData)
+            Data.WriteBit(HasFallDirection);
+    }
+    else if constexpr (Element == MSEHasSplineElevation)
+        Data.WriteBit(!HasSplineElevation);
+    else if constexpr (Element == MSEHasSpline)
+        Data.WriteBit(HasSpline);
+    else if constexpr (Element == MSEHasHeightChangeFailed)
+        Data.WriteBit(Info.HasHeightChangeFailed());
+    else if constexpr (Element == MSEMovementFlags)
+    {
+        if (HasMovementFlags)
+            Data.WriteBits(Info.GetMovementFlags(), 30);
+    }
+    else if constexpr (Element == MSEMovementFlags2)
+    {
+        if (HasMovementFlags2)
+            Data.WriteBits(Info.GetExtraMovementFlags(), 12);
+    }
+    else if constexpr (Element == MSETimestamp)
+    {
+        if (HasTimestamp)
+            Data << Info.time;
+    }
+    else if constexpr (Element == MSEPositionX)
+        Data << Pos.GetPositionX();
+    else if constexpr (Element == MSEPositionY)
+        Data << Pos.GetPositionY();
+    else if constexpr (Element == MSEPositionZ)
+        Data << Pos.GetPositionZ();
+    else if constexpr (Element == MSEOrientation)
+    {
+        if (HasOrientation)
+            Data << Pos.GetOrientation();
+    }
+    else if constexpr (Element == MSETransportPositionX)
+    {
+        if (HasTransportData)
+            Data << Info.transport.pos.GetPositionX();
+    }
+    else if constexpr (Element == MSETransportPositionY)
+    {
+        if (HasTransportData)
+            Data << Info.transport.pos.GetPositionY();
+    }
+    else if constexpr (Element == MSETransportPositionZ)
+    {
+        if (HasTransportData)
+            Data << Info.transport.pos.GetPositionZ();
+    }
+    else if constexpr (Element == MSETransportOrientation)
+    {
+        if (HasTransportData)
+            Data << Info.transport.pos.GetOrientation();
+    }
+    else if constexpr (Element == MSETransportSeat)
+    {
+        if (HasTransportData)
+            Data << Info.transport.seat;
+    }
+    else if constexpr (Element == MSETransportTime)
+    {
+        if (HasTransportData)
+            Data << Info.transport.time;
+    }
+    else if constexpr (Element == MSETransportTime2)
+    {
+        if (HasTransportData && HasTransportTime2)
+            Data << Info.transport.time2;
+    }
+    else if constexpr (Element == MSETransportVehicleId)
+    {
+        if (HasTransportData && HasTransportVehicleId)
+            Data << Info.transport.vehicleId;
+    }
+    else if constexpr (Element == MSEPitch)
+    {
+        if (HasPitch)
+            Data << Info.pitch;
+    }
+    else if constexpr (Element == MSEFallTime)
+    {
+        if (HasFallData)
+            Data << Info.jump.fallTime;
+    }
+    else if constexpr (Element == MSEFallVerticalSpeed)
+    {
+        if (HasFallData)
+            Data << Info.jump.zspeed;
+    }
+    else if constexpr (Element == MSEFallCosAngle)
+    {
+        if (HasFallData && HasFallDirection)
+            Data << Info.jump.cosAngle;
+    }
+    else if constexpr (Element == MSEFallSinAngle)
+    {
+        if (HasFallData && HasFallDirection)
+            Data << Info.jump.sinAngle;
+    }
+    else if constexpr (Element == MSEFallHorizontalSpeed)
+    {
+        if (HasFallData && HasFallDirection)
+            Data << Info.jump.xyspeed;
+    }
+    else if constexpr (Element == MSESplineElevation)
+    {
+        if (HasSplineElevation)
+            Data << Info.splineElevation;
+    }
+    else if constexpr (Element == MSECounter)
+        Data << uint32(MovementCounter);
+    else if constexpr (Element == MSEZeroBit)
+        Data.WriteBit(0);
+    else if constexpr (Element == MSEOneBit)
+        Data.WriteBit(1);
+    else if constexpr (Element == MSEFlushBits)
+        Data.FlushBits();
+    else if constexpr (Element == MSEExtraElement)
+        Extras->WriteNextElement(Data);
+    else
+        ASSERT(PrintInvalidSequenceElement(Element, __FUNCTION__));
+}
+
+namespace
+{
+    // Number of elements before the MSEEnd terminator, all sequences are known at compile time
+    template<auto const& Elements>
+    constexpr std::size_t MovementStatusSequenceLength()
+    {
+        std::size_t length = 0;
+        while (Elements[length] != MSEEnd)
+            ++length;
+
+        return length;
+    }
+
+    // Unrolls the sequence into one Read<Element>/Write<Element> call per element,
+    // so no per element dispatch is left when a packet is handled
+    template<auto const& Elements, std::size_t... Indexes>
+    void ReadMovementStatus(Movement::MovementStatusReader& reader, std::index_sequence<Indexes...>)
+    {
+        (reader.Read<Elements[Indexes]>(), ...);
+    }
+
+    template<auto const& Elements, std::size_t... Indexes>
+    void WriteMovementStatus(Movement::MovementStatusWriter& writer, std::index_sequence<Indexes...>)
+    {
+        (writer.Write<Elements[Indexes]>(), ...);
+    }
+
+    template<auto const& Elements>
+    void ReadMovementStatus(Movement::MovementStatusReader& reader)
+    {
+        ReadMovementStatus<Elements>(reader, std::make_index_sequence<MovementStatusSequenceLength<Elements>()>());
+    }
+
+    template<auto const& Elements>
+    void WriteMovementStatus(Movement::MovementStatusWriter& writer)
+    {
+        WriteMovementStatus<Elements>(writer, std::make_index_sequence<MovementStatusSequenceLength<Elements>()>());
+    }
+
+    template<auto const& Elements>
+    constexpr Movement::MovementStatusSequence MovementStatusSequenceOf = { Elements, &ReadMovementStatus<Elements>, &WriteMovementStatus<Elements> };
+}
+
+Movement::MovementStatusSequence const* GetMovementStatusSequence(uint32 opcode)
 {
     switch (opcode)
     {
         case MSG_MOVE_FALL_LAND:
-            return MovementFallLand;
+            return &MovementStatusSequenceOf<MovementFallLand>;
         case MSG_MOVE_HEARTBEAT:
-            return MovementHeartBeat;
+            return &MovementStatusSequenceOf<MovementHeartBeat>;
         case MSG_MOVE_JUMP:
-            return MovementJump;
+            return &MovementStatusSequenceOf<MovementJump>;
         case MSG_MOVE_SET_FACING:
-            return MovementSetFacing;
+            return &MovementStatusSequenceOf<MovementSetFacing>;
         case MSG_MOVE_SET_PITCH:
-            return MovementSetPitch;
+            return &MovementStatusSequenceOf<MovementSetPitch>;
         case MSG_MOVE_START_ASCEND:
-            return MovementStartAscend;
+            return &MovementStatusSequenceOf<MovementStartAscend>;
         case MSG_MOVE_START_BACKWARD:
-            return MovementStartBackward;
+            return &MovementStatusSequenceOf<MovementStartBackward>;
         case MSG_MOVE_START_DESCEND:
-            return MovementStartDescend;
+            return &MovementStatusSequenceOf<MovementStartDescend>;
         case MSG_MOVE_START_FORWARD:
-            return MovementStartForward;
+            return &MovementStatusSequenceOf<MovementStartForward>;
         case MSG_MOVE_START_PITCH_DOWN:
-            return MovementStartPitchDown;
+            return &MovementStatusSequenceOf<MovementStartPitchDown>;
         case MSG_MOVE_START_PITCH_UP:
-            return MovementStartPitchUp;
+            return &MovementStatusSequenceOf<MovementStartPitchUp>;
         case MSG_MOVE_START_STRAFE_LEFT:
-            return MovementStartStrafeLeft;
+            return &MovementStatusSequenceOf<MovementStartStrafeLeft>;
         case MSG_MOVE_START_STRAFE_RIGHT:
-            return MovementStartStrafeRight;
+            return &MovementStatusSequenceOf<MovementStartStrafeRight>;
         case MSG_MOVE_START_SWIM:
-            return MovementStartSwim;
+            return &MovementStatusSequenceOf<MovementStartSwim>;
         case MSG_MOVE_START_TURN_LEFT:
-            return MovementStartTurnLeft;
+            return &MovementStatusSequenceOf<MovementStartTurnLeft>;
         case MSG_MOVE_START_TURN_RIGHT:
-            return MovementStartTurnRight;
+            return &MovementStatusSequenceOf<MovementStartTurnRight>;
         case MSG_MOVE_STOP:
-            return MovementStop;
+            return &MovementStatusSequenceOf<MovementStop>;
         case MSG_MOVE_STOP_ASCEND:
-            return MovementStopAscend;
+            return &MovementStatusSequenceOf<MovementStopAscend>;
         case MSG_MOVE_STOP_PITCH:
-            return MovementStopPitch;
+            return &MovementStatusSequenceOf<MovementStopPitch>;
         case MSG_MOVE_STOP_STRAFE:
-            return MovementStopStrafe;
+            return &MovementStatusSequenceOf<MovementStopStrafe>;
         case MSG_MOVE_STOP_SWIM:
-            return MovementStopSwim;
+            return &MovementStatusSequenceOf<MovementStopSwim>;
         case MSG_MOVE_STOP_TURN:
-            return MovementStopTurn;
+            return &MovementStatusSequenceOf<MovementStopTurn>;
         case CMSG_MOVE_CHNG_TRANSPORT:
-            return MoveChngTransport;
+            return &MovementStatusSequenceOf<MoveChngTransport>;
         case CMSG_MOVE_SPLINE_DONE:
-            return MoveSplineDone;
+            return &MovementStatusSequenceOf<MoveSplineDone>;
         case CMSG_MOVE_NOT_ACTIVE_MOVER:
-            return MoveNotActiveMover;
+            return &MovementStatusSequenceOf<MoveNotActiveMover>;
         case CMSG_DISMISS_CONTROLLED_VEHICLE:
-            return DismissControlledVehicle;
+            return &MovementStatusSequenceOf<DismissControlledVehicle>;
         case CMSG_FORCE_MOVE_ROOT_ACK:
-            return ForceMoveRootAck;
+            return &MovementStatusSequenceOf<ForceMoveRootAck>;
         case CMSG_FORCE_MOVE_UNROOT_ACK:
-            return ForceMoveUnrootAck;
+            return &MovementStatusSequenceOf<ForceMoveUnrootAck>;
         case CMSG_MOVE_FALL_RESET:
-            return MovementFallReset;
+            return &MovementStatusSequenceOf<MovementFallReset>;
         case CMSG_MOVE_FEATHER_FALL_ACK:
-            return MovementFeatherFallAck;
+            return &MovementStatusSequenceOf<MovementFeatherFallAck>;
         case CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK:
-            return MovementForceFlightSpeedChangeAck;
+            return &MovementStatusSequenceOf<MovementForceFlightSpeedChangeAck>;
         case CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK:
-            return MovementForceRunBackSpeedChangeAck;
+            return &MovementStatusSequenceOf<MovementForceRunBackSpeedChangeAck>;
         case CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK:
-            return MovementForceRunSpeedChangeAck;
+            return &MovementStatusSequenceOf<MovementForceRunSpeedChangeAck>;
         case CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK:
-            return MovementForceSwimSpeedChangeAck;
+            return &MovementStatusSequenceOf<MovementForceSwimSpeedChangeAck>;
         case CMSG_MOVE_FORCE_SWIM_BACK_SPEED_CHANGE_ACK:
-            return MoveForceSwimBackSpeedChangeAck;
+            return &MovementStatusSequenceOf<MoveForceSwimBackSpeedChangeAck>;
         case CMSG_MOVE_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK:
-            return MoveForceFlightBackSpeedChangeAck;
+            return &MovementStatusSequenceOf<MoveForceFlightBackSpeedChangeAck>;
         case CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK:
-            return MovementForceWalkSpeedChangeAck;
+            return &MovementStatusSequenceOf<MovementForceWalkSpeedChangeAck>;
         case CMSG_MOVE_GRAVITY_DISABLE_ACK:
-            return MovementGravityDisableAck;
+            return &MovementStatusSequenceOf<MovementGravityDisableAck>;
         case CMSG_MOVE_GRAVITY_ENABLE_ACK:
-            return MovementGravityEnableAck;
+            return &MovementStatusSequenceOf<MovementGravityEnableAck>;
         case CMSG_MOVE_HOVER_ACK:
-            return MovementHoverAck;
+            return &MovementStatusSequenceOf<MovementHoverAck>;
         case CMSG_MOVE_KNOCK_BACK_ACK:
-            return MovementKnockBackAck;
+            return &MovementStatusSequenceOf<MovementKnockBackAck>;
         case CMSG_MOVE_SET_CAN_FLY:
-            return MovementSetCanFly;
+            return &MovementStatusSequenceOf<MovementSetCanFly>;
         case CMSG_MOVE_SET_CAN_FLY_ACK:
-            return MovementSetCanFlyAck;
+            return &MovementStatusSequenceOf<MovementSetCanFlyAck>;
         case CMSG_MOVE_SET_CAN_TRANSITION_BETWEEN_SWIM_AND_FLY_ACK:
-            return MovementSetCanTransitionBetweenSwimAndFlyAck;
+            return &MovementStatusSequenceOf<MovementSetCanTransitionBetweenSwimAndFlyAck>;
         case CMSG_MOVE_SET_COLLISION_HEIGHT_ACK:
-            return MovementSetCollisionHeightAck;
+            return &MovementStatusSequenceOf<MovementSetCollisionHeightAck>;
         case SMSG_MOVE_SET_COLLISION_HEIGHT:
-            return MovementSetCollisionHeight;
+            return &MovementStatusSequenceOf<MovementSetCollisionHeight>;
         case SMSG_MOVE_UPDATE_COLLISION_HEIGHT:
-            return MovementUpdateCollisionHeight;
+            return &MovementStatusSequenceOf<MovementUpdateCollisionHeight>;
         case CMSG_MOVE_WATER_WALK_ACK:
-            return MovementWaterWalkAck;
+            return &MovementStatusSequenceOf<MovementWaterWalkAck>;
         case MSG_MOVE_SET_RUN_MODE:
-            return MovementSetRunMode;
+            return &MovementStatusSequenceOf<MovementSetRunMode>;
         case MSG_MOVE_SET_WALK_MODE:
-            return MovementSetWalkMode;
+            return &MovementStatusSequenceOf<MovementSetWalkMode>;
         case SMSG_MOVE_UPDATE:
-            return MovementUpdate;
+            return &MovementStatusSequenceOf<MovementUpdate>;
         case SMSG_MOVE_UPDATE_FLIGHT_SPEED:
-            return MovementUpdateFlightSpeed;
+            return &MovementStatusSequenceOf<MovementUpdateFlightSpeed>;
         case SMSG_MOVE_UPDATE_RUN_SPEED:
-            return MovementUpdateRunSpeed;
+            return &MovementStatusSequenceOf<MovementUpdateRunSpeed>;
         case SMSG_MOVE_UPDATE_KNOCK_BACK:
-            return MovementUpdateKnockBack;
+            return &MovementStatusSequenceOf<MovementUpdateKnockBack>;
         case SMSG_MOVE_UPDATE_RUN_BACK_SPEED:
-            return MovementUpdateRunBackSpeed;
+            return &MovementStatusSequenceOf<MovementUpdateRunBackSpeed>;
         case SMSG_MOVE_UPDATE_SWIM_SPEED:
-            return MovementUpdateSwimSpeed;
+            return &MovementStatusSequenceOf<MovementUpdateSwimSpeed>;
         case SMSG_MOVE_UPDATE_SWIM_BACK_SPEED:
-            return MoveUpdateSwimBackSpeed;
+            return &MovementStatusSequenceOf<MoveUpdateSwimBackSpeed>;
         case SMSG_MOVE_UPDATE_WALK_SPEED:
-            return MovementUpdateWalkSpeed;
+            return &MovementStatusSequenceOf<MovementUpdateWalkSpeed>;
         case SMSG_SPLINE_MOVE_SET_WALK_SPEED:
-            return SplineMoveSetWalkSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetWalkSpeed>;
         case SMSG_SPLINE_MOVE_SET_RUN_SPEED:
-            return SplineMoveSetRunSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetRunSpeed>;
         case SMSG_SPLINE_MOVE_SET_RUN_BACK_SPEED:
-            return SplineMoveSetRunBackSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetRunBackSpeed>;
         case SMSG_SPLINE_MOVE_SET_SWIM_SPEED:
-            return SplineMoveSetSwimSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetSwimSpeed>;
         case SMSG_SPLINE_MOVE_SET_SWIM_BACK_SPEED:
-            return SplineMoveSetSwimBackSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetSwimBackSpeed>;
         case SMSG_SPLINE_MOVE_SET_TURN_RATE:
-            return SplineMoveSetTurnRate;
+            return &MovementStatusSequenceOf<SplineMoveSetTurnRate>;
         case SMSG_SPLINE_MOVE_SET_FLIGHT_SPEED:
-            return SplineMoveSetFlightSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetFlightSpeed>;
         case SMSG_SPLINE_MOVE_SET_FLIGHT_BACK_SPEED:
-            return SplineMoveSetFlightBackSpeed;
+            return &MovementStatusSequenceOf<SplineMoveSetFlightBackSpeed>;
         case SMSG_SPLINE_MOVE_SET_PITCH_RATE:
-            return SplineMoveSetPitchRate;
+            return &MovementStatusSequenceOf<SplineMoveSetPitchRate>;
         case SMSG_MOVE_SET_WALK_SPEED:
-            return MoveSetWalkSpeed;
+            return &MovementStatusSequenceOf<MoveSetWalkSpeed>;
         case SMSG_MOVE_SET_RUN_SPEED:
-            return MoveSetRunSpeed;
+            return &MovementStatusSequenceOf<MoveSetRunSpeed>;
         case SMSG_MOVE_SET_RUN_BACK_SPEED:
-            return MoveSetRunBackSpeed;
+            return &MovementStatusSequenceOf<MoveSetRunBackSpeed>;
         case SMSG_MOVE_SET_SWIM_SPEED:
-            return MoveSetSwimSpeed;
+            return &MovementStatusSequenceOf<MoveSetSwimSpeed>;
         case SMSG_MOVE_SET_SWIM_BACK_SPEED:
-            return MoveSetSwimBackSpeed;
+            return &MovementStatusSequenceOf<MoveSetSwimBackSpeed>;
         case SMSG_MOVE_SET_TURN_RATE:
-            return MoveSetTurnRate;
+            return &MovementStatusSequenceOf<MoveSetTurnRate>;
         case SMSG_MOVE_SET_FLIGHT_SPEED:
-            return MoveSetFlightSpeed;
+            return &MovementStatusSequenceOf<MoveSetFlightSpeed>;
         case SMSG_MOVE_SET_FLIGHT_BACK_SPEED:
-            return MoveSetFlightBackSpeed;
+            return &MovementStatusSequenceOf<MoveSetFlightBackSpeed>;
         case SMSG_MOVE_SET_PITCH_RATE:
-            return MoveSetPitchRate;
+            return &MovementStatusSequenceOf<MoveSetPitchRate>;
         case SMSG_SPLINE_MOVE_SET_WALK_MODE:
-            return SplineMoveSetWalkMode;
+            return &MovementStatusSequenceOf<SplineMoveSetWalkMode>;
         case SMSG_SPLINE_MOVE_SET_RUN_MODE:
-            return SplineMoveSetRunMode;
+            return &MovementStatusSequenceOf<SplineMoveSetRunMode>;
         case SMSG_SPLINE_MOVE_GRAVITY_DISABLE:
-            return SplineMoveGravityDisable;
+            return &MovementStatusSequenceOf<SplineMoveGravityDisable>;
         case SMSG_SPLINE_MOVE_GRAVITY_ENABLE:
-            return SplineMoveGravityEnable;
+            return &MovementStatusSequenceOf<SplineMoveGravityEnable>;
         case SMSG_SPLINE_MOVE_SET_HOVER:
-            return SplineMoveSetHover;
+            return &MovementStatusSequenceOf<SplineMoveSetHover>;
         case SMSG_SPLINE_MOVE_UNSET_HOVER:
-            return SplineMoveUnsetHover;
+            return &MovementStatusSequenceOf<SplineMoveUnsetHover>;
         case SMSG_SPLINE_MOVE_START_SWIM:
-            return SplineMoveStartSwim;
+            return &MovementStatusSequenceOf<SplineMoveStartSwim>;
         case SMSG_SPLINE_MOVE_STOP_SWIM:
-            return SplineMoveStopSwim;
+            return &MovementStatusSequenceOf<SplineMoveStopSwim>;
         case SMSG_SPLINE_MOVE_SET_FLYING:
-            return SplineMoveSetFlying;
+            return &MovementStatusSequenceOf<SplineMoveSetFlying>;
         case SMSG_SPLINE_MOVE_UNSET_FLYING:
-            return SplineMoveUnsetFlying;
+            return &MovementStatusSequenceOf<SplineMoveUnsetFlying>;
         case SMSG_SPLINE_MOVE_SET_WATER_WALK:
-            return SplineMoveSetWaterWalk;
+            return &MovementStatusSequenceOf<SplineMoveSetWaterWalk>;
         case SMSG_SPLINE_MOVE_SET_LAND_WALK:
-            return SplineMoveSetLandWalk;
+            return &MovementStatusSequenceOf<SplineMoveSetLandWalk>;
         case SMSG_SPLINE_MOVE_SET_FEATHER_FALL:
-            return SplineMoveSetFeatherFall;
+            return &MovementStatusSequenceOf<SplineMoveSetFeatherFall>;
         case SMSG_SPLINE_MOVE_SET_NORMAL_FALL:
-            return SplineMoveSetNormalFall;
+            return &MovementStatusSequenceOf<SplineMoveSetNormalFall>;
         case SMSG_SPLINE_MOVE_ROOT:
-            return SplineMoveRoot;
+            return &MovementStatusSequenceOf<SplineMoveRoot>;
         case SMSG_SPLINE_MOVE_UNROOT:
-            return SplineMoveUnroot;
+            return &MovementStatusSequenceOf<SplineMoveUnroot>;
         case SMSG_MOVE_SET_CAN_FLY:
-            return MoveSetCanFly;
+            return &MovementStatusSequenceOf<MoveSetCanFly>;
         case SMSG_MOVE_UNSET_CAN_FLY:
-            return MoveUnsetCanFly;
+            return &MovementStatusSequenceOf<MoveUnsetCanFly>;
         case SMSG_MOVE_SET_HOVER:
-            return MoveSetHover;
+            return &MovementStatusSequenceOf<MoveSetHover>;
         case SMSG_MOVE_UNSET_HOVER:
-            return MoveUnsetHover;
+            return &MovementStatusSequenceOf<MoveUnsetHover>;
         case SMSG_MOVE_WATER_WALK:
-            return MoveWaterWalk;
+            return &MovementStatusSequenceOf<MoveWaterWalk>;
         case SMSG_MOVE_LAND_WALK:
-            return MoveLandWalk;
+            return &MovementStatusSequenceOf<MoveLandWalk>;
         case SMSG_MOVE_FEATHER_FALL:
-            return MoveFeatherFall;
+            return &MovementStatusSequenceOf<MoveFeatherFall>;
         case SMSG_MOVE_NORMAL_FALL:
-            return MoveNormalFall;
+            return &MovementStatusSequenceOf<MoveNormalFall>;
         case SMSG_MOVE_ROOT:
-            return MoveRoot;
+            return &MovementStatusSequenceOf<MoveRoot>;
         case SMSG_MOVE_UNROOT:
-            return MoveUnroot;
+            return &MovementStatusSequenceOf<MoveUnroot>;
         case CMSG_CHANGE_SEATS_ON_CONTROLLED_VEHICLE:
-            return ChangeSeatsOnControlledVehicle;
+            return &MovementStatusSequenceOf<ChangeSeatsOnControlledVehicle>;
         case CMSG_CAST_SPELL:
         case CMSG_PET_CAST_SPELL:
         case CMSG_USE_ITEM:
-            return CastSpellEmbeddedMovement;
+            return &MovementStatusSequenceOf<CastSpellEmbeddedMovement>;
         case SMSG_MOVE_GRAVITY_DISABLE:
-            return MoveGravityDisable;
+            return &MovementStatusSequenceOf<MoveGravityDisable>;
         case SMSG_MOVE_GRAVITY_ENABLE:
-            return MoveGravityEnable;
+            return &MovementStatusSequenceOf<MoveGravityEnable>;
         case SMSG_MOVE_UPDATE_FLIGHT_BACK_SPEED:
-            return MoveUpdateFlightBackSpeed;
+            return &MovementStatusSequenceOf<MoveUpdateFlightBackSpeed>;
         case SMSG_MOVE_SET_CAN_TRANSITION_BETWEEN_SWIM_AND_FLY:
-            return MoveSetCanTransitionBetweenSwimAndFly;
+            return &MovementStatusSequenceOf<MoveSetCanTransitionBetweenSwimAndFly>;
         case SMSG_MOVE_UNSET_CAN_TRANSITION_BETWEEN_SWIM_AND_FLY:
-            return MoveUnsetCanTransitionBetweenSwimAndFly;
+            return &MovementStatusSequenceOf<MoveUnsetCanTransitionBetweenSwimAndFly>;
         default:
             break;
     }
@@ -113,7 +113,7 @@ namespace Movement
 {
     class PacketSender;
 
-    class ExtraMovementStatusElement
+    class TC_GAME_API ExtraMovementStatusElement
     {
         friend class PacketSender;
 
@@ -138,6 +138,75 @@ namespace Movement
         uint32 _index = 0;
     };
 
+    /// State of a movement status block being read from a client packet.
+    /// Elements are read by Read<Element>, instantiated for every element of a sequence at compile time.
+    struct MovementStatusReader
+    {
+        MovementStatusReader(ByteBuffer& data, MovementInfo& info, ExtraMovementStatusElement* extras) : Data(data), Info(info), Extras(extras) { }
+
+        template<MovementStatusElements Element>
+        void Read();
+
+        ByteBuffer& Data;
+        MovementInfo& Info;
+        ExtraMovementStatusElement* Extras;
+
+        ObjectGuid Guid;
+        ObjectGuid TransportGuid;
+
+        bool HasMovementFlags = false;
+        bool HasMovementFlags2 = false;
+        bool HasTimestamp = false;
+        bool HasOrientation = false;
+        bool HasTransportData = false;
+        bool HasTransportTime2 = false;
+        bool HasTransportVehicleId = false;
+        bool HasPitch = false;
+        bool HasFallData = false;
+        bool HasFallDirection = false;
+        bool HasSplineElevation = false;
+    };
+
+    /// Values a movement status block is written from, filled by Unit::WriteMovementInfo
+    struct MovementStatusWriter
+    {
+        MovementStatusWriter(ByteBuffer& data, MovementInfo const& info, Position const& position, ExtraMovementStatusElement* extras)
+            : Data(data), Info(info), Pos(position), Extras(extras) { }
+
+        template<MovementStatusElements Element>
+        void Write();
+
+        ByteBuffer& Data;
+        MovementInfo const& Info;
+        Position const& Pos;
+        ExtraMovementStatusElement* Extras;
+
+        ObjectGuid Guid;
+        ObjectGuid TransportGuid;
+        uint32 MovementCounter = 0;
+
+        bool HasMovementFlags = false;
+        bool HasMovementFlags2 = false;
+        bool HasTimestamp = false;
+        bool HasOrientation = false;
+        bool HasTransportData = false;
+        bool HasTransportTime2 = false;
+        bool HasTransportVehicleId = false;
+        bool HasPitch = false;
+        bool HasFallData = false;
+        bool HasFallDirection = false;
+        bool HasSplineElevation = false;
+        bool HasSpline = false;
+    };
+
+    /// Element sequence of an opcode together with the reader and writer generated for it
+    struct MovementStatusSequence
+    {
+        MovementStatusElements const* Elements;
+        void(*Read)(MovementStatusReader& reader);
+        void(*Write)(MovementStatusWriter& writer);
+    };
+
     class PacketSender
     {
     public:
@@ -152,9 +221,9 @@ namespace Movement
         uint16 _broadcast;
     };
 
-    bool PrintInvalidSequenceElement(MovementStatusElements element, char const* function);
+    TC_GAME_API bool PrintInvalidSequenceElement(MovementStatusElements element, char const* function);
 }
 
-MovementStatusElements const* GetMovementStatusElementsSequence(uint32 opcode);
+TC_GAME_API Movement::MovementStatusSequence const* GetMovementStatusSequence(uint32 opcode);
 
 #endif
@@ -0,0 +1,93 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "PathCache.h"
+#include "World.h"
+
+// entries above this count trigger removal of expired corridors
+static constexpr std::size_t PATH_CACHE_MAX_ENTRIES = 256;
+
+bool PathCache::Find(PathCacheKey const& key, G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, dtPolyRef* path, uint32& pathLength, uint32 maxPathLength)
+{
+    float tolerance = sWorld->getFloatConfig(CONFIG_MMAP_PATH_CACHE_TOLERANCE);
+    uint32 lifetime = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_LIFETIME);
+    uint32 now = getMSTime();
+
+    std::lock_guard<std::mutex> lock(_lock);
+    auto itr = _entries.find(key);
+    if (itr == _entries.end() || itr->second.IsExpired(now, lifetime) || itr->second.Path.size() > maxPathLength
+        || (itr->second.StartPosition - startPos).squaredLength() > tolerance * tolerance
+        || (itr->second.EndPosition - endPos).squaredLength() > tolerance * tolerance)
+    {
+        ++GetStatistics().CacheMisses;
+        return false;
+    }
+
+    pathLength = uint32(itr->second.Path.size());
+    std::copy(itr->second.Path.begin(), itr->second.Path.end(), path);
+    ++GetStatistics().CacheHits;
+    return true;
+}
+
+void PathCache::Store(PathCacheKey const& key, G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, dtPolyRef const* path, uint32 pathLength)
+{
+    uint32 lifetime = sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_LIFETIME);
+    uint32 now = getMSTime();
+
+    std::lock_guard<std::mutex> lock(_lock);
+    if (_entries.size() >= PATH_CACHE_MAX_ENTRIES)
+        RemoveExpired(now, lifetime);
+
+    Entry& entry = _entries[key];
+    entry.StartPosition = startPos;
+    entry.EndPosition = endPos;
+    entry.InsertTime = now;
+    entry.Path.assign(path, path + pathLength);
+}
+
+void PathCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _entries.clear();
+}
+
+void PathCache::RemoveExpired(uint32 now, uint32 lifetime)
+{
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        if (itr->second.IsExpired(now, lifetime))
+            itr = _entries.erase(itr);
+        else
+            ++itr;
+    }
+
+    // everything is still fresh, start over rather than growing without bounds
+    if (_entries.size() >= PATH_CACHE_MAX_ENTRIES)
+        _entries.clear();
+}
+
+bool PathCache::IsEnabled()
+{
+    return sWorld->getIntConfig(CONFIG_MMAP_PATH_CACHE_LIFETIME) != 0;
+}
+
+PathCache::Statistics& PathCache::GetStatistics()
+{
+    static Statistics statistics;
+    return statistics;
+}
@@ -0,0 +1,105 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _PATH_CACHE_H
+#define _PATH_CACHE_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include "Hash.h"
+#include "Timer.h"
+#include <G3D/Vector3.h>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+struct PathCacheKey
+{
+    uint32 MeshMapId;                                       // terrain swaps of a map search different nav meshes
+    dtPolyRef StartPoly;
+    dtPolyRef EndPoly;
+    uint16 IncludeFlags;
+    uint16 ExcludeFlags;
+
+    bool operator==(PathCacheKey const& right) const = default;
+};
+
+namespace std
+{
+    template<>
+    struct hash<PathCacheKey>
+    {
+        size_t operator()(PathCacheKey const& key) const
+        {
+            size_t hashVal = 0;
+            Trinity::hash_combine(hashVal, key.MeshMapId);
+            Trinity::hash_combine(hashVal, key.StartPoly);
+            Trinity::hash_combine(hashVal, key.EndPoly);
+            Trinity::hash_combine(hashVal, key.IncludeFlags);
+            Trinity::hash_combine(hashVal, key.ExcludeFlags);
+            return hashVal;
+        }
+    };
+}
+
+// Short-lived per map cache of poly corridors between two polygons
+// Units chasing the same target from the same area share the result of a single findPath call
+class TC_GAME_API PathCache
+{
+    public:
+        struct Statistics
+        {
+            std::atomic<uint64> CacheHits = 0;
+            std::atomic<uint64> CacheMisses = 0;
+            std::atomic<uint64> PathsCalculated = 0;
+            std::atomic<uint64> PathTimeMicroseconds = 0;
+        };
+
+        PathCache() = default;
+
+        PathCache(PathCache const& right) = delete;
+        PathCache& operator=(PathCache const& right) = delete;
+
+        // copies the cached corridor into path if start and end are within tolerance of the cached search
+        bool Find(PathCacheKey const& key, G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, dtPolyRef* path, uint32& pathLength, uint32 maxPathLength);
+        void Store(PathCacheKey const& key, G3D::Vector3 const& startPos, G3D::Vector3 const& endPos, dtPolyRef const* path, uint32 pathLength);
+        void Clear();
+
+        static bool IsEnabled();
+        static Statistics& GetStatistics();
+
+    private:
+        struct Entry
+        {
+            G3D::Vector3 StartPosition;
+            G3D::Vector3 EndPosition;
+            uint32 InsertTime = 0;
+            std::vector<dtPolyRef> Path;
+
+            // compares elapsed time so that entries stay valid across getMSTime() wrap around
+            bool IsExpired(uint32 now, uint32 lifetime) const { return getMSTimeDiff(InsertTime, now) > lifetime; }
+        };
+
+        void RemoveExpired(uint32 now, uint32 lifetime);
+
+        std::mutex _lock;
+        std::unordered_map<PathCacheKey, Entry> _entries;
+};
+
+#endif
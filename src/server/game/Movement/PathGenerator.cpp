@@ -17,6 +17,7 @@
  */
 
 #include "PathGenerator.h"
+#include "AsyncPathfinder.h"
 #include "Map.h"
 #include "Creature.h"
 #include "G3DPosition.hpp"
@@ -28,20 +29,23 @@
 #include "DetourCommon.h"
 #include "DetourNavMeshQuery.h"
 #include "Metric.h"
+#include "PathCache.h"
 #include "PhasingHandler.h"
+#include <chrono>
 
 ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false),
-    _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
+    _forceDestination(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false), _useAsync(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _meshMapId(0)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
     TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::PathGenerator for %u", _source->GetGUID().GetCounter());
 
     uint32 mapId = PhasingHandler::GetTerrainMapId(_source->GetPhaseShift(), _source->GetMapId(), _source->GetMap()->GetTerrain(), _source->GetPositionX(), _source->GetPositionY());
+    _meshMapId = mapId;
     if (DisableMgr::IsPathfindingEnabled(mapId))
     {
         MMAP::MMapManager* mmap = MMAP::MMapFactory::createOrGetMMapManager();
@@ -55,6 +59,30 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
 PathGenerator::~PathGenerator()
 {
     TC_LOG_DEBUG("maps.mmaps", "++ PathGenerator::~PathGenerator() for %u", _source->GetGUID().GetCounter());
+
+    CancelPathRequest();
+}
+
+void PathGenerator::CancelPathRequest()
+{
+    if (!_pathRequest)
+        return;
+
+    _pathRequest->Cancel();
+    _pathRequest.reset();
+}
+
+bool PathGenerator::QueuePathRequest(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint)
+{
+    // previous search has not finished yet, keep waiting for it
+    if (_pathRequest)
+        return true;
+
+    if (!_useAsync || !sAsyncPathfinder->IsActive())
+        return false;
+
+    _pathRequest = sAsyncPathfinder->Queue(_source->GetMap(), _meshMapId, startPoly, endPoly, startPoint, endPoint, _filter);
+    return _pathRequest != nullptr;
 }
 
 bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool forceDest /*= false*/)
@@ -99,7 +127,17 @@ bool PathGenerator::CalculatePath(G3D::Vector3 const& startPoint, G3D::Vector3 c
 
     UpdateFilter();
 
+    std::chrono::steady_clock::time_point buildStart = std::chrono::steady_clock::now();
+
     BuildPolyPath(startPoint, endPoint);
+
+    // queued searches are counted by the later call that picks up their result
+    if (_type == PATHFIND_PENDING)
+        return true;
+
+    PathCache::Statistics& statistics = PathCache::GetStatistics();
+    ++statistics.PathsCalculated;
+    statistics.PathTimeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - buildStart).count();
     return true;
 }
 
@@ -305,6 +343,25 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         return;
     }
 
+    // take over the corridor of a finished background search, it is cut or extended below like any previous path
+    bool pathRequestFailed = false;
+    if (_pathRequest && _pathRequest->IsCompleted())
+    {
+        _polyLength = _pathRequest->PathLength;
+        memcpy(_pathPolyRefs, _pathRequest->Path, _polyLength * sizeof(dtPolyRef));
+        pathRequestFailed = !_polyLength;
+
+        if (PathCache::IsEnabled() && _polyLength && _pathPolyRefs[_polyLength - 1] == _pathRequest->EndPoly)
+        {
+            G3D::Vector3 requestStart(_pathRequest->StartPoint[2], _pathRequest->StartPoint[0], _pathRequest->StartPoint[1]);
+            G3D::Vector3 requestEnd(_pathRequest->EndPoint[2], _pathRequest->EndPoint[0], _pathRequest->EndPoint[1]);
+            _source->GetMap()->GetPathCache().Store({ _pathRequest->MeshMapId, _pathRequest->StartPoly, _pathRequest->EndPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() },
+                requestStart, requestEnd, _pathPolyRefs, _polyLength);
+        }
+
+        _pathRequest.reset();
+    }
+
     // look for startPoly/endPoly in current path
     /// @todo we can merge it with getPathPolyByPosition() loop
     bool startPolyFound = false;
@@ -436,8 +493,23 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         // or something went really wrong -> we aren't moving along the path to the target
         // just generate new path
 
+        // units pathing between the same polygons within a short time share the corridor
+        PathCache* pathCache = (!_useRaycast && PathCache::IsEnabled()) ? &_source->GetMap()->GetPathCache() : nullptr;
+        PathCacheKey cacheKey{ _meshMapId, startPoly, endPoly, _filter.getIncludeFlags(), _filter.getExcludeFlags() };
+        uint32 cachedPathLength = 0;
+        bool cached = pathCache && pathCache->Find(cacheKey, startPos, endPos, _pathPolyRefs, cachedPathLength, MAX_PATH_LENGTH);
+
+        // search in the background and keep the current path until a later call picks up the result
+        // a failed background search is repeated here so the caller gets a proper result
+        if (!cached && !_useRaycast && !pathRequestFailed && QueuePathRequest(startPoly, endPoly, startPoint, endPoint))
+        {
+            _type = PATHFIND_PENDING;
+            return;
+        }
+
         // free and invalidate old path data
         Clear();
+        _polyLength = cachedPathLength;
 
         dtStatus dtResult;
         if (_useRaycast)
@@ -511,15 +583,24 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
         }
         else
         {
-            dtResult = _navMeshQuery->findPath(
-                            startPoly,          // start polygon
-                            endPoly,            // end polygon
-                            startPoint,         // start position
-                            endPoint,           // end position
-                            &_filter,           // polygon search filter
-                            _pathPolyRefs,     // [out] path
-                            (int*)&_polyLength,
-                            MAX_PATH_LENGTH);   // max number of polygons in output path
+            if (cached)
+                dtResult = DT_SUCCESS;
+            else
+            {
+                dtResult = _navMeshQuery->findPath(
+                                startPoly,          // start polygon
+                                endPoly,            // end polygon
+                                startPoint,         // start position
+                                endPoint,           // end position
+                                &_filter,           // polygon search filter
+                                _pathPolyRefs,     // [out] path
+                                (int*)&_polyLength,
+                                MAX_PATH_LENGTH);   // max number of polygons in output path
+
+                // only complete corridors are worth sharing
+                if (pathCache && _polyLength && dtStatusSucceed(dtResult) && _pathPolyRefs[_polyLength - 1] == endPoly)
+                    pathCache->Store(cacheKey, startPos, endPos, _pathPolyRefs, _polyLength);
+            }
         }
 
         if (!_polyLength || dtStatusFailed(dtResult))
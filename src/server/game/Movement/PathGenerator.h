@@ -23,10 +23,12 @@
 #include "MMapDefines.h"
 #include "MoveSplineInitArgs.h"
 #include <G3D/Vector3.h>
+#include <memory>
 
 class Unit;
 class WorldObject;
 struct Position;
+struct PathRequest;
 
 // 74*4.0f=296y  number_of_points*interval = max_path_len
 // this is way more than actual evade range
@@ -52,6 +54,7 @@ enum PathType
     PATHFIND_FARFROMPOLY_START = 0x40,   // start position is far from the mmap poligon
     PATHFIND_FARFROMPOLY_END   = 0x80,   // end positions is far from the mmap poligon
     PATHFIND_FARFROMPOLY       = PATHFIND_FARFROMPOLY_START | PATHFIND_FARFROMPOLY_END, // start or end positions are far from the mmap poligon
+    PATHFIND_PENDING           = 0x100,  // path is being searched in the background, path points were not updated
 };
 
 class TC_GAME_API PathGenerator
@@ -78,6 +81,9 @@ class TC_GAME_API PathGenerator
         void SetUseStraightPath(bool useStraightPath) { _useStraightPath = useStraightPath; }
         void SetPathLengthLimit(float length);
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
+        // long searches are handed to the async pathfinder, CalculatePath returns PATHFIND_PENDING until a later call picks up the result
+        void SetUseAsync(bool useAsync) { _useAsync = useAsync; }
+        void CancelPathRequest();
 
         // result getters
         G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
@@ -103,6 +109,7 @@ class TC_GAME_API PathGenerator
         bool _forceDestination; // when set, we will always arrive at given point
         uint32 _pointPathLimit; // limit point path size; min(this, MAX_POINT_PATH_LENGTH)
         bool _useRaycast;       // use raycast if true for a straight line path
+        bool _useAsync;         // queue full corridor searches to the async pathfinder
 
         G3D::Vector3 _startPosition;        // {x, y, z} of current location
         G3D::Vector3 _endPosition;          // {x, y, z} of the destination
@@ -111,6 +118,8 @@ class TC_GAME_API PathGenerator
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        uint32 _meshMapId;                      // map id of the nav mesh
+        std::shared_ptr<PathRequest> _pathRequest; // corridor search running in the background
 
         dtQueryFilter _filter;  // use single filter for all movements, update it when needed
 
@@ -136,6 +145,7 @@ class TC_GAME_API PathGenerator
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
         void BuildPointPath(float const* startPoint, float const* endPoint);
         void BuildShortcut();
+        bool QueuePathRequest(dtPolyRef startPoly, dtPolyRef endPoly, float const* startPoint, float const* endPoint);
 
         NavTerrainFlag GetNavTerrain(float x, float y, float z);
         void CreateFilter();
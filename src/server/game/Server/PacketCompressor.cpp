@@ -0,0 +1,185 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PacketCompressor.h"
+#include "ByteConverter.h"
+#include "Log.h"
+#include "Metric.h"
+#include "Opcodes.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include "World.h"
+#include <zlib.h>
+#include <array>
+#include <chrono>
+#include <cstring>
+
+// packets of an opcode seen before its compression ratio is trusted
+static constexpr uint64 COMPRESSION_SAMPLE_PACKETS = 64;
+// every Nth packet of an opcode that compresses poorly is still compressed to keep its ratio up to date
+static constexpr uint64 COMPRESSION_PROBE_INTERVAL = 64;
+
+namespace
+{
+    std::array<PacketCompressor::OpcodeStatistics, NUM_OPCODE_HANDLERS> OpcodeCompressionStatistics;
+}
+
+PacketCompressor::PacketCompressor() : _stream(nullptr), _level(0), _compressedSize(0)
+{
+}
+
+PacketCompressor::~PacketCompressor()
+{
+    if (_stream)
+    {
+        deflateEnd(_stream);
+        delete _stream;
+    }
+}
+
+bool PacketCompressor::Initialize()
+{
+    _level = sWorld->getIntConfig(CONFIG_COMPRESSION);
+
+    _stream = new z_stream();
+    _stream->zalloc = (alloc_func)nullptr;
+    _stream->zfree = (free_func)nullptr;
+    _stream->opaque = (voidpf)nullptr;
+    _stream->avail_in = 0;
+    _stream->next_in = nullptr;
+    int32 z_res = deflateInit(_stream, _level);
+    if (z_res != Z_OK)
+    {
+        TC_LOG_ERROR("network", "Can't initialize packet compression (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
+        delete _stream;
+        _stream = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+bool PacketCompressor::Compress(uint16 opcode, uint8 const* data, std::size_t size)
+{
+    OpcodeStatistics& statistics = GetStatistics(opcode);
+    if (!ShouldCompress(statistics, size))
+        return false;
+
+    uint32 destSize = compressBound(uLong(size));
+    _buffer.resize(sizeof(uint32) + destSize);
+
+    uint32 uncompressedSize = uint32(size);
+    EndianConvert(uncompressedSize);
+    std::memcpy(_buffer.data(), &uncompressedSize, sizeof(uint32));
+
+    _stream->next_out = _buffer.data() + sizeof(uint32);
+    _stream->avail_out = destSize;
+
+    // big packets (login bursts of object updates and query responses) use their own, usually faster, level
+    int32 level = size >= sWorld->getIntConfig(CONFIG_COMPRESSION_LARGE_PACKET_SIZE)
+        ? sWorld->getIntConfig(CONFIG_COMPRESSION_LARGE_PACKET_LEVEL)
+        : sWorld->getIntConfig(CONFIG_COMPRESSION);
+    if (!SetLevel(level))
+        return false;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    _stream->next_in = const_cast<Bytef*>(data);
+    _stream->avail_in = uInt(size);
+
+    int32 z_res = deflate(_stream, Z_SYNC_FLUSH);
+    if (z_res != Z_OK)
+    {
+        TC_LOG_ERROR("network", "Can't compress packet (zlib: deflate) Error code: %i (%s, msg: %s)", z_res, zError(z_res), _stream->msg);
+        return false;
+    }
+
+    if (_stream->avail_in != 0)
+    {
+        TC_LOG_ERROR("network", "Can't compress packet (zlib: deflate not greedy)");
+        return false;
+    }
+
+    _compressedSize = std::size_t(_stream->next_out - _buffer.data());
+
+    ++statistics.Packets;
+    statistics.UncompressedBytes += size;
+    statistics.CompressedBytes += _compressedSize;
+    statistics.TimeMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+bool PacketCompressor::ShouldCompress(OpcodeStatistics& statistics, std::size_t size) const
+{
+    if (!_stream || size <= sWorld->getIntConfig(CONFIG_COMPRESSION_THRESHOLD))
+        return false;
+
+    uint64 packets = statistics.Packets;
+    if (packets < COMPRESSION_SAMPLE_PACKETS)
+        return true;
+
+    // output shares the inflate context with all other packets, so a compressed packet can not be replaced
+    // by its uncompressed form afterwards - decide from the ratio this opcode had so far instead
+    if (statistics.CompressedBytes * 100 <= statistics.UncompressedBytes * sWorld->getIntConfig(CONFIG_COMPRESSION_MAX_RATIO))
+        return true;
+
+    return ++statistics.SkippedPackets % COMPRESSION_PROBE_INTERVAL == 0;
+}
+
+bool PacketCompressor::SetLevel(int32 level)
+{
+    if (level == _level)
+        return true;
+
+    // previous packet was flushed, switching parameters does not emit any data
+    int32 z_res = deflateParams(_stream, level, Z_DEFAULT_STRATEGY);
+    if (z_res != Z_OK)
+    {
+        TC_LOG_ERROR("network", "Can't change packet compression level to %i (zlib: deflateParams) Error code: %i (%s)", level, z_res, zError(z_res));
+        return false;
+    }
+
+    _level = level;
+    return true;
+}
+
+PacketCompressor::OpcodeStatistics& PacketCompressor::GetStatistics(uint16 opcode)
+{
+    return OpcodeCompressionStatistics[opcode & ~AsUnderlyingType(COMPRESSED_OPCODE_MASK)];
+}
+
+void PacketCompressor::ReportStatistics()
+{
+    if (!sMetric->IsEnabled())
+        return;
+
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+    {
+        OpcodeStatistics const& statistics = OpcodeCompressionStatistics[opcode];
+        if (!statistics.Packets && !statistics.SkippedPackets)
+            continue;
+
+        ServerOpcodeHandler const* handler = opcodeTable[static_cast<OpcodeServer>(opcode)];
+        std::string name = handler ? handler->Name : Trinity::StringFormat("0x%04X", opcode);
+
+        TC_METRIC_VALUE("compressed_packets_" + name, statistics.Packets.load());
+        TC_METRIC_VALUE("compression_skipped_packets_" + name, statistics.SkippedPackets.load());
+        TC_METRIC_VALUE("compression_uncompressed_bytes_" + name, statistics.UncompressedBytes.load());
+        TC_METRIC_VALUE("compression_compressed_bytes_" + name, statistics.CompressedBytes.load());
+        TC_METRIC_VALUE("compression_time_us_" + name, statistics.TimeMicroseconds.load());
+    }
+}
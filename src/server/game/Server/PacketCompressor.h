@@ -0,0 +1,70 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PACKET_COMPRESSOR_H
+#define _PACKET_COMPRESSOR_H
+
+#include "Define.h"
+#include <atomic>
+#include <vector>
+
+struct z_stream_s;
+
+// Per connection deflate stream used for all compressed packets sent on it
+// The client keeps a single inflate context per connection, so compressed output can not be reused on another connection
+class TC_GAME_API PacketCompressor
+{
+    public:
+        struct OpcodeStatistics
+        {
+            std::atomic<uint64> Packets = 0;
+            std::atomic<uint64> SkippedPackets = 0;
+            std::atomic<uint64> UncompressedBytes = 0;
+            std::atomic<uint64> CompressedBytes = 0;
+            std::atomic<uint64> TimeMicroseconds = 0;
+        };
+
+        PacketCompressor();
+        ~PacketCompressor();
+
+        PacketCompressor(PacketCompressor const& right) = delete;
+        PacketCompressor& operator=(PacketCompressor const& right) = delete;
+
+        bool Initialize();
+        bool IsInitialized() const { return _stream != nullptr; }
+
+        // compresses the packet payload into the internal buffer, returns false if the packet must be sent uncompressed
+        bool Compress(uint16 opcode, uint8 const* data, std::size_t size);
+
+        // uncompressed size followed by deflate output, valid until the next Compress call
+        uint8 const* GetCompressedData() const { return _buffer.data(); }
+        std::size_t GetCompressedSize() const { return _compressedSize; }
+
+        static OpcodeStatistics& GetStatistics(uint16 opcode);
+        static void ReportStatistics();
+
+    private:
+        bool ShouldCompress(OpcodeStatistics& statistics, std::size_t size) const;
+        bool SetLevel(int32 level);
+
+        z_stream_s* _stream;
+        int32 _level;
+        std::vector<uint8> _buffer;
+        std::size_t _compressedSize;
+};
+
+#endif
@@ -21,53 +21,57 @@
 
 WorldPacket const* WorldPackets::CombatLog::AttackerStateUpdate::Write()
 {
-    _worldPacket << int32(HitInfo);
-    _worldPacket << AttackerGUID.WriteAsPacked();
-    _worldPacket << VictimGUID.WriteAsPacked();
-    _worldPacket << int32(Damage);
-    _worldPacket << int32(OverDamage);
-    _worldPacket << uint8(SubDmg.has_value());
+    WritePayload(_worldPacket);
+    return &_worldPacket;
+}
+
+void WorldPackets::CombatLog::AttackerStateUpdate::WritePayload(ByteBuffer& data) const
+{
+    data << int32(HitInfo);
+    data << AttackerGUID.WriteAsPacked();
+    data << VictimGUID.WriteAsPacked();
+    data << int32(Damage);
+    data << int32(OverDamage);
+    data << uint8(SubDmg.has_value());
 
     if (SubDmg)
     {
-        _worldPacket << int32(SubDmg->SchoolMask);
-        _worldPacket << float(SubDmg->FDamage);
-        _worldPacket << int32(SubDmg->Damage);
+        data << int32(SubDmg->SchoolMask);
+        data << float(SubDmg->FDamage);
+        data << int32(SubDmg->Damage);
 
         if (HitInfo & (HITINFO_FULL_ABSORB | HITINFO_PARTIAL_ABSORB))
-            _worldPacket << int32(SubDmg->Absorbed);
+            data << int32(SubDmg->Absorbed);
         if (HitInfo & (HITINFO_FULL_RESIST | HITINFO_PARTIAL_RESIST))
-            _worldPacket << int32(SubDmg->Resisted);
+            data << int32(SubDmg->Resisted);
     }
 
-    _worldPacket << uint8(VictimState);
-    _worldPacket << uint32(AttackerState);
-    _worldPacket << uint32(MeleeSpellID);
+    data << uint8(VictimState);
+    data << uint32(AttackerState);
+    data << uint32(MeleeSpellID);
 
     if (HitInfo & HITINFO_BLOCK)
-        _worldPacket << int32(BlockAmount);
+        data << int32(BlockAmount);
 
     if (HitInfo & HITINFO_RAGE_GAIN)
-        _worldPacket << int32(RageGained);
+        data << int32(RageGained);
 
     if (HitInfo & HITINFO_UNK1)
     {
-        _worldPacket << int32(UnkState.State1);
-        _worldPacket << float(UnkState.State2);
-        _worldPacket << float(UnkState.State3);
-        _worldPacket << float(UnkState.State4);
-        _worldPacket << float(UnkState.State5);
-        _worldPacket << float(UnkState.State6);
-        _worldPacket << float(UnkState.State7);
-        _worldPacket << float(UnkState.State8);
-        _worldPacket << float(UnkState.State9);
-        _worldPacket << float(UnkState.State10);
-        _worldPacket << float(UnkState.State11);
-        _worldPacket << int32(UnkState.State12);
-        _worldPacket << int32(UnkState.State13);
+        data << int32(UnkState.State1);
+        data << float(UnkState.State2);
+        data << float(UnkState.State3);
+        data << float(UnkState.State4);
+        data << float(UnkState.State5);
+        data << float(UnkState.State6);
+        data << float(UnkState.State7);
+        data << float(UnkState.State8);
+        data << float(UnkState.State9);
+        data << float(UnkState.State10);
+        data << float(UnkState.State11);
+        data << int32(UnkState.State12);
+        data << int32(UnkState.State13);
     }
-
-    return &_worldPacket;
 }
 
 WorldPacket const* WorldPackets::CombatLog::SpellEnergizeLog::Write()
@@ -55,9 +55,11 @@ namespace WorldPackets
         class AttackerStateUpdate final : public ServerPacket
         {
         public:
-            AttackerStateUpdate() : ServerPacket(SMSG_ATTACKER_STATE_UPDATE, 62) { }
+            AttackerStateUpdate(size_t initialSize = 62) : ServerPacket(SMSG_ATTACKER_STATE_UPDATE, initialSize) { }
 
             WorldPacket const* Write() override;
+            // writes the packet to another buffer, leaving this one untouched
+            void WritePayload(ByteBuffer& data) const;
 
             uint32 HitInfo = 0; // Flags
             ObjectGuid AttackerGUID;
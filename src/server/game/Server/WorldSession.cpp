@@ -224,16 +224,53 @@ ObjectGuid::LowType WorldSession::GetGUIDLow() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/)
+{
+    ConnectionType conIdx = PrepareSendPacket(packet, forced);
+    if (conIdx == MAX_CONNECTION_TYPES)
+        return;
+
+    m_Socket[conIdx]->SendPacket(*packet);
+}
+
+/// Send a packet shared with other sessions to the client, payload is not copied
+void WorldSession::SendPacket(SharedWorldPacket const& packet, bool forced /*= false*/)
+{
+    ConnectionType conIdx = PrepareSendPacket(packet.get(), forced);
+    if (conIdx == MAX_CONNECTION_TYPES)
+        return;
+
+    m_Socket[conIdx]->SendPacket(packet);
+}
+
+/// Send a packet to several clients, payload is copied once for all of them instead of once per socket
+void WorldSession::MulticastPacket(std::vector<WorldSession*> const& sessions, WorldPacket const* packet)
+{
+    if (sessions.empty())
+        return;
+
+    if (sessions.size() == 1)
+    {
+        sessions.front()->SendPacket(packet);
+        return;
+    }
+
+    SharedWorldPacket shared = std::make_shared<WorldPacket>(*packet);
+    for (WorldSession* session : sessions)
+        session->SendPacket(shared);
+}
+
+/// Validates an outgoing packet and picks its socket, returns MAX_CONNECTION_TYPES if it must not be sent
+ConnectionType WorldSession::PrepareSendPacket(WorldPacket const* packet, bool forced)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of NULL_OPCODE to %s", GetPlayerInfo().c_str());
-        return;
+        return MAX_CONNECTION_TYPES;
     }
     else if (packet->GetOpcode() == UNKNOWN_OPCODE)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of UNKNOWN_OPCODE to %s", GetPlayerInfo().c_str());
-        return;
+        return MAX_CONNECTION_TYPES;
     }
 
     ServerOpcodeHandler const* handler = opcodeTable[static_cast<OpcodeServer>(packet->GetOpcode())];
@@ -241,7 +278,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!handler)
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of opcode %u with non existing handler to %s", packet->GetOpcode(), GetPlayerInfo().c_str());
-        return;
+        return MAX_CONNECTION_TYPES;
     }
 
     // Default connection index defined in Opcodes.cpp table
@@ -253,7 +290,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (packet->GetConnection() != CONNECTION_TYPE_INSTANCE && IsInstanceOnlyOpcode(packet->GetOpcode()))
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending of instance only opcode %u with connection type %u to %s", packet->GetOpcode(), uint32(packet->GetConnection()), GetPlayerInfo().c_str());
-            return;
+            return MAX_CONNECTION_TYPES;
         }
 
         conIdx = packet->GetConnection();
@@ -262,7 +299,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
     if (!m_Socket[conIdx])
     {
         TC_LOG_ERROR("network.opcode", "Prevented sending of %s to non existent socket %u to %s", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str(), uint32(conIdx), GetPlayerInfo().c_str());
-        return;
+        return MAX_CONNECTION_TYPES;
     }
 
     if (!forced)
@@ -271,7 +308,7 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
         if (!handler || handler->Status == STATUS_UNHANDLED)
         {
             TC_LOG_ERROR("network.opcode", "Prevented sending disabled opcode %s to %s", GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str(), GetPlayerInfo().c_str());
-            return;
+            return MAX_CONNECTION_TYPES;
         }
     }
 
@@ -313,11 +350,11 @@ void WorldSession::SendPacket(WorldPacket const* packet, bool forced /*= false*/
 
 #ifdef ELUNA
     if (!sEluna->OnPacketSend(this, *packet))
-        return;
+        return MAX_CONNECTION_TYPES;
 #endif
 
     TC_LOG_TRACE("network.opcode", "S->C: %s %s", GetPlayerInfo().c_str(), GetOpcodeNameForLogging(static_cast<OpcodeServer>(packet->GetOpcode())).c_str());
-    m_Socket[conIdx]->SendPacket(*packet);
+    return conIdx;
 }
 
 /// Add an incoming packet to the queue
@@ -482,6 +482,9 @@ class TC_GAME_API WorldSession
         void SendAddonsInfo();
         bool IsAddonRegistered(const std::string& prefix) const;
         void SendPacket(WorldPacket const* packet, bool forced = false);
+        void SendPacket(SharedWorldPacket const& packet, bool forced = false);
+        // Sends the same packet to all sessions, serialized once and shared between their sockets
+        static void MulticastPacket(std::vector<WorldSession*> const& sessions, WorldPacket const* packet);
         void AddInstanceConnection(std::shared_ptr<WorldSocket> sock) { m_Socket[1] = sock; }
 
         void SendNotification(const char *format, ...) ATTR_PRINTF(2, 3);
@@ -1340,6 +1343,8 @@ class TC_GAME_API WorldSession
 
         bool CanUseBank(ObjectGuid bankerGUID = ObjectGuid::Empty) const;
 
+        ConnectionType PrepareSendPacket(WorldPacket const* packet, bool forced);
+
         // logging helper
         void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char *reason);
 
@@ -36,7 +36,6 @@
 #ifdef ELUNA
 #include "LuaEngine.h"
 #endif
-#include <zlib.h>
 #include <memory>
 
 using boost::asio::ip::tcp;
@@ -46,20 +45,13 @@ std::string const WorldSocket::ClientConnectionInitialize("WORLD OF WARCRAFT CON
 
 WorldSocket::WorldSocket(tcp::socket&& socket) : Socket(std::move(socket)),
     _type(CONNECTION_TYPE_REALM), _authSeed(rand32()), _OverSpeedPings(0), _worldSession(nullptr),
-    _authed(false), _compressionStream(nullptr), _sendBufferSize(4096),
+    _authed(false), _sendBufferSize(4096),
     _initialized(false)
 {
     _headerBuffer.Resize(2);
 }
 
-WorldSocket::~WorldSocket()
-{
-    if (_compressionStream)
-    {
-        deflateEnd(_compressionStream);
-        delete _compressionStream;
-    }
-}
+WorldSocket::~WorldSocket() = default;
 
 void WorldSocket::Start()
 {
@@ -68,6 +60,7 @@ void WorldSocket::Start()
     stmt->setString(0, ip_address);
 
     _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::CheckIpCallback, this, std::placeholders::_1)));
+    RequestUpdate();
 }
 
 void WorldSocket::CheckIpCallback(PreparedQueryResult result)
@@ -109,40 +102,62 @@ bool WorldSocket::Update()
     MessageBuffer buffer(_sendBufferSize);
     while (_bufferQueue.Dequeue(queued))
     {
-        if (queued->size() > 0x400 && !queued->IsCompressed())
-            queued->Compress(_compressionStream);
+        WorldPacket const& payload = queued->GetPayload();
+        uint16 opcode = queued->GetOpcode();
+        uint8 const* data = payload.empty() ? nullptr : payload.contents();
+        std::size_t size = payload.size();
 
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
-        if (queued->NeedsEncryption())
-            _authCrypt.EncryptSend(header.header, header.getHeaderLength());
+        // compressed into a per socket buffer, shared payloads stay untouched
+        if (!queued->IsCompressed() && _compressor.Compress(opcode, data, size))
+        {
+            opcode |= AsUnderlyingType(COMPRESSED_OPCODE_MASK);
+            data = _compressor.GetCompressedData();
+            size = _compressor.GetCompressedSize();
+        }
+
+        ServerPktHeader header(size + 2, opcode);
+        uint8* headerPosition;
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() < size + header.getHeaderLength())
         {
-            QueuePacket(std::move(buffer));
+            _pendingWrites.push_back(std::move(buffer));
             buffer.Resize(_sendBufferSize);
         }
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() >= size + header.getHeaderLength())
         {
+            headerPosition = buffer.GetWritePointer();
             buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
+            if (size)
+                buffer.Write(data, size);
         }
         else    // single packet larger than 4096 bytes
         {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
+            MessageBuffer packetBuffer(size + header.getHeaderLength());
+            headerPosition = packetBuffer.GetWritePointer();
             packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+            if (size)
+                packetBuffer.Write(data, size);
 
-            QueuePacket(std::move(packetBuffer));
+            _pendingWrites.push_back(std::move(packetBuffer));
         }
 
+        // moving a MessageBuffer keeps its storage, the position stays valid until the buffer is queued
+        if (queued->NeedsEncryption())
+            _pendingHeaders.emplace_back(headerPosition, header.getHeaderLength());
+
         delete queued;
     }
 
     if (buffer.GetActiveSize() > 0)
-        QueuePacket(std::move(buffer));
+        _pendingWrites.push_back(std::move(buffer));
+
+    EncryptPendingHeaders();
+
+    for (MessageBuffer& pendingWrite : _pendingWrites)
+        QueuePacket(std::move(pendingWrite));
+
+    _pendingWrites.clear();
 
     if (!BaseSocket::Update())
         return false;
@@ -152,6 +167,28 @@ bool WorldSocket::Update()
     return true;
 }
 
+void WorldSocket::EncryptPendingHeaders()
+{
+    if (_pendingHeaders.empty())
+        return;
+
+    // all headers of this flush go through the cipher in a single call
+    _headerCryptBuffer.clear();
+    for (std::pair<uint8*, uint8> const& header : _pendingHeaders)
+        _headerCryptBuffer.insert(_headerCryptBuffer.end(), header.first, header.first + header.second);
+
+    _authCrypt.EncryptSend(_headerCryptBuffer.data(), _headerCryptBuffer.size());
+
+    uint8 const* encrypted = _headerCryptBuffer.data();
+    for (std::pair<uint8*, uint8> const& header : _pendingHeaders)
+    {
+        memcpy(header.first, encrypted, header.second);
+        encrypted += header.second;
+    }
+
+    _pendingHeaders.clear();
+}
+
 void WorldSocket::HandleSendAuthSession()
 {
     _encryptSeed.SetRand(16 * 8);
@@ -475,16 +512,8 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
             return ReadDataHandlerResult::Error;
         }
 
-        _compressionStream = new z_stream();
-        _compressionStream->zalloc = (alloc_func)nullptr;
-        _compressionStream->zfree = (free_func)nullptr;
-        _compressionStream->opaque = (voidpf)nullptr;
-        _compressionStream->avail_in = 0;
-        _compressionStream->next_in = nullptr;
-        int32 z_res = deflateInit(_compressionStream, sWorld->getIntConfig(CONFIG_COMPRESSION));
-        if (z_res != Z_OK)
+        if (!_compressor.Initialize())
         {
-            TC_LOG_ERROR("network", "Can't initialize packet compression (zlib: deflateInit) Error code: %i (%s)", z_res, zError(z_res));
             CloseSocket();
             return ReadDataHandlerResult::Error;
         }
@@ -526,6 +555,19 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+    RequestUpdate();
+}
+
+void WorldSocket::SendPacket(SharedWorldPacket const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+
+    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+    RequestUpdate();
 }
 
 void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession)
@@ -536,6 +578,7 @@ void WorldSocket::HandleAuthSession(std::shared_ptr<WorldPackets::Auth::AuthSess
     stmt->setString(1, authSession->Account);
 
     _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
+    RequestUpdate();
 }
 
 void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthSession> authSession, PreparedQueryResult result)
@@ -695,6 +738,7 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<WorldPackets::Auth::
         _worldSession->InitWarden(&account.Game.SessionKey, account.BattleNet.OS);
 
     _queryProcessor.AddCallback(_worldSession->LoadPermissionsAsync().WithPreparedCallback(std::bind(&WorldSocket::LoadSessionPermissionsCallback, this, std::placeholders::_1)));
+    RequestUpdate();
     AsyncRead();
 }
 
@@ -727,6 +771,7 @@ void WorldSocket::HandleAuthContinuedSession(std::shared_ptr<WorldPackets::Auth:
     stmt->setUInt32(0, accountId);
 
     _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthContinuedSessionCallback, this, authSession, std::placeholders::_1)));
+    RequestUpdate();
 }
 
 void WorldSocket::HandleAuthContinuedSessionCallback(std::shared_ptr<WorldPackets::Auth::AuthContinuedSession> authSession, PreparedQueryResult result)
@@ -28,7 +28,9 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include "MPSCQueue.h"
+#include "PacketCompressor.h"
 #include <chrono>
+#include <deque>
 #include <boost/asio/ip/tcp.hpp>
 
 using boost::asio::ip::tcp;
@@ -40,16 +42,24 @@ public:
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
+    // payload stays in the shared buffer, only opcode and connection are copied
+    EncryptablePacket(SharedWorldPacket packet, bool encrypt) : WorldPacket(packet->GetOpcode(), 0, packet->GetConnection()),
+        _shared(std::move(packet)), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    WorldPacket const& GetPayload() const { return _shared ? *_shared : *this; }
+
     bool NeedsEncryption() const { return _encrypt; }
 
     std::atomic<EncryptablePacket*> SocketQueueLink;
 
 private:
+    SharedWorldPacket _shared;
     bool _encrypt;
 };
 
-struct z_stream_s;
-
 namespace WorldPackets
 {
     class ServerPacket;
@@ -93,8 +103,10 @@ public:
 
     void Start() override;
     bool Update() override;
+    bool HasPendingCallbacks() const override { return !_queryProcessor.Empty(); }
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(SharedWorldPacket const& packet);
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
     ConnectionType GetConnectionType() const { return _type; }
@@ -118,6 +130,7 @@ protected:
 
 private:
     void CheckIpCallback(PreparedQueryResult result);
+    void EncryptPendingHeaders();
 
     /// writes network.opcode log
     /// accessing WorldSession is not threadsafe, only do it when holding _worldSessionLock
@@ -150,11 +163,17 @@ private:
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
 
-    z_stream_s* _compressionStream;
+    PacketCompressor _compressor;
 
     MPSCQueue<EncryptablePacket, &EncryptablePacket::SocketQueueLink> _bufferQueue;
     std::size_t _sendBufferSize;
 
+    // scratch space of Update, buffers are queued for writing only after their headers are encrypted
+    // deque never relocates its elements, header positions stay valid while more buffers are added
+    std::deque<MessageBuffer> _pendingWrites;
+    std::vector<std::pair<uint8*, uint8>> _pendingHeaders;
+    std::vector<uint8> _headerCryptBuffer;
+
     bool _initialized;
 
     QueryCallbackProcessor _queryProcessor;
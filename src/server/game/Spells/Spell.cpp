@@ -36,6 +36,7 @@
 #include "Item.h"
 #include "Log.h"
 #include "LootMgr.h"
+#include "MapSpatialIndex.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
@@ -51,6 +52,7 @@
 #include "SpellPackets.h"
 #include "SpellScript.h"
 #include "TemporarySummon.h"
+#include "ThreadLocalPool.h"
 #include "TradeData.h"
 #include "Unit.h"
 #include "UpdateData.h"
@@ -547,6 +549,9 @@ public:
     SpellEvent(Spell* spell);
     ~SpellEvent();
 
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     bool Execute(uint64 e_time, uint32 p_time) override;
     void Abort(uint64 e_time) override;
     bool IsDeletable() const override;
@@ -556,6 +561,19 @@ protected:
     Spell* m_Spell;
 };
 
+namespace
+{
+    // enough freed spells and events for the casts of a busy map update, kept by each thread
+    typedef Trinity::ThreadLocalPool<sizeof(Spell), 256> SpellPool;
+    typedef Trinity::ThreadLocalPool<sizeof(SpellEvent), 256> SpellEventPool;
+
+    // Nodes of the std::list<WorldObject*> target lists of area and chain target selection, the list type script hooks work on.
+    // Selection recurses when scripts cast spells from their hooks, the spare nodes are shared by all lists of the thread.
+    typedef Trinity::ThreadLocalListNodes<WorldObject*, 4096> TargetListNodes;
+    typedef TargetListNodes::Inserter TargetListInserter;
+    typedef TargetListNodes::Recycler TargetListRecycler;
+}
+
 Spell::Spell(WorldObject* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID) :
 m_spellInfo(sSpellMgr->GetSpellForDifficultyFromSpell(info, caster)),
 m_caster((info->HasAttribute(SPELL_ATTR6_ORIGINATE_FROM_CONTROLLER) && caster->GetCharmerOrOwner()) ? caster->GetCharmerOrOwner() : caster)
@@ -707,6 +725,25 @@ Spell::~Spell()
     AssertEffectExecuteData();
 }
 
+void* Spell::operator new(std::size_t size)
+{
+    if (size != sizeof(Spell))
+        return ::operator new(size);
+
+    return SpellPool::Allocate();
+}
+
+void Spell::operator delete(void* ptr, std::size_t size)
+{
+    if (size != sizeof(Spell))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    SpellPool::Deallocate(ptr);
+}
+
 void Spell::InitExplicitTargets(SpellCastTargets const& targets)
 {
     m_targets = targets;
@@ -1303,6 +1340,7 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
     }
 
     std::list<WorldObject*> targets;
+    TargetListRecycler recycler(targets);
     SpellTargetObjectTypes objectType = targetType.GetObjectType();
     SpellTargetCheckTypes selectionType = targetType.GetCheckType();
     ConditionContainer* condList = m_spellInfo->Effects[effIndex].ImplicitTargetConditions;
@@ -1317,7 +1355,8 @@ void Spell::SelectImplicitConeTargets(SpellEffIndex effIndex, SpellImplicitTarge
     if (uint32 containerTypeMask = GetSearcherTypeMask(objectType, condList))
     {
         Trinity::WorldObjectSpellConeTargetCheck check(coneSrc, DegToRad(coneAngle), radius, m_caster, m_spellInfo, selectionType, condList);
-        Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellConeTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
+        TargetListInserter inserter(targets);
+        Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellConeTargetCheck> searcher(m_caster, inserter, check, containerTypeMask);
         SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellConeTargetCheck> >(searcher, containerTypeMask, m_caster, m_caster, radius);
 
         CallScriptObjectAreaTargetSelectHandlers(targets, effIndex, targetType);
@@ -1403,6 +1442,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
     radius *= m_spellValue->RadiusMod;
 
     std::list<WorldObject*> targets;
+    TargetListRecycler recycler(targets);
     switch (targetType.GetTarget())
     {
         case TARGET_UNIT_CASTER_AND_PASSENGERS:
@@ -1764,6 +1804,7 @@ void Spell::SelectImplicitChainTargets(SpellEffIndex effIndex, SpellImplicitTarg
         m_applyMultiplierMask |= effMask;
 
         std::list<WorldObject*> targets;
+        TargetListRecycler recycler(targets);
         SearchChainTargets(targets, maxTargets - 1, target, targetType.GetObjectType(), targetType.GetCheckType()
             , m_spellInfo->Effects[effIndex], targetType.GetTarget() == TARGET_UNIT_TARGET_CHAINHEAL_ALLY);
 
@@ -1810,8 +1851,10 @@ void Spell::SelectImplicitTrajTargets(SpellEffIndex effIndex, SpellImplicitTarge
     float srcToDestDelta = m_targets.GetDstPos()->m_positionZ - srcPos.m_positionZ;
 
     std::list<WorldObject*> targets;
+    TargetListRecycler recycler(targets);
+    TargetListInserter inserter(targets);
     Trinity::WorldObjectSpellTrajTargetCheck check(dist2d, &srcPos, m_caster, m_spellInfo, targetType.GetCheckType(), m_spellInfo->Effects[effIndex].ImplicitTargetConditions);
-    Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellTrajTargetCheck> searcher(m_caster, targets, check, GRID_MAP_TYPE_MASK_ALL);
+    Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellTrajTargetCheck> searcher(m_caster, inserter, check, GRID_MAP_TYPE_MASK_ALL);
     SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellTrajTargetCheck> > (searcher, GRID_MAP_TYPE_MASK_ALL, m_caster, &srcPos, dist2d);
     if (targets.empty())
         return;
@@ -2032,6 +2075,29 @@ void Spell::SearchTargets(SEARCHER& searcher, uint32 containerMask, WorldObject*
 
         Map* map = referer->GetMap();
 
+        // units only, the padding keeps the prefilter wider than the hitbox checks of every spell target check
+        if constexpr (requires(SEARCHER& s, WorldObject* object) { s.VisitObject(object); })
+        {
+            MapSpatialIndex const* spatialIndex = map->GetSpatialIndex();
+            if (spatialIndex && !(containerMask & ~(GRID_MAP_TYPE_MASK_CREATURE | GRID_MAP_TYPE_MASK_PLAYER)))
+            {
+                // reuse the buffer between searches, taken out while visiting in case a target check starts another search
+                static thread_local std::vector<WorldObject*> candidateBuffer;
+                std::vector<WorldObject*> candidates;
+                candidates.swap(candidateBuffer);
+                candidates.clear();
+
+                bool queried = spatialIndex->Query(x, y, radius, m_caster->GetCombatReach() + NOMINAL_MELEE_RANGE, containerMask, candidates);
+                if (queried)
+                    for (WorldObject* candidate : candidates)
+                        searcher.VisitObject(candidate);
+
+                candidates.swap(candidateBuffer);
+                if (queried)
+                    return;
+            }
+        }
+
         if (searchInWorld)
             Cell::VisitWorldObjects(x, y, map, searcher, radius);
 
@@ -2058,7 +2124,8 @@ void Spell::SearchAreaTargets(std::list<WorldObject*>& targets, float range, Pos
     if (!containerTypeMask)
         return;
     Trinity::WorldObjectSpellAreaTargetCheck check(range, position, m_caster, referer, m_spellInfo, selectionType, condList);
-    Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellAreaTargetCheck> searcher(m_caster, targets, check, containerTypeMask);
+    TargetListInserter inserter(targets);
+    Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellAreaTargetCheck> searcher(m_caster, inserter, check, containerTypeMask);
     SearchTargets<Trinity::WorldObjectListSearcher<Trinity::WorldObjectSpellAreaTargetCheck> > (searcher, containerTypeMask, m_caster, position, range);
 }
 
@@ -2098,6 +2165,7 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
 
     WorldObject* chainSource = m_spellInfo->HasAttribute(SPELL_ATTR2_CHAIN_FROM_CASTER) ? m_caster : target;
     std::list<WorldObject*> tempTargets;
+    TargetListRecycler recycler(tempTargets);
     SearchAreaTargets(tempTargets, searchRadius, chainSource, m_caster, objectType, selectType, spellEffectInfo.ImplicitTargetConditions);
     tempTargets.remove(target);
 
@@ -2153,8 +2221,7 @@ void Spell::SearchChainTargets(std::list<WorldObject*>& targets, uint32 chainTar
         if (!m_spellInfo->HasAttribute(SPELL_ATTR2_CHAIN_FROM_CASTER))
             chainSource = *foundItr;
 
-        targets.push_back(*foundItr);
-        tempTargets.erase(foundItr);
+        targets.splice(targets.end(), tempTargets, foundItr);
         --chainTargets;
     }
 }
@@ -3896,7 +3963,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
 
     // now recheck units targeting correctness (need before any effects apply to prevent adding immunity at first effect not allow apply second spell effect and similar cases)
     {
-        std::vector<TargetInfo> delayedTargets;
+        TargetInfoContainer delayedTargets;
         m_UniqueTargetInfo.erase(std::remove_if(m_UniqueTargetInfo.begin(), m_UniqueTargetInfo.end(), [&](TargetInfo& target) -> bool
         {
             if (single_missile || target.TimeDelay <= t_offset)
@@ -3916,7 +3983,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
 
     // now recheck gameobject targeting correctness
     {
-        std::vector<GOTargetInfo> delayedGOTargets;
+        GOTargetInfoContainer delayedGOTargets;
         m_UniqueGOTargetInfo.erase(std::remove_if(m_UniqueGOTargetInfo.begin(), m_UniqueGOTargetInfo.end(), [&](GOTargetInfo& goTarget) -> bool
         {
             if (single_missile || goTarget.TimeDelay <= t_offset)
@@ -3936,7 +4003,7 @@ uint64 Spell::handle_delayed(uint64 t_offset)
 
     // now recheck corpse targeting correctness
     {
-        std::vector<CorpseTargetInfo> delayedCorpseTargets;
+        CorpseTargetInfoContainer delayedCorpseTargets;
         auto itr = std::remove_if(std::begin(m_UniqueCorpseTargetInfo), std::end(m_UniqueCorpseTargetInfo), [&](CorpseTargetInfo& goTarget) -> bool
         {
             if (single_missile || goTarget.TimeDelay <= t_offset)
@@ -7890,6 +7957,25 @@ SpellEvent::SpellEvent(Spell* spell) : BasicEvent()
     m_Spell = spell;
 }
 
+void* SpellEvent::operator new(std::size_t size)
+{
+    if (size != sizeof(SpellEvent))
+        return ::operator new(size);
+
+    return SpellEventPool::Allocate();
+}
+
+void SpellEvent::operator delete(void* ptr, std::size_t size)
+{
+    if (size != sizeof(SpellEvent))
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    SpellEventPool::Deallocate(ptr);
+}
+
 SpellEvent::~SpellEvent()
 {
     if (m_Spell->getState() != SPELL_STATE_FINISHED)
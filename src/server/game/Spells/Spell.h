@@ -27,6 +27,7 @@
 #include "SharedDefines.h"
 #include <any>
 #include <memory>
+#include <boost/container/small_vector.hpp>
 
 namespace WorldPackets
 {
@@ -424,6 +425,10 @@ class TC_GAME_API Spell
         Spell(WorldObject* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty);
         ~Spell();
 
+        // Spells are allocated from a pool of the thread freeing them, they only live for the duration of their cast
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr, std::size_t size);
+
         void InitExplicitTargets(SpellCastTargets const& targets);
         void SelectExplicitTargets();
 
@@ -716,7 +721,9 @@ class TC_GAME_API Spell
             Unit* _spellHitTarget = nullptr; // changed for example by reflect
             bool _enablePVP = false;         // need to enable PVP at DoDamageAndTriggers?
         };
-        std::vector<TargetInfo> m_UniqueTargetInfo;
+        // the few targets of most casts are stored inline, in the pooled spell itself
+        typedef boost::container::small_vector<TargetInfo, 4> TargetInfoContainer;
+        TargetInfoContainer m_UniqueTargetInfo;
         uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
         struct GOTargetInfo : public TargetInfoBase
@@ -726,7 +733,8 @@ class TC_GAME_API Spell
             ObjectGuid TargetGUID;
             uint64 TimeDelay = 0ULL;
         };
-        std::vector<GOTargetInfo> m_UniqueGOTargetInfo;
+        typedef boost::container::small_vector<GOTargetInfo, 2> GOTargetInfoContainer;
+        GOTargetInfoContainer m_UniqueGOTargetInfo;
 
         struct ItemTargetInfo : public TargetInfoBase
         {
@@ -734,7 +742,8 @@ class TC_GAME_API Spell
 
             Item* TargetItem = nullptr;
         };
-        std::vector<ItemTargetInfo> m_UniqueItemInfo;
+        typedef boost::container::small_vector<ItemTargetInfo, 1> ItemTargetInfoContainer;
+        ItemTargetInfoContainer m_UniqueItemInfo;
 
         struct CorpseTargetInfo : public TargetInfoBase
         {
@@ -743,7 +752,8 @@ class TC_GAME_API Spell
             ObjectGuid TargetGUID;
             uint64 TimeDelay = 0ULL;
         };
-        std::vector<CorpseTargetInfo> m_UniqueCorpseTargetInfo;
+        typedef boost::container::small_vector<CorpseTargetInfo, 1> CorpseTargetInfoContainer;
+        CorpseTargetInfoContainer m_UniqueCorpseTargetInfo;
 
         template <class Container>
         void DoProcessTargetContainer(Container& targetContainer);
@@ -718,6 +718,20 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading", "Compression level (%i) must be in range 1..9. Using default compression level (1).", m_int_configs[CONFIG_COMPRESSION]);
         m_int_configs[CONFIG_COMPRESSION] = 1;
     }
+    m_int_configs[CONFIG_COMPRESSION_THRESHOLD] = sConfigMgr->GetIntDefault("Compression.Threshold", 1024);
+    m_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_SIZE] = sConfigMgr->GetIntDefault("Compression.LargePacketSize", 16384);
+    m_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] = sConfigMgr->GetIntDefault("Compression.LargePacketLevel", m_int_configs[CONFIG_COMPRESSION]);
+    if (m_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] < 1 || m_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] > 9)
+    {
+        TC_LOG_ERROR("server.loading", "Compression.LargePacketLevel (%i) must be in range 1..9. Using Compression level (%u).", m_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL], m_int_configs[CONFIG_COMPRESSION]);
+        m_int_configs[CONFIG_COMPRESSION_LARGE_PACKET_LEVEL] = m_int_configs[CONFIG_COMPRESSION];
+    }
+    m_int_configs[CONFIG_COMPRESSION_MAX_RATIO] = sConfigMgr->GetIntDefault("Compression.MaxRatio", 90);
+    if (m_int_configs[CONFIG_COMPRESSION_MAX_RATIO] < 1 || m_int_configs[CONFIG_COMPRESSION_MAX_RATIO] > 100)
+    {
+        TC_LOG_ERROR("server.loading", "Compression.MaxRatio (%i) must be in range 1..100. Set to 90.", m_int_configs[CONFIG_COMPRESSION_MAX_RATIO]);
+        m_int_configs[CONFIG_COMPRESSION_MAX_RATIO] = 90;
+    }
     m_bool_configs[CONFIG_ADDON_CHANNEL] = sConfigMgr->GetBoolDefault("AddonChannel", true);
     m_bool_configs[CONFIG_CLEAN_CHARACTER_DB] = sConfigMgr->GetBoolDefault("CleanCharacterDB", false);
     m_int_configs[CONFIG_PERSISTENT_CHARACTER_CLEAN_FLAGS] = sConfigMgr->GetIntDefault("PersistentCharacterCleanFlags", 0);
@@ -753,6 +767,30 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading", "InstanceMapLoadAllGrids enabled, but GridUnload also enabled. GridUnload must be disabled to enable instance map pre-loading. Instance map pre-loading disabled");
         m_bool_configs[CONFIG_INSTANCEMAP_LOAD_GRIDS] = false;
     }
+    m_int_configs[CONFIG_GRID_PREFETCH_THREADS] = sConfigMgr->GetIntDefault("GridPrefetch.Threads", 0);
+    m_bool_configs[CONFIG_GRID_PREFETCH_OBJECTS] = sConfigMgr->GetBoolDefault("GridPrefetch.LoadObjects", false);
+    m_int_configs[CONFIG_GRID_PREFETCH_OBJECTS_BUDGET] = sConfigMgr->GetIntDefault("GridPrefetch.LoadObjectsBudget", 2);
+    if (m_int_configs[CONFIG_GRID_PREFETCH_OBJECTS_BUDGET] < 1 || m_int_configs[CONFIG_GRID_PREFETCH_OBJECTS_BUDGET] > 50)
+    {
+        TC_LOG_ERROR("server.loading", "GridPrefetch.LoadObjectsBudget (%u) must be in range 1..50. Set to 2.", m_int_configs[CONFIG_GRID_PREFETCH_OBJECTS_BUDGET]);
+        m_int_configs[CONFIG_GRID_PREFETCH_OBJECTS_BUDGET] = 2;
+    }
+    m_float_configs[CONFIG_GRID_PREFETCH_DISTANCE] = sConfigMgr->GetFloatDefault("GridPrefetch.Distance", 200.0f);
+    if (m_float_configs[CONFIG_GRID_PREFETCH_DISTANCE] < 0.0f || m_float_configs[CONFIG_GRID_PREFETCH_DISTANCE] > SIZE_OF_GRIDS)
+    {
+        TC_LOG_ERROR("server.loading", "GridPrefetch.Distance (%f) must be in range 0..%f. Set to 200.", m_float_configs[CONFIG_GRID_PREFETCH_DISTANCE], SIZE_OF_GRIDS);
+        m_float_configs[CONFIG_GRID_PREFETCH_DISTANCE] = 200.0f;
+    }
+    m_bool_configs[CONFIG_SPATIAL_INDEX_UNITS] = sConfigMgr->GetBoolDefault("SpatialIndex.Units", false);
+    m_bool_configs[CONFIG_COMBAT_LOG_BATCHING] = sConfigMgr->GetBoolDefault("CombatLog.Batching", false);
+    m_bool_configs[CONFIG_MOVEMENT_RELAY] = sConfigMgr->GetBoolDefault("MovementRelay.Enable", false);
+    m_float_configs[CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE] = sConfigMgr->GetFloatDefault("MovementRelay.NearDistance", 40.0f);
+    if (m_float_configs[CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE] < 0.0f)
+    {
+        TC_LOG_ERROR("server.loading", "MovementRelay.NearDistance (%f) must be >= 0. Set to 40.", m_float_configs[CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE]);
+        m_float_configs[CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE] = 40.0f;
+    }
+    m_int_configs[CONFIG_MOVEMENT_RELAY_FAR_INTERVAL] = sConfigMgr->GetIntDefault("MovementRelay.FarInterval", 1000);
     m_int_configs[CONFIG_INTERVAL_SAVE] = sConfigMgr->GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = sConfigMgr->GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = sConfigMgr->GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
@@ -1119,6 +1157,12 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading", "CleanOldMailTime (%u) must be an hour, between 0 and 23. Set to 4.", m_int_configs[CONFIG_CLEAN_OLD_MAIL_TIME]);
         m_int_configs[CONFIG_CLEAN_OLD_MAIL_TIME] = 4;
     }
+    m_int_configs[CONFIG_CLEAN_OLD_MAIL_BATCH_SIZE] = sConfigMgr->GetIntDefault("CleanOldMailBatchSize", 1000);
+    if (m_int_configs[CONFIG_CLEAN_OLD_MAIL_BATCH_SIZE] < 1)
+    {
+        TC_LOG_ERROR("server.loading", "CleanOldMailBatchSize (%u) must be > 0. Set to 1000.", m_int_configs[CONFIG_CLEAN_OLD_MAIL_BATCH_SIZE]);
+        m_int_configs[CONFIG_CLEAN_OLD_MAIL_BATCH_SIZE] = 1000;
+    }
 
     m_int_configs[CONFIG_UPTIME_UPDATE] = sConfigMgr->GetIntDefault("UpdateUptimeInterval", 10);
     if (int32(m_int_configs[CONFIG_UPTIME_UPDATE]) <= 0)
@@ -1237,6 +1281,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_CORPSE_DECAY_ELITE]     = sConfigMgr->GetIntDefault("Corpse.Decay.ELITE", 300);
     m_int_configs[CONFIG_CORPSE_DECAY_RAREELITE] = sConfigMgr->GetIntDefault("Corpse.Decay.RAREELITE", 300);
     m_int_configs[CONFIG_CORPSE_DECAY_WORLDBOSS] = sConfigMgr->GetIntDefault("Corpse.Decay.WORLDBOSS", 3600);
+    m_bool_configs[CONFIG_CORPSE_LAZY_LOOT]      = sConfigMgr->GetBoolDefault("Corpse.LazyLoot", false);
 
     m_int_configs[CONFIG_DEATH_SICKNESS_LEVEL]           = sConfigMgr->GetIntDefault ("Death.SicknessLevel", 11);
     m_bool_configs[CONFIG_DEATH_CORPSE_RECLAIM_DELAY_PVP] = sConfigMgr->GetBoolDefault("Death.CorpseReclaimDelay.PvP", true);
@@ -1262,6 +1307,7 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_PLAYERONLY]   = sConfigMgr->GetBoolDefault("Battleground.QueueAnnouncer.PlayerOnly", false);
     m_bool_configs[CONFIG_BATTLEGROUND_STORE_STATISTICS_ENABLE]      = sConfigMgr->GetBoolDefault("Battleground.StoreStatistics.Enable", false);
     m_bool_configs[CONFIG_BATTLEGROUND_TRACK_DESERTERS]              = sConfigMgr->GetBoolDefault("Battleground.TrackDeserters.Enable", false);
+    m_bool_configs[CONFIG_BATTLEGROUND_UPDATE_IN_MAP_THREADS]        = sConfigMgr->GetBoolDefault("Battleground.UpdateInMapThreads", false);
     m_int_configs[CONFIG_BATTLEGROUND_REPORT_AFK]                    = sConfigMgr->GetIntDefault("Battleground.ReportAFK", 3);
     if (m_int_configs[CONFIG_BATTLEGROUND_REPORT_AFK] < 1)
     {
@@ -1471,17 +1517,28 @@ void World::LoadConfigSettings(bool reload)
 
     m_bool_configs[CONFIG_ENABLE_MMAPS] = sConfigMgr->GetBoolDefault("mmap.enablePathFinding", true);
     TC_LOG_INFO("server.loading", "WORLD: MMap data directory is: %smmaps", m_dataPath.c_str());
+    m_int_configs[CONFIG_MMAP_PATH_CACHE_LIFETIME] = sConfigMgr->GetIntDefault("mmap.pathCacheLifetime", 0);
+    m_int_configs[CONFIG_MMAP_ASYNC_PATH_THREADS] = sConfigMgr->GetIntDefault("mmap.asyncPathThreads", 0);
+    m_int_configs[CONFIG_MMAP_ASYNC_PATH_MAX_REQUESTS] = sConfigMgr->GetIntDefault("mmap.asyncPathMaxRequestsPerMap", 64);
+    m_float_configs[CONFIG_MMAP_PATH_CACHE_TOLERANCE] = sConfigMgr->GetFloatDefault("mmap.pathCacheTolerance", 2.0f);
+    if (m_float_configs[CONFIG_MMAP_PATH_CACHE_TOLERANCE] < 0.0f)
+    {
+        TC_LOG_ERROR("server.loading", "mmap.pathCacheTolerance (%f) must be positive. Set to 2.", m_float_configs[CONFIG_MMAP_PATH_CACHE_TOLERANCE]);
+        m_float_configs[CONFIG_MMAP_PATH_CACHE_TOLERANCE] = 2.0f;
+    }
 
     m_bool_configs[CONFIG_VMAP_INDOOR_CHECK] = sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", 0);
     bool enableIndoor = sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", true);
     bool enableLOS = sConfigMgr->GetBoolDefault("vmap.enableLOS", true);
     bool enableHeight = sConfigMgr->GetBoolDefault("vmap.enableHeight", true);
+    bool enableTriangleCache = sConfigMgr->GetBoolDefault("vmap.precomputeTriangles", false);
 
     if (!enableHeight)
         TC_LOG_ERROR("server.loading", "VMap height checking disabled! Creatures movements and other various things WILL be broken! Expect no support.");
 
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableLineOfSightCalc(enableLOS);
     VMAP::VMapFactory::createOrGetVMapManager()->setEnableHeightCalc(enableHeight);
+    VMAP::VMapFactory::createOrGetVMapManager()->setEnableTriangleCache(enableTriangleCache);
     TC_LOG_INFO("server.loading", "VMap support included. LineOfSight: %i, getHeight: %i, indoorCheck: %i", enableLOS, enableHeight, enableIndoor);
     TC_LOG_INFO("server.loading", "VMap data directory is: %svmaps", m_dataPath.c_str());
 
@@ -1566,6 +1623,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_GUILD_REPUTATION_QUEST_DIVIDER] = sConfigMgr->GetIntDefault("Guild.ReputationQuestDivider", 450);
     m_int_configs[CONFIG_GUILD_DAILY_XP_CAP] = sConfigMgr->GetIntDefault("Guild.DailyXPCap", 7807500);
     m_int_configs[CONFIG_GUILD_WEEKLY_REP_CAP] = sConfigMgr->GetIntDefault("Guild.WeeklyReputationCap", 4375);
+    m_int_configs[CONFIG_GUILD_ROSTER_CACHE_TIME] = sConfigMgr->GetIntDefault("Guild.RosterCacheTime", 30);
 
     // misc
     m_bool_configs[CONFIG_PDUMP_NO_PATHS] = sConfigMgr->GetBoolDefault("PlayerDump.DisallowPaths", true);
@@ -3656,6 +3714,7 @@ void World::LoadPersistentWorldVariables()
 void World::ProcessQueryCallbacks()
 {
     _queryProcessor.ProcessReadyCallbacks();
+    sObjectMgr->ProcessQueryCallbacks();
 }
 
 void World::ReloadRBAC()
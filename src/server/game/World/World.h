@@ -134,6 +134,7 @@ enum WorldBoolConfigs : uint8
     CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_PLAYERONLY,
     CONFIG_BATTLEGROUND_STORE_STATISTICS_ENABLE,
     CONFIG_BATTLEGROUND_TRACK_DESERTERS,
+    CONFIG_BATTLEGROUND_UPDATE_IN_MAP_THREADS,
     CONFIG_BG_XP_FOR_KILL,
     CONFIG_ARENA_QUEUE_ANNOUNCER_ENABLE,
     CONFIG_ARENA_SEASON_IN_PROGRESS,
@@ -186,6 +187,11 @@ enum WorldBoolConfigs : uint8
     CONFIG_CHECK_GOBJECT_LOS,
     CONFIG_RESPAWN_DYNAMIC_ESCORTNPC,
     CONFIG_CACHE_DATA_QUERIES,
+    CONFIG_GRID_PREFETCH_OBJECTS,
+    CONFIG_SPATIAL_INDEX_UNITS,
+    CONFIG_COMBAT_LOG_BATCHING,
+    CONFIG_MOVEMENT_RELAY,
+    CONFIG_CORPSE_LAZY_LOOT,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -211,6 +217,9 @@ enum WorldFloatConfigs : uint8
     CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER,
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT,
+    CONFIG_MMAP_PATH_CACHE_TOLERANCE,
+    CONFIG_GRID_PREFETCH_DISTANCE,
+    CONFIG_MOVEMENT_RELAY_NEAR_DISTANCE,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -281,6 +290,7 @@ enum WorldIntConfigs : uint8
     CONFIG_GROUP_VISIBILITY,
     CONFIG_MAIL_DELIVERY_DELAY,
     CONFIG_CLEAN_OLD_MAIL_TIME,
+    CONFIG_CLEAN_OLD_MAIL_BATCH_SIZE,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
     CONFIG_SKILL_CHANCE_YELLOW,
@@ -387,6 +397,7 @@ enum WorldIntConfigs : uint8
     CONFIG_GUILD_WEEKLY_REP_CAP,
     CONFIG_GUILD_XP_REWARD_ARENA,
     CONFIG_GUILD_REPUTATION_QUEST_DIVIDER,
+    CONFIG_GUILD_ROSTER_CACHE_TIME,
     CONFIG_PACKET_SPOOF_POLICY,
     CONFIG_PACKET_SPOOF_BANMODE,
     CONFIG_PACKET_SPOOF_BANDURATION,
@@ -419,6 +430,16 @@ enum WorldIntConfigs : uint8
     CONFIG_RESPAWN_GUIDWARNING_FREQUENCY,
     CONFIG_RATED_BATTLEGROUND_ENABLE,
     CONFIG_PENDING_MOVE_CHANGES_TIMEOUT,
+    CONFIG_MMAP_PATH_CACHE_LIFETIME,
+    CONFIG_MMAP_ASYNC_PATH_THREADS,
+    CONFIG_MMAP_ASYNC_PATH_MAX_REQUESTS,
+    CONFIG_GRID_PREFETCH_THREADS,
+    CONFIG_GRID_PREFETCH_OBJECTS_BUDGET,
+    CONFIG_COMPRESSION_THRESHOLD,
+    CONFIG_COMPRESSION_LARGE_PACKET_SIZE,
+    CONFIG_COMPRESSION_LARGE_PACKET_LEVEL,
+    CONFIG_COMPRESSION_MAX_RATIO,
+    CONFIG_MOVEMENT_RELAY_FAR_INTERVAL,
     INT_CONFIG_VALUE_COUNT
 };
 
@@ -967,21 +967,22 @@ public:
         // _multiSchoolModifiers
         {
             auto& mods = mgr._multiSchoolModifiers;
-            handler->PSendSysMessage("- Multi-school threat modifiers (%zu entries):", mods.size());
-            for (auto const& pair : mods)
-                handler->PSendSysMessage(" |-- Mask 0x%x: %.2f%%", uint32(pair.first), pair.second);
+            handler->PSendSysMessage("- Multi-school threat modifiers (%u entries):", mgr._multiSchoolModifierCount);
+            for (uint32 i = 0; i < mgr._multiSchoolModifierCount; ++i)
+                handler->PSendSysMessage(" |-- Mask 0x%x: %.2f%%", mods[i].first, mods[i].second);
         }
 
         // _redirectInfo
         {
             auto const& redirectInfo = mgr._redirectInfo;
-            if (redirectInfo.empty())
+            if (!mgr._redirectInfoCount)
                 handler->SendSysMessage(" - No redirects being applied");
             else
             {
-                handler->PSendSysMessage(" - %02zu redirects being applied:", redirectInfo.size());
-                for (auto const& pair : redirectInfo)
+                handler->PSendSysMessage(" - %02u redirects being applied:", mgr._redirectInfoCount);
+                for (uint32 i = 0; i < mgr._redirectInfoCount; ++i)
                 {
+                    auto const& pair = redirectInfo[i];
                     Unit* unit = ObjectAccessor::GetUnit(*target, pair.first);
                     handler->PSendSysMessage(" |-- %02u%% to %s", pair.second, unit ? unit->GetName().c_str() : pair.first.ToString().c_str());
                 }
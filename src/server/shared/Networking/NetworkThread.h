@@ -23,7 +23,9 @@
 #include "Errors.h"
 #include "IoContext.h"
 #include "Log.h"
+#include "MPSCQueue.h"
 #include "Timer.h"
+#include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <atomic>
 #include <chrono>
@@ -31,16 +33,26 @@
 #include <mutex>
 #include <set>
 #include <thread>
+#include <unordered_set>
 
 using boost::asio::ip::tcp;
 
 template<class SocketType>
 class NetworkThread
 {
+    // Sockets keep a reference to this after the thread is gone (sessions hold them until logout)
+    struct UpdateRequestTarget
+    {
+        std::mutex Lock;
+        NetworkThread* Thread = nullptr;
+    };
+
 public:
     NetworkThread() : _connections(0), _stopped(false), _thread(nullptr), _ioContext(1),
-        _acceptSocket(_ioContext), _updateTimer(_ioContext)
+        _acceptSocket(_ioContext), _updateTimer(_ioContext), _updateTimerArmed(false), _wakeupPending(false),
+        _updateRequestTarget(std::make_shared<UpdateRequestTarget>())
     {
+        _updateRequestTarget->Thread = this;
     }
 
     virtual ~NetworkThread()
@@ -51,6 +63,8 @@ public:
             Wait();
             delete _thread;
         }
+
+        DetachSockets();
     }
 
     void Stop()
@@ -82,13 +96,32 @@ public:
         return _connections;
     }
 
+    // Must be called before the socket is started, its handlers may request updates from then on
+    void PrepareSocket(std::shared_ptr<SocketType> const& sock)
+    {
+        sock->SetUpdateRequestHandler([target = _updateRequestTarget, weakSock = std::weak_ptr<SocketType>(sock)]()
+        {
+            std::shared_ptr<SocketType> sock = weakSock.lock();
+            if (!sock)
+                return;
+
+            std::lock_guard<std::mutex> lock(target->Lock);
+            if (target->Thread)
+                target->Thread->QueueReadySocket(std::move(sock));
+        });
+    }
+
     virtual void AddSocket(std::shared_ptr<SocketType> sock)
     {
-        std::lock_guard<std::mutex> lock(_newSocketsLock);
+        {
+            std::lock_guard<std::mutex> lock(_newSocketsLock);
+
+            ++_connections;
+            _newSockets.push_back(sock);
+            SocketAdded(sock);
+        }
 
-        ++_connections;
-        _newSockets.push_back(sock);
-        SocketAdded(sock);
+        Wakeup();
     }
 
     tcp::socket* GetSocketForAccept() { return &_acceptSocket; }
@@ -112,7 +145,10 @@ protected:
                 --_connections;
             }
             else
-                _sockets.push_back(sock);
+            {
+                _sockets.insert(sock);
+                UpdateSocket(sock);
+            }
         }
 
         _newSockets.clear();
@@ -122,44 +158,112 @@ protected:
     {
         TC_LOG_DEBUG("misc", "Network Thread Starting");
 
-        _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
-        _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
+        // the context has no pending operation while all sockets are idle
+        auto work = boost::asio::make_work_guard(_ioContext.get_executor());
+
+        Wakeup();
         _ioContext.run();
 
         TC_LOG_DEBUG("misc", "Network Thread exits");
+        DetachSockets();
         _newSockets.clear();
+        _pollSockets.clear();
         _sockets.clear();
     }
 
+    // sockets signal this thread when they have output queued or got closed instead of being polled
+    void QueueReadySocket(std::shared_ptr<SocketType> sock)
+    {
+        _readySockets.Enqueue(new std::shared_ptr<SocketType>(std::move(sock)));
+        Wakeup();
+    }
+
+    void Wakeup()
+    {
+        if (!_wakeupPending.exchange(true))
+            Trinity::Asio::post(_ioContext, [this]() { ProcessReadySockets(); });
+    }
+
+    void ProcessReadySockets()
+    {
+        _wakeupPending = false;
+
+        if (_stopped)
+            return;
+
+        AddNewSockets();
+
+        std::shared_ptr<SocketType>* queued;
+        while (_readySockets.Dequeue(queued))
+        {
+            std::shared_ptr<SocketType> sock = std::move(*queued);
+            delete queued;
+
+            if (_sockets.count(sock))
+                UpdateSocket(sock);
+        }
+
+        ScheduleUpdateTimer();
+    }
+
+    // sockets waiting for async callbacks cannot signal, those are still updated every millisecond
     void Update()
     {
+        _updateTimerArmed = false;
+
         if (_stopped)
             return;
 
+        AddNewSockets();
+
+        std::vector<std::shared_ptr<SocketType>> pollSockets(_pollSockets.begin(), _pollSockets.end());
+        for (std::shared_ptr<SocketType> const& sock : pollSockets)
+            if (_sockets.count(sock))
+                UpdateSocket(sock);
+
+        ScheduleUpdateTimer();
+    }
+
+    void ScheduleUpdateTimer()
+    {
+        if (_updateTimerArmed || _pollSockets.empty())
+            return;
+
+        _updateTimerArmed = true;
         _updateTimer.expires_from_now(boost::posix_time::milliseconds(1));
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
+    }
 
-        AddNewSockets();
-
-        _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> sock)
+    void UpdateSocket(std::shared_ptr<SocketType> const& sock)
+    {
+        sock->ClearUpdateRequest();
+        if (!sock->Update())
         {
-            if (!sock->Update())
-            {
-                if (sock->IsOpen())
-                    sock->CloseSocket();
+            if (sock->IsOpen())
+                sock->CloseSocket();
 
-                this->SocketRemoved(sock);
+            this->SocketRemoved(sock);
 
-                --this->_connections;
-                return true;
-            }
+            --this->_connections;
+            _pollSockets.erase(sock);
+            _sockets.erase(sock);
+            return;
+        }
 
-            return false;
-        }), _sockets.end());
+        if (sock->HasPendingCallbacks())
+            _pollSockets.insert(sock);
+        else
+            _pollSockets.erase(sock);
+    }
+
+    void DetachSockets()
+    {
+        std::lock_guard<std::mutex> lock(_updateRequestTarget->Lock);
+        _updateRequestTarget->Thread = nullptr;
     }
 
 private:
-    typedef std::vector<std::shared_ptr<SocketType>> SocketContainer;
+    typedef std::unordered_set<std::shared_ptr<SocketType>> SocketContainer;
 
     std::atomic<int32> _connections;
     std::atomic<bool> _stopped;
@@ -167,13 +271,19 @@ private:
     std::thread* _thread;
 
     SocketContainer _sockets;
+    SocketContainer _pollSockets;
 
     std::mutex _newSocketsLock;
-    SocketContainer _newSockets;
+    std::vector<std::shared_ptr<SocketType>> _newSockets;
 
     Trinity::Asio::IoContext _ioContext;
     tcp::socket _acceptSocket;
     Trinity::Asio::DeadlineTimer _updateTimer;
+    bool _updateTimerArmed;
+
+    MPSCQueue<std::shared_ptr<SocketType>> _readySockets;
+    std::atomic<bool> _wakeupPending;
+    std::shared_ptr<UpdateRequestTarget> _updateRequestTarget;
 };
 
 #endif // NetworkThread_h__
@@ -21,15 +21,18 @@
 #include "MessageBuffer.h"
 #include "Log.h"
 #include <atomic>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <functional>
 #include <type_traits>
+#include <vector>
 #include <boost/asio/ip/tcp.hpp>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// maximum number of queued buffers passed to a single gather write
+#define WRITE_GATHER_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
 #endif
@@ -39,9 +42,11 @@ class Socket : public std::enable_shared_from_this<T>
 {
 public:
     explicit Socket(tcp::socket&& socket) : _socket(std::move(socket)), _remoteAddress(_socket.remote_endpoint().address()),
-        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _isWritingAsync(false)
+        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _closed(false), _closing(false), _isWritingAsync(false),
+        _updateRequested(false)
     {
         _readBuffer.Resize(READ_BLOCK_SIZE);
+        _writeBuffers.reserve(WRITE_GATHER_BUFFERS);
     }
 
     virtual ~Socket()
@@ -69,6 +74,22 @@ public:
         return true;
     }
 
+    /// Sockets that must be updated without being signaled (waiting for async callbacks)
+    virtual bool HasPendingCallbacks() const { return false; }
+
+    /// Set by the owning NetworkThread before the socket is started, never changed afterwards
+    void SetUpdateRequestHandler(std::function<void()> handler) { _updateRequestHandler = std::move(handler); }
+
+    /// Schedules an Update on the network thread, safe to call from any thread
+    void RequestUpdate()
+    {
+        if (!_updateRequested.exchange(true) && _updateRequestHandler)
+            _updateRequestHandler();
+    }
+
+    /// Called by the network thread right before Update
+    void ClearUpdateRequest() { _updateRequested = false; }
+
     boost::asio::ip::address GetRemoteIpAddress() const
     {
         return _remoteAddress;
@@ -103,10 +124,12 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
+#else
+        RequestUpdate();
 #endif
     }
 
@@ -124,10 +147,15 @@ public:
                 shutdownError.value(), shutdownError.message().c_str());
 
         OnClose();
+        RequestUpdate();
     }
 
     /// Marks the socket for closing after write buffer becomes empty
-    void DelayedCloseSocket() { _closing = true; }
+    void DelayedCloseSocket()
+    {
+        _closing = true;
+        RequestUpdate();
+    }
 
     MessageBuffer& GetReadBuffer() { return _readBuffer; }
 
@@ -186,7 +214,7 @@ private:
             _isWritingAsync = false;
             _writeQueue.front().ReadCompleted(transferedBytes);
             if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+                _writeQueue.pop_front();
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -202,7 +230,8 @@ private:
     void WriteHandlerWrapper(boost::system::error_code /*error*/, std::size_t /*transferedBytes*/)
     {
         _isWritingAsync = false;
-        HandleQueue();
+        for (; HandleQueue();)
+            ;
     }
 
     bool HandleQueue()
@@ -210,37 +239,54 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        // gather queued buffers into a single write call
+        std::size_t bytesToSend = 0;
+        _writeBuffers.clear();
+        for (auto itr = _writeQueue.begin(); itr != _writeQueue.end() && _writeBuffers.size() < WRITE_GATHER_BUFFERS; ++itr)
+        {
+            _writeBuffers.push_back(boost::asio::buffer(itr->GetReadPointer(), itr->GetActiveSize()));
+            bytesToSend += itr->GetActiveSize();
+        }
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBuffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
+
+        bool partialWrite = bytesSent < bytesToSend;
+        while (bytesSent > 0)
         {
-            queuedMessage.ReadCompleted(bytesSent);
-            return AsyncProcessQueue();
+            MessageBuffer& queuedMessage = _writeQueue.front();
+            std::size_t messageSize = queuedMessage.GetActiveSize();
+            if (bytesSent < messageSize)
+            {
+                queuedMessage.ReadCompleted(bytesSent);
+                break;
+            }
+
+            bytesSent -= messageSize;
+            _writeQueue.pop_front();
         }
 
-        _writeQueue.pop();
+        if (partialWrite) // now n > 0
+            return AsyncProcessQueue();
+
         if (_closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -254,12 +300,16 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBuffers;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
 
     bool _isWritingAsync;
+
+    std::atomic<bool> _updateRequested;
+    std::function<void()> _updateRequestHandler;
 };
 
 #endif // __SOCKET_H__
@@ -103,6 +103,7 @@ public:
         try
         {
             std::shared_ptr<SocketType> newSocket = std::make_shared<SocketType>(std::move(sock));
+            _threads[threadIndex].PrepareSocket(newSocket);
             newSocket->Start();
 
             _threads[threadIndex].AddSocket(newSocket);
@@ -27,19 +27,27 @@
 #include "BattlenetServerManager.h"
 #include "BigNumber.h"
 #include "CliRunnable.h"
+#include "CombatLogQueue.h"
 #include "Configuration/Config.h"
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "DeadlineTimer.h"
 #include "GitRevision.h"
+#include "GridPrefetcher.h"
+#include "Guild.h"
 #include "InstanceSaveMgr.h"
 #include "IoContext.h"
+#include "Loot.h"
 #include "MapManager.h"
 #include "Metric.h"
+#include "MovementRelay.h"
 #include "MySQLThreading.h"
 #include "ObjectAccessor.h"
+#include "ObjectMgr.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvP/OutdoorPvPMgr.h"
+#include "PacketCompressor.h"
+#include "PathCache.h"
 #include "ProcessPriority.h"
 #include "RASession.h"
 #include "Resolver.h"
@@ -284,6 +292,48 @@ extern int main(int argc, char** argv)
         TC_METRIC_VALUE("db_queue_character", CharacterDatabase.QueueSize());
         TC_METRIC_VALUE("db_queue_world", WorldDatabase.QueueSize());
         TC_METRIC_VALUE("db_queue_hotfix", HotfixDatabase.QueueSize());
+
+        PathCache::Statistics const& pathStatistics = PathCache::GetStatistics();
+        TC_METRIC_VALUE("mmap_paths_calculated", pathStatistics.PathsCalculated.load());
+        TC_METRIC_VALUE("mmap_path_time_us", pathStatistics.PathTimeMicroseconds.load());
+        TC_METRIC_VALUE("mmap_path_cache_hits", pathStatistics.CacheHits.load());
+        TC_METRIC_VALUE("mmap_path_cache_misses", pathStatistics.CacheMisses.load());
+
+        PacketCompressor::ReportStatistics();
+
+        GridPrefetcher::Statistics const& gridStatistics = GridPrefetcher::GetStatistics();
+        TC_METRIC_VALUE("grids_loaded", gridStatistics.GridsLoaded.load());
+        TC_METRIC_VALUE("grid_load_time_us", gridStatistics.GridLoadTimeMicroseconds.load());
+        TC_METRIC_VALUE("grid_terrain_prefetches", gridStatistics.TerrainPrefetches.load());
+        TC_METRIC_VALUE("grid_terrain_prefetch_hits", gridStatistics.TerrainPrefetchHits.load());
+        TC_METRIC_VALUE("grid_object_prefetches", gridStatistics.ObjectPrefetches.load());
+
+        CombatLogQueue::Statistics const& combatLogStatistics = CombatLogQueue::GetStatistics();
+        TC_METRIC_VALUE("combat_log_events_queued", combatLogStatistics.QueuedEvents.load());
+        TC_METRIC_VALUE("combat_log_packets_sent", combatLogStatistics.PacketsSent.load());
+        TC_METRIC_VALUE("combat_log_packets_saved", combatLogStatistics.PacketsSaved.load());
+        TC_METRIC_VALUE("combat_log_bytes_saved", combatLogStatistics.BytesSaved.load());
+
+        MovementRelay::Statistics const& movementRelayStatistics = MovementRelay::GetStatistics();
+        TC_METRIC_VALUE("movement_heartbeats_queued", movementRelayStatistics.QueuedHeartbeats.load());
+        TC_METRIC_VALUE("movement_relay_packets_sent", movementRelayStatistics.PacketsSent.load());
+        TC_METRIC_VALUE("movement_relay_packets_saved", movementRelayStatistics.PacketsSaved.load());
+        TC_METRIC_VALUE("movement_relay_bytes_saved", movementRelayStatistics.BytesSaved.load());
+
+        ObjectMgr::ExpiredMailStatistics const& expiredMailStatistics = sObjectMgr->GetExpiredMailStatistics();
+        TC_METRIC_VALUE("expired_mail_batches", expiredMailStatistics.Batches.load());
+        TC_METRIC_VALUE("expired_mail_deleted", expiredMailStatistics.Deleted.load());
+        TC_METRIC_VALUE("expired_mail_returned", expiredMailStatistics.Returned.load());
+        TC_METRIC_VALUE("expired_mail_skipped", expiredMailStatistics.Skipped.load());
+
+        Loot::LazyLootStatistics const& lazyLootStatistics = Loot::GetLazyLootStatistics();
+        TC_METRIC_VALUE("lazy_loot_deferred", lazyLootStatistics.Deferred.load());
+        TC_METRIC_VALUE("lazy_loot_materialized", lazyLootStatistics.Materialized.load());
+        TC_METRIC_VALUE("lazy_loot_never_opened", lazyLootStatistics.NeverOpened.load());
+
+        Guild::RosterCacheStatistics const& guildRosterStatistics = Guild::GetRosterCacheStatistics();
+        TC_METRIC_VALUE("guild_roster_cache_hits", guildRosterStatistics.Hits.load());
+        TC_METRIC_VALUE("guild_roster_cache_misses", guildRosterStatistics.Misses.load());
     });
 
     TC_METRIC_EVENT("events", "Worldserver started", "");
@@ -0,0 +1,110 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch2/catch.hpp"
+#include "ARC4.h"
+#include "OpenSSLCrypto.h"
+#include <array>
+#include <vector>
+
+namespace
+{
+    struct OpenSSLProviders
+    {
+        OpenSSLProviders() { OpenSSLCrypto::threadsSetup(boost::filesystem::path()); }
+        ~OpenSSLProviders() { OpenSSLCrypto::threadsCleanup(); }
+    };
+}
+
+TEST_CASE("ARC4 matches the reference keystream", "[ARC4]")
+{
+    OpenSSLProviders providers;
+
+    uint8 key[] = { 'K', 'e', 'y' };
+    uint8 data[] = { 'P', 'l', 'a', 'i', 'n', 't', 'e', 'x', 't' };
+    uint8 const expected[] = { 0xBB, 0xF3, 0x16, 0xE8, 0xD9, 0x40, 0xAF, 0x0A, 0xD3 };
+
+    ARC4 arc4(key, sizeof(key));
+    arc4.UpdateData(sizeof(data), data);
+
+    REQUIRE(std::equal(std::begin(data), std::end(data), std::begin(expected)));
+}
+
+TEST_CASE("ARC4 output does not depend on how data is split", "[ARC4]")
+{
+    OpenSSLProviders providers;
+
+    uint8 seed[20] = { 0xCC, 0x98, 0xAE, 0x04, 0xE8, 0x97, 0xEA, 0xCA, 0x12, 0xDD, 0xC0, 0x93, 0x42, 0x91, 0x53, 0x57, 0x01, 0x02, 0x03, 0x04 };
+
+    // spans several keystream blocks with chunk boundaries that do not line up with them
+    std::vector<uint8> whole(ARC4::KeystreamBlockSize * 3 + 17);
+    for (std::size_t i = 0; i < whole.size(); ++i)
+        whole[i] = uint8(i * 7);
+    std::vector<uint8> split = whole;
+
+    ARC4 single(seed, sizeof(seed));
+    single.UpdateData(int(whole.size()), whole.data());
+
+    ARC4 chunked(seed, sizeof(seed));
+    for (std::size_t offset = 0; offset < split.size(); offset += 5)
+        chunked.UpdateData(int(std::min<std::size_t>(5, split.size() - offset)), split.data() + offset);
+
+    REQUIRE(whole == split);
+}
+
+TEST_CASE("ARC4 restarts the keystream on Init", "[ARC4]")
+{
+    OpenSSLProviders providers;
+
+    uint8 seed[20] = { };
+    std::array<uint8, 16> first = { };
+    std::array<uint8, 16> second = { };
+
+    ARC4 arc4(sizeof(seed));
+    arc4.Init(seed);
+    arc4.UpdateData(int(first.size()), first.data());
+    arc4.Init(seed);
+    arc4.UpdateData(int(second.size()), second.data());
+
+    REQUIRE(first == second);
+}
+
+// Run with: tests-common "[benchmark]"
+// divide by the header count of a flush to get headers per second on one core
+TEST_CASE("ARC4 packet header encryption", "[.][benchmark]")
+{
+    OpenSSLProviders providers;
+
+    uint8 seed[20] = { };
+    ARC4 arc4(seed, sizeof(seed));
+
+    // a flush of small movement packets, 4 byte headers each
+    std::array<uint8, 64 * 4> headers = { };
+
+    BENCHMARK("encrypt 64 headers in one call")
+    {
+        arc4.UpdateData(int(headers.size()), headers.data());
+        return headers[0];
+    };
+
+    BENCHMARK("encrypt 64 headers one by one")
+    {
+        for (std::size_t i = 0; i < headers.size(); i += 4)
+            arc4.UpdateData(4, headers.data() + i);
+        return headers[0];
+    };
+}
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch2/catch.hpp"
+#include "AliasTable.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // probability of every index, integrated over all columns and a fine grid of rolls
+    std::vector<double> GetPickProbabilities(Trinity::AliasTable const& table)
+    {
+        constexpr uint32 RollSteps = 100000;
+        std::vector<double> probabilities(table.GetSize(), 0.0);
+        for (uint32 column = 0; column < table.GetSize(); ++column)
+            for (uint32 step = 0; step < RollSteps; ++step)
+                probabilities[table.Pick(column, (step + 0.5) / RollSteps)] += 1.0 / (RollSteps * table.GetSize());
+        return probabilities;
+    }
+
+    // loot group roll before the alias table: each chance takes its share of a 0..100 roll in order, the rest drops nothing
+    std::size_t CumulativeRoll(std::vector<double> const& chances, double roll)
+    {
+        for (std::size_t i = 0; i < chances.size(); ++i)
+        {
+            roll -= chances[i];
+            if (roll < 0)
+                return i;
+        }
+        return chances.size();
+    }
+}
+
+TEST_CASE("AliasTable picks every index with the probability of its weight", "[AliasTable]")
+{
+    std::vector<double> weights = { 25.0, 10.0, 0.5, 0.0, 40.0, 24.5 };
+    Trinity::AliasTable table;
+    table.Build(weights);
+    REQUIRE(table.GetSize() == weights.size());
+
+    std::vector<double> probabilities = GetPickProbabilities(table);
+    for (std::size_t i = 0; i < weights.size(); ++i)
+        REQUIRE(probabilities[i] == Approx(weights[i] / 100.0).margin(1e-4));
+
+    for (uint32 column = 0; column < table.GetSize(); ++column)
+        for (double roll : { 0.0, 0.25, 0.5, 0.75, 0.999999 })
+            REQUIRE(table.Pick(column, roll) != 3);
+}
+
+TEST_CASE("AliasTable weights are relative", "[AliasTable]")
+{
+    Trinity::AliasTable table;
+    table.Build({ 1.0, 3.0 });
+    std::vector<double> probabilities = GetPickProbabilities(table);
+    REQUIRE(probabilities[0] == Approx(0.25).margin(1e-4));
+    REQUIRE(probabilities[1] == Approx(0.75).margin(1e-4));
+
+    table.Build({ 0.0, 0.0, 0.0 });
+    probabilities = GetPickProbabilities(table);
+    for (double probability : probabilities)
+        REQUIRE(probability == Approx(1.0 / 3.0).margin(1e-4));
+
+    table.Build({ 7.0 });
+    REQUIRE(table.Pick(0, 0.999999) == 0);
+
+    table.Build({ });
+    REQUIRE(table.IsEmpty());
+}
+
+TEST_CASE("AliasTable matches the cumulative loot roll", "[AliasTable]")
+{
+    // explicit chances of a loot group, the last index is the chance to get nothing
+    std::vector<double> chances = { 33.3, 12.0, 0.1, 5.0, 20.0, 1.5 };
+    std::vector<double> weights = chances;
+    double left = 100.0;
+    for (double chance : chances)
+        left -= chance;
+    weights.push_back(left);
+
+    Trinity::AliasTable table;
+    table.Build(weights);
+
+    constexpr uint32 Samples = 500000;
+    std::mt19937 rng(4711);
+    std::uniform_int_distribution<uint32> columnDist(0, table.GetSize() - 1);
+    std::uniform_real_distribution<double> normDist(0.0, 1.0);
+    std::uniform_real_distribution<double> chanceDist(0.0, 100.0);
+
+    std::vector<uint32> aliasCounts(weights.size(), 0), cumulativeCounts(weights.size(), 0);
+    for (uint32 i = 0; i < Samples; ++i)
+    {
+        uint32 column = columnDist(rng);
+        ++aliasCounts[table.Pick(column, normDist(rng))];
+        ++cumulativeCounts[CumulativeRoll(chances, chanceDist(rng))];
+    }
+
+    // chi-square test of both samples coming from the same distribution
+    double chiSquare = 0.0;
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        double total = aliasCounts[i] + cumulativeCounts[i];
+        if (total == 0.0)
+            continue;
+
+        double expected = total / 2.0;
+        chiSquare += (aliasCounts[i] - expected) * (aliasCounts[i] - expected) / expected;
+        chiSquare += (cumulativeCounts[i] - expected) * (cumulativeCounts[i] - expected) / expected;
+    }
+
+    // critical value for 6 degrees of freedom at p = 0.001
+    REQUIRE(chiSquare < 22.458);
+
+    // and each of them against the configured chances
+    for (std::size_t i = 0; i < weights.size(); ++i)
+    {
+        double expected = weights[i] / 100.0 * Samples;
+        double margin = 5.0 * std::sqrt(expected) + 1.0;
+        REQUIRE(std::abs(aliasCounts[i] - expected) < margin);
+        REQUIRE(std::abs(cumulativeCounts[i] - expected) < margin);
+    }
+}
@@ -0,0 +1,181 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch2/catch.hpp"
+#include "FlatSlotTable.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    struct TestEntry
+    {
+        uint32 Key = 0;
+        std::string Value;
+    };
+
+    typedef Trinity::FlatSlotTable<TestEntry, 4> TestTable;
+
+    // index keyed by TestEntry::Key, hash is given explicitly so that collisions can be forced
+    struct TestIndex
+    {
+        explicit TestIndex(TestTable const& table) : Table(table) { }
+
+        uint32 Find(uint32 hash, uint32 key) const { return Index.Find(hash, [&](uint32 slot) { return Table[slot].Key == key; }); }
+        bool Erase(uint32 hash, uint32 slot) { return Index.Erase(hash, [slot](uint32 other) { return other == slot; }); }
+
+        TestTable const& Table;
+        Trinity::SlotHashIndex Index;
+    };
+
+    uint32 Add(TestTable& table, uint32 key, std::string const& value)
+    {
+        uint32 slot = table.Allocate();
+        table[slot].Key = key;
+        table[slot].Value = value;
+        return slot;
+    }
+}
+
+TEST_CASE("FlatSlotTable keeps entries in place and reuses freed slots", "[FlatSlotTable]")
+{
+    TestTable table;
+    uint32 first = Add(table, 1, "first");
+    TestEntry const* firstEntry = &table[first];
+
+    std::vector<uint32> slots;
+    for (uint32 i = 0; i < 10; ++i)
+        slots.push_back(Add(table, i + 2, "other"));
+
+    REQUIRE(&table[first] == firstEntry);
+    REQUIRE(table[first].Value == "first");
+    REQUIRE(table.GetSize() == 11);
+    REQUIRE(table.GetSlotCount() == 11);
+
+    table.Free(slots[3]);
+    REQUIRE(table[slots[3]].Value.empty());
+    REQUIRE(table.GetSize() == 10);
+
+    REQUIRE(table.Allocate() == slots[3]);
+    REQUIRE(table.GetSize() == 11);
+    REQUIRE(table.GetSlotCount() == 11);
+}
+
+TEST_CASE("SlotHashIndex insert, find and erase", "[FlatSlotTable]")
+{
+    TestTable table;
+    TestIndex index(table);
+
+    REQUIRE(index.Find(1, 1) == Trinity::SlotHashIndex::InvalidSlot);
+
+    std::vector<uint32> slots;
+    for (uint32 key = 0; key < 1000; ++key)
+    {
+        slots.push_back(Add(table, key, std::to_string(key)));
+        index.Index.Insert(key * 2654435761u, slots.back());
+    }
+
+    REQUIRE(index.Index.GetSize() == 1000);
+    for (uint32 key = 0; key < 1000; ++key)
+        REQUIRE(index.Find(key * 2654435761u, key) == slots[key]);
+
+    for (uint32 key = 0; key < 1000; key += 2)
+        REQUIRE(index.Erase(key * 2654435761u, slots[key]));
+
+    REQUIRE(!index.Erase(0, slots[0]));
+    REQUIRE(index.Index.GetSize() == 500);
+    for (uint32 key = 0; key < 1000; ++key)
+        REQUIRE((index.Find(key * 2654435761u, key) != Trinity::SlotHashIndex::InvalidSlot) == (key % 2 == 1));
+}
+
+TEST_CASE("SlotHashIndex keeps colliding keys reachable after erase", "[FlatSlotTable]")
+{
+    TestTable table;
+    TestIndex index(table);
+
+    // every key lands in the same bucket, erasing from the middle of the probe sequence must shift the others back
+    std::vector<uint32> slots;
+    for (uint32 key = 0; key < 20; ++key)
+    {
+        slots.push_back(Add(table, key, std::string()));
+        index.Index.Insert(7, slots.back());
+    }
+
+    REQUIRE(index.Erase(7, slots[5]));
+    REQUIRE(index.Erase(7, slots[0]));
+    for (uint32 key = 0; key < 20; ++key)
+        REQUIRE((index.Find(7, key) == slots[key]) == (key != 5 && key != 0));
+
+    // buckets at the end of the table wrap around to the start
+    Trinity::SlotHashIndex wrapping;
+    wrapping.Insert(63, slots[1]);
+    wrapping.Insert(63, slots[2]);
+    wrapping.Insert(0, slots[3]);
+    REQUIRE(wrapping.Erase(63, [&](uint32 slot) { return slot == slots[1]; }));
+    REQUIRE(wrapping.Find(63, [&](uint32 slot) { return slot == slots[2]; }) == slots[2]);
+    REQUIRE(wrapping.Find(0, [&](uint32 slot) { return slot == slots[3]; }) == slots[3]);
+}
+
+TEST_CASE("SlotHashIndex holds several slots with the same key", "[FlatSlotTable]")
+{
+    TestTable table;
+    TestIndex index(table);
+
+    uint32 first = Add(table, 42, "first");
+    uint32 second = Add(table, 42, "second");
+    index.Index.Insert(42, first);
+    index.Index.Insert(42, second);
+
+    REQUIRE(index.Find(42, 42) == first);
+    REQUIRE(index.Erase(42, first));
+    REQUIRE(index.Find(42, 42) == second);
+    REQUIRE(index.Erase(42, second));
+    REQUIRE(index.Find(42, 42) == Trinity::SlotHashIndex::InvalidSlot);
+}
+
+// Run with: tests-common "[benchmark]"
+TEST_CASE("Character cache sized lookups", "[.][benchmark]")
+{
+    uint32 const count = 100000;
+
+    std::unordered_map<uint32, TestEntry> map;
+    TestTable table;
+    TestIndex index(table);
+    index.Index.Reserve(count);
+    for (uint32 key = 0; key < count; ++key)
+    {
+        map[key] = { key, "name" };
+        index.Index.Insert(key * 2654435761u, Add(table, key, "name"));
+    }
+
+    BENCHMARK("std::unordered_map find")
+    {
+        uint32 found = 0;
+        for (uint32 key = 0; key < count; key += 7)
+            found += map.find(key)->second.Key;
+        return found;
+    };
+
+    BENCHMARK("FlatSlotTable with SlotHashIndex find")
+    {
+        uint32 found = 0;
+        for (uint32 key = 0; key < count; key += 7)
+            found += table[index.Find(key * 2654435761u, key)].Key;
+        return found;
+    };
+}
@@ -0,0 +1,207 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch2/catch.hpp"
+#include "Define.h"
+#include "ThreadLocalPool.h"
+#include <array>
+#include <cstdint>
+#include <boost/container/small_vector.hpp>
+#include <list>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    typedef Trinity::ThreadLocalPool<64, 4> TestPool;
+}
+
+TEST_CASE("ThreadLocalPool reuses freed blocks", "[ThreadLocalPool]")
+{
+    void* first = TestPool::Allocate();
+    std::size_t const freeCount = TestPool::GetFreeCount();
+
+    TestPool::Deallocate(first);
+    REQUIRE(TestPool::GetFreeCount() == freeCount + 1);
+
+    void* second = TestPool::Allocate();
+    REQUIRE(second == first);
+    REQUIRE(TestPool::GetFreeCount() == freeCount);
+
+    TestPool::Deallocate(second);
+}
+
+TEST_CASE("ThreadLocalPool keeps at most MaxFreeBlocks", "[ThreadLocalPool]")
+{
+    std::array<void*, 8> blocks;
+    for (void*& block : blocks)
+        block = TestPool::Allocate();
+
+    for (void* block : blocks)
+        TestPool::Deallocate(block);
+
+    REQUIRE(TestPool::GetFreeCount() == 4);
+}
+
+TEST_CASE("ThreadLocalPool blocks can be freed by another thread", "[ThreadLocalPool]")
+{
+    void* block = TestPool::Allocate();
+    std::size_t const freeCount = TestPool::GetFreeCount();
+
+    std::size_t otherFreeCount = 0;
+    std::thread([&]
+    {
+        TestPool::Deallocate(block);
+        otherFreeCount = TestPool::GetFreeCount();
+    }).join();
+
+    REQUIRE(otherFreeCount == 1);
+    REQUIRE(TestPool::GetFreeCount() == freeCount);
+}
+
+TEST_CASE("ThreadLocalListNodes reuses the nodes of recycled lists", "[ThreadLocalPool]")
+{
+    typedef Trinity::ThreadLocalListNodes<int32, 4> TestNodes;
+
+    std::list<int32> list;
+    for (int32 i = 0; i < 3; ++i)
+        TestNodes::PushBack(list, i);
+
+    int32 const* firstNode = &list.front();
+    TestNodes::Recycle(list);
+    REQUIRE(list.empty());
+    REQUIRE(TestNodes::GetSpareCount() == 3);
+
+    {
+        std::list<int32> other;
+        TestNodes::Recycler recycler(other);
+        TestNodes::Inserter inserter(other);
+        inserter.push_back(7);
+        REQUIRE(&other.front() == firstNode);
+        REQUIRE(other.front() == 7);
+        REQUIRE(TestNodes::GetSpareCount() == 2);
+    }
+
+    REQUIRE(TestNodes::GetSpareCount() == 3);
+
+    // lists that would exceed MaxSpareNodes are freed instead
+    for (int32 i = 0; i < 2; ++i)
+        TestNodes::PushBack(list, i);
+    std::list<int32> large(4, 0);
+    TestNodes::Recycle(large);
+    REQUIRE(large.empty());
+    REQUIRE(TestNodes::GetSpareCount() == 1);
+    TestNodes::Recycle(list);
+}
+
+class WorldObject;
+
+namespace
+{
+    // stand-ins for Spell and Spell::TargetInfo with their x64 sizes, target lists hold WorldObject pointers like the real ones
+    struct SyntheticTargetInfo
+    {
+        std::array<uint8, 100> Data = { };
+        int32 Damage = 0;
+    };
+
+    template<class TargetContainer>
+    struct SyntheticSpell
+    {
+        TargetContainer Targets;
+        std::array<uint8, 1440 - sizeof(TargetContainer)> Data = { };
+    };
+
+    template<class Spell>
+    struct PooledSpell : Spell
+    {
+        static void* operator new(std::size_t) { return Trinity::ThreadLocalPool<sizeof(PooledSpell), 256>::Allocate(); }
+        static void operator delete(void* ptr) { Trinity::ThreadLocalPool<sizeof(PooledSpell), 256>::Deallocate(ptr); }
+    };
+
+    // same node recycling as Spell.cpp target selection
+    typedef Trinity::ThreadLocalListNodes<WorldObject*, 4096> TargetListNodes;
+
+    // an AoE cast hitting 20 targets out of 30 searched and a single target cast, as a busy map update does them
+    template<class Spell, bool RecycleTargetListNodes>
+    int32 CastAoEAndSingleTarget(std::array<WorldObject*, 30> const& candidates)
+    {
+        int32 damage = 0;
+
+        Spell* aoe = new Spell();
+        {
+            std::list<WorldObject*> targets;
+            if constexpr (RecycleTargetListNodes)
+            {
+                TargetListNodes::Recycler recycler(targets);
+                TargetListNodes::Inserter inserter(targets);
+                for (WorldObject* candidate : candidates)
+                    inserter.push_back(candidate);
+            }
+            else
+            {
+                for (WorldObject* candidate : candidates)
+                    targets.push_back(candidate);
+            }
+
+            for (WorldObject* target : targets)
+            {
+                if (aoe->Targets.size() == 20)
+                    break;
+
+                aoe->Targets.emplace_back();
+                aoe->Targets.back().Damage = int32(reinterpret_cast<std::uintptr_t>(target) & 0xFF);
+            }
+        }
+
+        for (SyntheticTargetInfo const& target : aoe->Targets)
+            damage += target.Damage;
+        delete aoe;
+
+        Spell* single = new Spell();
+        single->Targets.emplace_back();
+        single->Targets.back().Damage = int32(reinterpret_cast<std::uintptr_t>(candidates[0]) & 0xFF);
+        damage += single->Targets.back().Damage;
+        delete single;
+
+        return damage;
+    }
+}
+
+// Run with: tests-common "[benchmark]"
+// each run is two casts, double the runs per second to get casts per second on one core
+TEST_CASE("Synthetic AoE casts", "[.][benchmark]")
+{
+    // never dereferenced, only stored in the target lists
+    std::array<uint8, 30> objects = { };
+    std::array<WorldObject*, 30> candidates;
+    for (std::size_t i = 0; i < candidates.size(); ++i)
+        candidates[i] = reinterpret_cast<WorldObject*>(&objects[i]);
+
+    typedef SyntheticSpell<std::vector<SyntheticTargetInfo>> GlobalSpell;
+    typedef PooledSpell<SyntheticSpell<boost::container::small_vector<SyntheticTargetInfo, 4>>> ThreadLocalPoolSpell;
+
+    BENCHMARK("global allocator, new target list nodes per cast")
+    {
+        return CastAoEAndSingleTarget<GlobalSpell, false>(candidates);
+    };
+
+    BENCHMARK("pooled spells, inline targets, recycled target list nodes")
+    {
+        return CastAoEAndSingleTarget<ThreadLocalPoolSpell, true>(candidates);
+    };
+}
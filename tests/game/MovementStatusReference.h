@@ -0,0 +1,43 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef MovementStatusReference_h__
+#define MovementStatusReference_h__
+
+#include "MovementStructures.h"
+
+struct MovementInfo;
+struct Position;
+
+// Element switch implementation Player::ReadMovementInfo and Unit::WriteMovementInfo used
+// before the readers and writers were generated from the sequences, kept as reference
+namespace MovementStatusReference
+{
+    struct WriteState
+    {
+        Position const* UnitPosition = nullptr;
+        ObjectGuid Guid;
+        uint32 MovementCounter = 0;
+        bool HasSpline = false;
+    };
+
+    void Read(ByteBuffer& data, MovementStatusElements const* sequence, MovementInfo& mi, Movement::ExtraMovementStatusElement* extras);
+    void Write(ByteBuffer& data, MovementStatusElements const* sequence, MovementInfo const& mi, WriteState const& state, Movement::ExtraMovementStatusElement* extras);
+}
+
+#endif // MovementStatusReference_h__
@@ -0,0 +1,346 @@
+/*
+ * This file is part of the TrinityCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch2/catch.hpp"
+#include "ByteBuffer.h"
+#include "MovementInfo.h"
+#include "MovementStatusReference.h"
+#include "MovementStructures.h"
+#include "UnitDefines.h"
+#include <G3D/g3dmath.h>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct MovementState
+    {
+        MovementInfo Info;
+        Position UnitPosition;
+        ObjectGuid Guid;
+        uint32 MovementCounter = 0;
+        bool HasSpline = false;
+        ObjectGuid ExtraGuid;
+        float ExtraFloat = 0.0f;
+        int8 ExtraByte = 0;
+    };
+
+    class MovementStateGenerator
+    {
+    public:
+        explicit MovementStateGenerator(uint32 seed) : _rng(seed) { }
+
+        MovementState Next()
+        {
+            MovementState state;
+            MovementInfo& mi = state.Info;
+            mi.flags = Chance() ? (_rng() & 0x3FFFFFFF) : 0;
+            mi.flags2 = Chance() ? (_rng() & 0xFFF) : 0;
+            mi.pos.Relocate(Coord(), Coord(), Coord(), Below(4) ? Angle() : 0.0f);
+            mi.time = _rng();
+            if (Chance())
+            {
+                mi.transport.guid = Guid();
+                mi.transport.pos.Relocate(Coord(), Coord(), Coord(), Angle());
+                mi.transport.seat = int8(Below(256));
+                mi.transport.time = _rng();
+                mi.transport.time2 = Chance() ? _rng() : 0;
+                mi.transport.vehicleId = Chance() ? _rng() : 0;
+            }
+            mi.pitch = float(int32(Below(628)) - 314) / 100.0f;
+            mi.jump.fallTime = Chance() ? _rng() : 0;
+            mi.jump.zspeed = Coord();
+            mi.jump.sinAngle = Coord();
+            mi.jump.cosAngle = Coord();
+            mi.jump.xyspeed = Coord();
+            mi.splineElevation = Coord();
+            mi.heightChangeFailed = Chance();
+            state.UnitPosition = mi.pos;
+            state.HasSpline = Chance();
+            state.Guid = Guid();
+            state.MovementCounter = _rng();
+            state.ExtraGuid = Guid();
+            state.ExtraFloat = Coord();
+            state.ExtraByte = int8(Below(4));
+            return state;
+        }
+
+    private:
+        uint32 Below(uint32 n) { return std::uniform_int_distribution<uint32>(0, n - 1)(_rng); }
+        bool Chance() { return Below(2) != 0; }
+        float Coord() { return std::uniform_real_distribution<float>(-500.0f, 500.0f)(_rng); }
+        float Angle() { return float(Below(628)) / 100.0f; }
+
+        // each guid byte is present or not independently, packed guids depend on it
+        ObjectGuid Guid()
+        {
+            uint64 value = 0;
+            for (uint32 i = 0; i < 8; ++i)
+                if (Chance())
+                    value |= uint64(Below(256)) << (i * 8);
+            return ObjectGuid(value);
+        }
+
+        std::mt19937 _rng;
+    };
+
+    // elements passed by the handlers and senders of opcodes with MSEExtraElement in their sequence
+    std::vector<MovementStatusElements> GetExtraElements(uint32 opcode, MovementStatusElements const* sequence)
+    {
+        switch (opcode)
+        {
+            case SMSG_MOVE_SET_COLLISION_HEIGHT:
+                return { MSEExtraTwoBits, MSEExtraFloat, MSEEnd };
+            case CMSG_MOVE_SET_COLLISION_HEIGHT_ACK:
+                return { MSEExtraFloat, MSEExtraTwoBits, MSEEnd };
+            case CMSG_CHANGE_SEATS_ON_CONTROLLED_VEHICLE:
+                return { MSEExtraInt8, MSEHasGuidByte2, MSEHasGuidByte4, MSEHasGuidByte7, MSEHasGuidByte6, MSEHasGuidByte5, MSEHasGuidByte0, MSEHasGuidByte1,
+                    MSEHasGuidByte3, MSEGuidByte6, MSEGuidByte1, MSEGuidByte2, MSEGuidByte5, MSEGuidByte3, MSEGuidByte0, MSEGuidByte4, MSEGuidByte7, MSEEnd };
+            default:
+                break;
+        }
+
+        std::vector<MovementStatusElements> extraElements;
+        for (; *sequence != MSEEnd; ++sequence)
+            if (*sequence == MSEExtraElement)
+                extraElements.push_back(MSEExtraFloat);
+        extraElements.push_back(MSEEnd);
+        return extraElements;
+    }
+
+    void SetExtraData(Movement::ExtraMovementStatusElement& extras, MovementState const& state)
+    {
+        extras.Data.guid = state.ExtraGuid;
+        extras.Data.floatData = state.ExtraFloat;
+        extras.Data.byteData = state.ExtraByte;
+    }
+
+    // same flag logic as Unit::WriteMovementInfo
+    void WriteGenerated(ByteBuffer& data, Movement::MovementStatusSequence const& sequence, MovementState const& state, Movement::ExtraMovementStatusElement* extras)
+    {
+        MovementInfo const& mi = state.Info;
+        Movement::MovementStatusWriter writer(data, mi, state.UnitPosition, extras);
+        writer.HasMovementFlags = mi.GetMovementFlags() != 0;
+        writer.HasMovementFlags2 = mi.GetExtraMovementFlags() != 0;
+        writer.HasTimestamp = true;
+        writer.HasOrientation = !G3D::fuzzyEq(state.UnitPosition.GetOrientation(), 0.0f);
+        writer.HasTransportData = !mi.transport.guid.IsEmpty();
+        writer.HasSpline = state.HasSpline;
+        writer.HasTransportTime2 = writer.HasTransportData && mi.transport.time2 != 0;
+        writer.HasTransportVehicleId = writer.HasTransportData && mi.transport.vehicleId != 0;
+        writer.HasPitch = mi.HasMovementFlag(MovementFlags(MOVEMENTFLAG_SWIMMING | MOVEMENTFLAG_FLYING)) || mi.HasExtraMovementFlag(MOVEMENTFLAG2_ALWAYS_ALLOW_PITCHING);
+        writer.HasFallDirection = mi.HasMovementFlag(MOVEMENTFLAG_FALLING);
+        writer.HasFallData = writer.HasFallDirection || mi.jump.fallTime != 0;
+        writer.HasSplineElevation = mi.HasMovementFlag(MOVEMENTFLAG_SPLINE_ELEVATION);
+        writer.Guid = state.Guid;
+        writer.TransportGuid = writer.HasTransportData ? mi.transport.guid : ObjectGuid::Empty;
+        writer.MovementCounter = state.MovementCounter;
+        sequence.Write(writer);
+        data.FlushBits();
+    }
+
+    void WriteReference(ByteBuffer& data, Movement::MovementStatusSequence const& sequence, MovementState const& state, Movement::ExtraMovementStatusElement* extras)
+    {
+        MovementStatusReference::WriteState writeState;
+        writeState.UnitPosition = &state.UnitPosition;
+        writeState.Guid = state.Guid;
+        writeState.MovementCounter = state.MovementCounter;
+        writeState.HasSpline = state.HasSpline;
+        MovementStatusReference::Write(data, sequence.Elements, state.Info, writeState, extras);
+        data.FlushBits();
+    }
+
+    // same as Player::ReadMovementInfo without the validation of the values read
+    void ReadGenerated(ByteBuffer& data, Movement::MovementStatusSequence const& sequence, MovementInfo& mi, Movement::ExtraMovementStatusElement* extras)
+    {
+        Movement::MovementStatusReader reader(data, mi, extras);
+        sequence.Read(reader);
+        mi.guid = reader.Guid;
+        mi.transport.guid = reader.TransportGuid;
+    }
+
+    template<class T>
+    bool SameBits(T const& left, T const& right) { return std::memcmp(&left, &right, sizeof(T)) == 0; }
+
+    bool SameMovementInfo(MovementInfo const& left, MovementInfo const& right)
+    {
+        return left.guid == right.guid && left.flags == right.flags && left.flags2 == right.flags2 && SameBits(left.pos, right.pos)
+            && left.time == right.time && left.movementCounter == right.movementCounter
+            && left.transport.guid == right.transport.guid && SameBits(left.transport.pos, right.transport.pos) && left.transport.seat == right.transport.seat
+            && left.transport.time == right.transport.time && left.transport.time2 == right.transport.time2 && left.transport.vehicleId == right.transport.vehicleId
+            && SameBits(left.pitch, right.pitch) && left.jump.fallTime == right.jump.fallTime && SameBits(left.jump.zspeed, right.jump.zspeed)
+            && SameBits(left.jump.sinAngle, right.jump.sinAngle) && SameBits(left.jump.cosAngle, right.jump.cosAngle)
+            && SameBits(left.jump.xyspeed, right.jump.xyspeed) && SameBits(left.splineElevation, right.splineElevation);
+    }
+
+    bool Contains(MovementStatusElements const* sequence, MovementStatusElements element)
+    {
+        for (; *sequence != MSEEnd; ++sequence)
+            if (*sequence == element)
+                return true;
+        return false;
+    }
+
+    struct OpcodeSequence
+    {
+        uint32 Opcode;
+        Movement::MovementStatusSequence const* Sequence;
+        std::vector<MovementStatusElements> ExtraElements;
+    };
+
+    std::vector<OpcodeSequence> GetAllSequences()
+    {
+        std::vector<OpcodeSequence> sequences;
+        for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+            if (Movement::MovementStatusSequence const* sequence = GetMovementStatusSequence(opcode))
+                sequences.push_back({ opcode, sequence, GetExtraElements(opcode, sequence->Elements) });
+        return sequences;
+    }
+}
+
+TEST_CASE("Generated movement status readers and writers match the element switch", "[MovementStructures]")
+{
+    std::vector<OpcodeSequence> sequences = GetAllSequences();
+    REQUIRE(!sequences.empty());
+
+    MovementStateGenerator generator(12345);
+    for (OpcodeSequence const& opcodeSequence : sequences)
+    {
+        Movement::MovementStatusSequence const& sequence = *opcodeSequence.Sequence;
+        // sequences containing MSEFlushBits are only sent by the server, no handler reads them
+        bool readable = !Contains(sequence.Elements, MSEFlushBits);
+
+        INFO("opcode 0x" << std::hex << opcodeSequence.Opcode);
+        for (uint32 i = 0; i < 2000; ++i)
+        {
+            MovementState state = generator.Next();
+
+            Movement::ExtraMovementStatusElement referenceExtras(opcodeSequence.ExtraElements.data());
+            Movement::ExtraMovementStatusElement generatedExtras(opcodeSequence.ExtraElements.data());
+            SetExtraData(referenceExtras, state);
+            SetExtraData(generatedExtras, state);
+
+            ByteBuffer referenceData, generatedData;
+            WriteReference(referenceData, sequence, state, &referenceExtras);
+            WriteGenerated(generatedData, sequence, state, &generatedExtras);
+            REQUIRE(referenceData.size() == generatedData.size());
+            REQUIRE(std::memcmp(referenceData.contents(), generatedData.contents(), generatedData.size()) == 0);
+
+            if (!readable)
+                continue;
+
+            MovementInfo referenceInfo, generatedInfo;
+            Movement::ExtraMovementStatusElement referenceReadExtras(opcodeSequence.ExtraElements.data());
+            Movement::ExtraMovementStatusElement generatedReadExtras(opcodeSequence.ExtraElements.data());
+            bool referenceThrew = false, generatedThrew = false;
+            try { MovementStatusReference::Read(referenceData, sequence.Elements, referenceInfo, &referenceReadExtras); }
+            catch (ByteBufferException const&) { referenceThrew = true; }
+            try { ReadGenerated(generatedData, sequence, generatedInfo, &generatedReadExtras); }
+            catch (ByteBufferException const&) { generatedThrew = true; }
+
+            // some states are not representable in a few sequences, both versions must reject them the same way
+            REQUIRE(referenceThrew == generatedThrew);
+            if (referenceThrew)
+                continue;
+
+            REQUIRE(SameMovementInfo(referenceInfo, generatedInfo));
+            REQUIRE(referenceData.rpos() == generatedData.rpos());
+            REQUIRE(referenceReadExtras.Data.guid == generatedReadExtras.Data.guid);
+            REQUIRE(SameBits(referenceReadExtras.Data.floatData, generatedReadExtras.Data.floatData));
+            REQUIRE(referenceReadExtras.Data.byteData == generatedReadExtras.Data.byteData);
+
+            // values every sequence carries survive the round trip
+            if (Contains(sequence.Elements, MSEHasGuidByte0))
+                REQUIRE(generatedInfo.guid == state.Guid);
+            if (Contains(sequence.Elements, MSECounter))
+                REQUIRE(generatedInfo.movementCounter == state.MovementCounter);
+        }
+    }
+}
+
+// Run with: tests-game "[benchmark]"
+TEST_CASE("Movement status read and write throughput", "[.][benchmark]")
+{
+    std::vector<OpcodeSequence> sequences = GetAllSequences();
+    std::vector<std::pair<OpcodeSequence const*, MovementState>> cases;
+    MovementStateGenerator generator(54321);
+    for (OpcodeSequence const& opcodeSequence : sequences)
+        if (!Contains(opcodeSequence.Sequence->Elements, MSEFlushBits) && !Contains(opcodeSequence.Sequence->Elements, MSEExtraElement))
+            for (uint32 i = 0; i < 16; ++i)
+                cases.emplace_back(&opcodeSequence, generator.Next());
+
+    std::vector<ByteBuffer> packets;
+    for (auto const& [opcodeSequence, state] : cases)
+    {
+        packets.emplace_back();
+        WriteGenerated(packets.back(), *opcodeSequence->Sequence, state, nullptr);
+    }
+
+    BENCHMARK("element switch write")
+    {
+        std::size_t size = 0;
+        for (auto const& [opcodeSequence, state] : cases)
+        {
+            ByteBuffer data(64);
+            WriteReference(data, *opcodeSequence->Sequence, state, nullptr);
+            size += data.size();
+        }
+        return size;
+    };
+
+    BENCHMARK("generated write")
+    {
+        std::size_t size = 0;
+        for (auto const& [opcodeSequence, state] : cases)
+        {
+            ByteBuffer data(64);
+            WriteGenerated(data, *opcodeSequence->Sequence, state, nullptr);
+            size += data.size();
+        }
+        return size;
+    };
+
+    BENCHMARK("element switch read")
+    {
+        uint32 time = 0;
+        for (std::size_t i = 0; i < cases.size(); ++i)
+        {
+            ByteBuffer data(packets[i]);
+            MovementInfo info;
+            try { MovementStatusReference::Read(data, cases[i].first->Sequence->Elements, info, nullptr); }
+            catch (ByteBufferException const&) { }
+            time += info.time;
+        }
+        return time;
+    };
+
+    BENCHMARK("generated read")
+    {
+        uint32 time = 0;
+        for (std::size_t i = 0; i < cases.size(); ++i)
+        {
+            ByteBuffer data(packets[i]);
+            MovementInfo info;
+            try { ReadGenerated(data, *cases[i].first->Sequence, info, nullptr); }
+            catch (ByteBufferException const&) { }
+            time += info.time;
+        }
+        return time;
+    };
+}